@@ -25,6 +25,8 @@
 #   DEAL_II_HAVE_COMPLEX_OPERATOR_OVERLOADS
 #   DEAL_II_HAVE_CXX17_BESSEL_FUNCTIONS
 #   DEAL_II_HAVE_CXX17_LEGENDRE_FUNCTIONS
+#   DEAL_II_HAVE_FP16
+#   DEAL_II_HAVE_BF16
 #   DEAL_II_FALLTHROUGH
 #   DEAL_II_CONSTEXPR
 #
@@ -428,6 +430,8 @@ unset_if_changed(CHECK_CXX_FEATURES_FLAGS_SAVED
   DEAL_II_HAVE_ATTRIBUTE_FALLTHROUGH
   DEAL_II_HAVE_CXX17_BESSEL_FUNCTIONS
   DEAL_II_HAVE_CXX17_LEGENDRE_FUNCTIONS
+  DEAL_II_HAVE_FP16
+  DEAL_II_HAVE_BF16
   DEAL_II_CXX14_CONSTEXPR_BUG_OK
   )
 
@@ -599,6 +603,43 @@ CHECK_CXX_SOURCE_COMPILES(
   )
 
 
+#
+# Check whether the compiler supports arithmetic on the 16-bit floating point
+# types _Float16 (IEEE half precision) and __bf16 (bfloat16). These are used
+# as storage types for vectors in mixed-precision algorithms, e.g., on the
+# levels of a matrix-free multigrid preconditioner, with all arithmetic done
+# in single precision.
+#
+
+CHECK_CXX_SOURCE_COMPILES(
+  "
+  int main()
+  {
+    _Float16 a = static_cast<_Float16>(1.5f);
+    volatile float b = 2.f;
+    a = a * static_cast<_Float16>(b) + a;
+    static_assert(sizeof(_Float16) == 2, \"wrong size\");
+    return static_cast<float>(a) == 4.5f ? 0 : 1;
+  }
+  "
+  DEAL_II_HAVE_FP16
+  )
+
+CHECK_CXX_SOURCE_COMPILES(
+  "
+  int main()
+  {
+    __bf16 a = static_cast<__bf16>(1.5f);
+    volatile float b = 2.f;
+    a = a * static_cast<__bf16>(b) + a;
+    static_assert(sizeof(__bf16) == 2, \"wrong size\");
+    return static_cast<float>(a) == 4.5f ? 0 : 1;
+  }
+  "
+  DEAL_II_HAVE_BF16
+  )
+
+
 #
 # Check for correct c++14 constexpr support.
 #
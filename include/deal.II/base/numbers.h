@@ -497,6 +497,86 @@ DEAL_II_NAMESPACE_OPEN // Do not convert for module purposes
     abs(const std::complex<number> &x);
   };
 
+
+#if defined(DEAL_II_HAVE_FP16) || defined(DEAL_II_HAVE_BF16)
+  /**
+   * Traits of the 16-bit floating point types _Float16 and __bf16, which
+   * are only meant for storing numbers, e.g., in vectors for mixed-precision
+   * algorithms, not for doing arithmetic on them. Derived quantities like
+   * norms are computed in single precision, which is why the real_type of
+   * these types is <code>float</code>.
+   */
+  template <typename number>
+  struct StorageNumberTraits
+  {
+    /**
+     * A flag that specifies whether the template type given to this class is
+     * complex or real. The 16-bit types are real.
+     */
+    static constexpr bool is_complex = false;
+
+    /**
+     * The real type used for computing with numbers of this type.
+     */
+    using real_type = float;
+
+    /**
+     * For this data type, alias the corresponding double type.
+     */
+    using double_type = double;
+
+    /**
+     * Return the complex-conjugate of the given number, i.e., the number
+     * itself.
+     */
+    static constexpr const number &
+    conjugate(const number &x)
+    {
+      return x;
+    }
+
+    /**
+     * Return the square of the absolute value of the given number, computed
+     * in single precision.
+     */
+    static constexpr real_type
+    abs_square(const number &x)
+    {
+      return static_cast<real_type>(x) * static_cast<real_type>(x);
+    }
+
+    /**
+     * Return the absolute value of the given number, computed in single
+     * precision.
+     */
+    static real_type
+    abs(const number &x)
+    {
+      return std::abs(static_cast<real_type>(x));
+    }
+  };
+#endif
+
+#ifdef DEAL_II_HAVE_FP16
+  /**
+   * Specialization of the general NumberTraits class for the IEEE half
+   * precision type _Float16.
+   */
+  template <>
+  struct NumberTraits<_Float16> : public StorageNumberTraits<_Float16>
+  {};
+#endif
+
+#ifdef DEAL_II_HAVE_BF16
+  /**
+   * Specialization of the general NumberTraits class for the bfloat16 type
+   * __bf16.
+   */
+  template <>
+  struct NumberTraits<__bf16> : public StorageNumberTraits<__bf16>
+  {};
+#endif
+
   // --------------- inline and template functions ---------------- //
 
   inline bool is_nan(const double x)
@@ -468,14 +468,15 @@ namespace Utilities
     {
       // In the import_from_ghosted_array_finish we need to invoke abs() also
       // on unsigned data types, which is ill-formed on newer C++
-      // standards. To avoid this, we use std::abs on default types but
+      // standards. To avoid this, we use numbers::NumberTraits::abs() on
+      // default types (which also covers 16-bit floating point types) but
       // simply return the number on unsigned types
       template <typename Number>
       std::enable_if_t<!std::is_unsigned_v<Number>,
                        typename numbers::NumberTraits<Number>::real_type>
       get_abs(const Number a)
       {
-        return std::abs(a);
+        return numbers::NumberTraits<Number>::abs(a);
       }
 
       template <typename Number>
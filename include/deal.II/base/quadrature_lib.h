@@ -956,6 +956,47 @@ public:
                                     const bool         use_odd_order = true);
 };
 
+/**
+ * Gauss rule for simplex entities obtained by mapping the tensor product
+ * Gauss rule with @p n_points_1D points per direction from the unit
+ * hypercube to the reference simplex with the collapsed-coordinate (Duffy)
+ * transformation
+ * @f[
+ * (x, y) = \left(\xi_0 (1-\xi_1),\ \xi_1\right)
+ * @f]
+ * in 2d and
+ * @f[
+ * (x, y, z) = \left(\xi_0 (1-\xi_1)(1-\xi_2),\ \xi_1 (1-\xi_2),\ \xi_2\right)
+ * @f]
+ * in 3d,
+ * where the weights include the determinant of the Jacobian, $(1-\xi_1)$ in
+ * 2d and $(1-\xi_1)(1-\xi_2)^2$ in 3d. The rule integrates polynomials of
+ * degree $2n-d$ exactly with $n^d$ points, which is more points than needed
+ * by the rules of QGaussSimplex or QWitherdenVincentSimplex, but it is
+ * available for any number of points. The points are ordered
+ * lexicographically in the collapsed coordinates with $\xi_0$ running
+ * fastest, so the rule retains the tensor product structure of the
+ * underlying Gauss rule. MatrixFree detects this structure and evaluates
+ * FE_SimplexP and FE_SimplexDGP elements with sum-factorization kernels in
+ * the collapsed coordinates instead of dense matrix-vector products.
+ *
+ * For 1d, the quadrature rule degenerates to a
+ * `dealii::QGauss<1>(n_points_1d)`.
+ *
+ * Also see
+ * @ref simplex "Simplex support".
+ */
+template <int dim>
+class QGaussCollapsedSimplex : public QSimplex<dim>
+{
+public:
+  /**
+   * Constructor taking the number of quadrature points @p n_points_1D per
+   * collapsed coordinate direction.
+   */
+  explicit QGaussCollapsedSimplex(const unsigned int n_points_1D);
+};
+
 /**
  * Iterated quadrature for simplices. Since simplex cannot be described as
  * tensor products the base quadrature has equal dimension.
@@ -148,6 +148,57 @@ namespace RepartitioningPolicyTools
     const unsigned int n_min_cells;
   };
 
+  /**
+   * A policy that agglomerates the cells onto fewer processes once the
+   * average number of cells per process that owns cells falls below a given
+   * threshold. This is intended for the coarse levels of global-coarsening
+   * multigrid, where a few hundred cells distributed among thousands of
+   * processes make the level operations dominated by the latency of the
+   * communication: in contrast to MinimalGranularityPolicy, which reacts on
+   * the process with the smallest number of cells, this policy is not
+   * triggered by a single process with few cells, and keeps the partition of
+   * the triangulation as long as the average granularity is sufficient.
+   *
+   * If the policy is triggered, the cells are distributed evenly among
+   * $\max(1, N_\text{cells} / n_\text{min})$ processes, in the order of the
+   * global active cell index, which preserves the locality of the
+   * space-filling curve of the original partition. By default, the first
+   * processes of the communicator get the cells, which keeps the
+   * communication within few compute nodes. Alternatively, the processes
+   * can be spread with a constant stride over the communicator, e.g., to
+   * keep one process per compute node and use the memory bandwidth of all
+   * nodes.
+   *
+   * The coarse-grid solve on the resulting levels can be restricted to the
+   * processes that own cells with MGCoarseGridSubcommunicatorSolver.
+   */
+  template <int dim, int spacedim = dim>
+  class AgglomerationPolicy : public Base<dim, spacedim>
+  {
+  public:
+    /**
+     * Constructor taking the minimal average number of cells per process
+     * and whether the processes that remain with cells after agglomeration
+     * should be spread over the communicator.
+     */
+    AgglomerationPolicy(const unsigned int n_min_cells_per_process,
+                        const bool         spread_over_processes = false);
+
+    virtual LinearAlgebra::distributed::Vector<double>
+    partition(const Triangulation<dim, spacedim> &tria_in) const override;
+
+  private:
+    /**
+     * Minimal average number of cells per process.
+     */
+    const unsigned int n_min_cells_per_process;
+
+    /**
+     * Whether the processes with cells are spread over the communicator.
+     */
+    const bool spread_over_processes;
+  };
+
   /**
    * A policy that allows to specify a weight of each cell. The underlying
    * algorithm will try to distribute the weights equally among the processes.
@@ -135,6 +135,14 @@ protected:
  * degree $k$. The corresponding element on hypercube cells is FE_Q, on
  * wegdes it is FE_WedgeP, and on pyramids it is FE_PyramidP.
  *
+ * In MatrixFree, this element is evaluated with dense products of the
+ * matrices of shape function values and gradients in the quadrature points
+ * for quadrature formulas without tensor product structure, such as the
+ * default choices QGaussSimplex and QWitherdenVincentSimplex. With
+ * QGaussCollapsedSimplex, sum-factorization kernels in collapsed
+ * coordinates are used instead, from degree 3 in 2d and degree 2 in 3d on,
+ * where they need fewer operations than the dense products.
+ *
  * Also see
  * @ref simplex "Simplex support".
  */
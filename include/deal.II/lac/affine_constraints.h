@@ -989,7 +989,14 @@ public:
    * \frac{u_3}{2} + \frac{u_2}{4} + \frac{u_4}{4}$. Note, however, that
    * cycles in this graph of constraints are not allowed, i.e., for example
    * $u_4$ may not itself be constrained, directly or indirectly, to $u_{13}$
-   * again.
+   * again. An exception is thrown if such a cycle is detected.
+   *
+   * To resolve the chains, the function sorts the constraints into levels
+   * of the graph of constraints, where the constraints on a level only refer
+   * to degrees of freedom that are unconstrained or constrained on a lower
+   * level. The levels are then processed one after the other, and the
+   * constraints within a level, including the sorting and merging of their
+   * entries, are processed in parallel using multiple threads.
    */
   void
   close();
@@ -795,285 +795,275 @@ AffineConstraints<number>::close()
 
 
 
-  // In debug mode we are computing an estimate for the maximum number
-  // of constraints so that we can bail out if there is a cycle in the
-  // constraints (which is easier than searching for cycles in the graph).
-  //
-  // Let us figure out the largest dof index. This is an upper bound for the
-  // number of constraints because it is an approximation for the number of dofs
-  // in our system.
-  [[maybe_unused]] size_type largest_idx = 0;
-  if constexpr (running_in_debug_mode())
-    {
-      for (const ConstraintLine &line : lines)
-        for (const std::pair<size_type, number> &entry : line.entries)
-          largest_idx = std::max(largest_idx, entry.first);
-    }
+  // Sort the entries of a line and merge duplicates, and re-scale them if
+  // necessary. As some entries might have had zero weights, we replace them
+  // by a vector with sharp sizes.
+  const auto sort_and_merge_entries = [](ConstraintLine &line) {
+    unsigned int duplicates                   = 0;
+    bool         is_sorted_without_duplicates = true;
+    for (unsigned int i = 1; i < line.entries.size(); ++i)
+      if (!(line.entries[i - 1].first < line.entries[i].first))
+        {
+          is_sorted_without_duplicates = false;
+          break;
+        }
+    if (is_sorted_without_duplicates == false)
+      {
+        std::sort(line.entries.begin(),
+                  line.entries.end(),
+                  [](const std::pair<unsigned int, number> &a,
+                     const std::pair<unsigned int, number> &b) -> bool {
+                    // Just look at the index, ignore the value.
+                    return a.first < b.first;
+                  });
+
+        // loop over the now sorted list and see whether any of the
+        // entries references the same dofs more than once in order to
+        // find how many non-duplicate entries we have. This lets us
+        // allocate the correct amount of memory for the constraint
+        // entries.
+        for (size_type i = 1; i < line.entries.size(); ++i)
+          if (line.entries[i].first == line.entries[i - 1].first)
+            ++duplicates;
+      }
 
-  // replace references to dofs that are themselves constrained. note that
-  // because we may replace references to other dofs that may themselves be
-  // constrained to third ones, we have to iterate over all this until we
-  // replace no chains of constraints any more
-  //
-  // the iteration replaces references to constrained degrees of freedom by
-  // second-order references. for example if x3=x0/2+x2/2 and x2=x0/2+x1/2,
-  // then the new list will be x3=x0/2+x0/4+x1/4. note that x0 appear
-  // twice. we will throw this duplicate out in the following step, where
-  // we sort the list so that throwing out duplicates becomes much more
-  // efficient. also, we have to do it only once, rather than in each
-  // iteration
-  [[maybe_unused]] size_type iteration                   = 0;
-  bool                       chained_constraint_replaced = false;
-  std::vector<bool>          line_finalized(lines.size(), false);
-  do
-    {
-      chained_constraint_replaced = false;
-      for (unsigned int line_index = 0; line_index < lines.size(); ++line_index)
-        if (line_finalized[line_index] == false)
+    if (duplicates > 0 || (line.entries.size() < line.entries.capacity()))
+      {
+        typename ConstraintLine::Entries new_entries;
+
+        // if we have no duplicates, copy verbatim the entries. this way,
+        // the final size is of the vector is correct.
+        if (duplicates == 0)
+          new_entries = line.entries;
+        else
           {
-            ConstraintLine &line = lines[line_index];
-
-            // we need to keep track of how many replacements we do in this
-            // line, because we can end up in a cycle A->B->C->A without the
-            // number of entries growing.
-            [[maybe_unused]] size_type n_replacements = 0;
-
-            // loop over all entries of this line (including ones that we
-            // have appended in this go around) and see whether they are
-            // further constrained. ignore elements that we don't store on
-            // the current processor.
-            const unsigned int n_original_entries  = line.entries.size();
-            bool               has_sub_constraints = false;
-            const size_type    lines_cache_size    = lines_cache.size();
-            for (unsigned int entry = 0; entry < n_original_entries; ++entry)
+            // otherwise, we need to go through the list and resolve the
+            // duplicates
+            new_entries.reserve(line.entries.size() - duplicates);
+            new_entries.push_back(line.entries[0]);
+            for (size_type j = 1; j < line.entries.size(); ++j)
+              if (line.entries[j].first == line.entries[j - 1].first)
+                {
+                  Assert(new_entries.back().first == line.entries[j].first,
+                         ExcInternalError());
+                  new_entries.back().second += line.entries[j].second;
+                }
+              else
+                new_entries.push_back(line.entries[j]);
+
+            Assert(new_entries.size() == line.entries.size() - duplicates,
+                   ExcInternalError());
+
+            // make sure there are really no duplicates left and that the
+            // list is still sorted
+            for (size_type j = 1; j < new_entries.size(); ++j)
               {
-                const size_type dof_index =
-                  calculate_line_index(line.entries[entry].first);
+                Assert(new_entries[j].first != new_entries[j - 1].first,
+                       ExcInternalError());
+                Assert(new_entries[j].first > new_entries[j - 1].first,
+                       ExcInternalError());
+              }
+          }
 
-                if (dof_index < lines_cache_size &&
-                    lines_cache[dof_index] != numbers::invalid_size_type)
-                  {
-                    // Now we found an index that is further constrained, so
-                    // we need to resolve the entries.  We may replace some of
-                    // them, and we may add some, but we only walk through the
-                    // original entries (and also don't touch the
-                    // replacements) even though in principle we could also do
-                    // the ones we have added or replaced. There is no harm in
-                    // doing so: we will simply treat those in the next round
-                    // around of the outer iteration.
-                    has_sub_constraints = true;
-
-                    const number weight = line.entries[entry].second;
-                    Assert(line.entries[entry].first != line.index,
-                           ExcMessage("Cycle in constraints detected!"));
-
-                    const ConstraintLine &constrained_line =
-                      lines[lines_cache[dof_index]];
-                    Assert(constrained_line.index == line.entries[entry].first,
-                           ExcInternalError());
+        // replace old list of constraints for this dof by the new one
+        line.entries.swap(new_entries);
+      }
+
+    // Finally do the following check: if the sum of weights for the
+    // constraints is close to one, but not exactly one, then rescale all
+    // the weights so that they sum up to 1. this adds a little numerical
+    // stability and avoids all sorts of problems where the actual value
+    // is close to, but not quite what we expected
+    //
+    // the case where the weights don't quite sum up happens when we
+    // compute the interpolation weights "on the fly", i.e. not from
+    // precomputed tables. in this case, the interpolation weights are
+    // also subject to round-off
+    number sum = 0.;
+    for (const std::pair<size_type, number> &entry : line.entries)
+      sum += entry.second;
+    if (std::abs(sum - number(1.)) < 1.e-13 &&
+        std::abs(sum - number(1.)) > 0.)
+      {
+        const number inverse_sum = number(1.) / sum;
+        for (std::pair<size_type, number> &entry : line.entries)
+          entry.second *= inverse_sum;
+        line.inhomogeneity *= inverse_sum;
+      }
+  };
+
+  // Next, replace references to dofs that are themselves constrained. For
+  // example if x3=x0/2+x2/2 and x2=x0/2+x1/2, then the new list will be
+  // x3=x0/2+x0/4+x1/4. Since x2 may in turn be constrained to other dofs, we
+  // first build the dependency graph of the lines, where a line depends on
+  // the lines of the constrained dofs among its entries, and assign each line
+  // the length of the longest chain of constraints below it as its level.
+  // Lines on level zero only refer to unconstrained dofs, and lines on a given
+  // level only depend on lines of lower levels. Hence, we can resolve the
+  // lines level by level, and all lines on the same level independently of
+  // each other. A line is resolved in a single sweep over its entries, since
+  // the lines it refers to are already resolved completely. We ignore
+  // entries that we don't store on the current processor.
+  const size_type lines_cache_size = lines_cache.size();
+  const auto      get_constraint_line = [&](const size_type dof) {
+    const size_type line_index = calculate_line_index(dof);
+    return line_index < lines_cache_size ? lines_cache[line_index] :
+                                                numbers::invalid_size_type;
+  };
 
-                    // now we have to replace an entry by its expansion. we do
-                    // that by overwriting the entry by the first entry of the
-                    // expansion and adding the remaining ones to the end,
-                    // where we will later process them once more
-                    //
-                    // we can of course only do that if the DoF that we are
-                    // currently handling is constrained by a linear combination
-                    // of other dofs:
-                    if (constrained_line.entries.size() > 0)
-                      {
-                        for (size_type i = 0;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          Assert(line.entries[entry].first !=
-                                   constrained_line.entries[i].first,
-                                 ExcMessage("Cycle in constraints detected!"));
-
-                        // replace first entry, then tack the rest to the end
-                        // of the list
-                        line.entries[entry] = std::pair<size_type, number>(
-                          constrained_line.entries[0].first,
-                          constrained_line.entries[0].second * weight);
-
-                        for (size_type i = 1;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          line.entries.emplace_back(
-                            constrained_line.entries[i].first,
-                            constrained_line.entries[i].second * weight);
-
-                        if constexpr (library_build_mode ==
-                                      LibraryBuildMode::debug)
-                          {
-                            // keep track of how many entries we replace in this
-                            // line. If we do more than there are constraints or
-                            // dofs in our system, we must have a cycle.
-                            ++n_replacements;
-                            Assert(n_replacements / 2 < largest_idx,
-                                   ExcMessage(
-                                     "Cycle in constraints detected!"));
-                          }
-                      }
-                    else
-                      // the DoF that we encountered is not constrained by a
-                      // linear combination of other dofs but is equal to just
-                      // the inhomogeneity (i.e. its chain of entries is
-                      // empty). in that case, we can't just overwrite the
-                      // current entry, but we have to actually eliminate
-                      // it. we do not want to change the loop length above we
-                      // do so by setting the 'first' entry to
-                      // invalid_size_type here to finally remove entries in a
-                      // second loop
-                      {
-                        line.entries[entry].first = numbers::invalid_size_type;
-                      }
-
-                    line.inhomogeneity +=
-                      constrained_line.inhomogeneity * weight;
+  // Compute the levels with a depth-first search with an explicit stack of
+  // the lines currently visited and the next entry to look at in each of
+  // them. Since a line on the stack depends on all lines above it, reaching
+  // such a line again means that there is a cycle in the constraints.
+  enum class VisitState : unsigned char
+  {
+    not_visited,
+    on_stack,
+    done
+  };
+  std::vector<unsigned int> levels(lines.size(), 0);
+  std::vector<VisitState>   visit_state(lines.size(), VisitState::not_visited);
+  std::vector<std::pair<size_type, size_type>> stack;
+  unsigned int                                 max_level = 0;
+  for (size_type first_line = 0; first_line < lines.size(); ++first_line)
+    if (visit_state[first_line] == VisitState::not_visited)
+      {
+        visit_state[first_line] = VisitState::on_stack;
+        stack.emplace_back(first_line, 0);
+        while (stack.empty() == false)
+          {
+            const size_type       line_index = stack.back().first;
+            const ConstraintLine &line       = lines[line_index];
+            size_type            &entry      = stack.back().second;
+
+            size_type next_line = numbers::invalid_size_type;
+            for (; entry < line.entries.size(); ++entry)
+              {
+                const size_type constraint_line =
+                  get_constraint_line(line.entries[entry].first);
+                if (constraint_line == numbers::invalid_size_type)
+                  continue;
+
+                AssertThrow(visit_state[constraint_line] !=
+                              VisitState::on_stack,
+                            ExcMessage("Cycle in constraints detected!"));
+                if (visit_state[constraint_line] == VisitState::done)
+                  levels[line_index] =
+                    std::max(levels[line_index], levels[constraint_line] + 1);
+                else
+                  {
+                    next_line = constraint_line;
+                    break;
                   }
               }
 
-            // If none of the entries in the current line refer to DoFs that are
-            // themselves constrained, then we can move on:
-            if (has_sub_constraints == false)
-              line_finalized[line_index] = true;
+            if (next_line != numbers::invalid_size_type)
+              {
+                visit_state[next_line] = VisitState::on_stack;
+                stack.emplace_back(next_line, 0);
+              }
             else
               {
-                chained_constraint_replaced = true;
-
-                // Now delete the elements we have marked for deletion.
-                auto remaining_entries = line.entries.begin();
-                for (const auto &entry : line.entries)
-                  if (entry.first != numbers::invalid_size_type)
-                    {
-                      *remaining_entries = entry;
-                      ++remaining_entries;
-                    }
-                line.entries.erase(remaining_entries, line.entries.end());
+                visit_state[line_index] = VisitState::done;
+                max_level = std::max(max_level, levels[line_index]);
+                stack.pop_back();
+                if (stack.empty() == false)
+                  levels[stack.back().first] =
+                    std::max(levels[stack.back().first],
+                             levels[line_index] + 1);
               }
           }
+      }
 
-      if constexpr (running_in_debug_mode())
-        {
-          // increase iteration count. note that we should not iterate more
-          // times than there are constraints, since this puts a natural upper
-          // bound on the length of constraint chains
-          ++iteration;
-          Assert(iteration <= lines.size() + 1, ExcInternalError());
-        }
-    }
-  while (chained_constraint_replaced == true);
+  // group the lines by their level
+  std::vector<size_type> level_start(max_level + 2, 0);
+  for (const unsigned int level : levels)
+    ++level_start[level + 1];
+  for (unsigned int level = 0; level <= max_level; ++level)
+    level_start[level + 1] += level_start[level];
+  std::vector<size_type> lines_by_level(lines.size());
+  {
+    std::vector<size_type> next_position(level_start.begin(),
+                                         level_start.end() - 1);
+    for (size_type line_index = 0; line_index < lines.size(); ++line_index)
+      lines_by_level[next_position[levels[line_index]]++] = line_index;
+  }
 
-  // Finally sort the entries and re-scale them if necessary. in this step,
-  // we also throw out duplicates as mentioned above. moreover, as some
-  // entries might have had zero weights, we replace them by a vector with
-  // sharp sizes.
-  //
-  // This is again an operation that works on each line separately. It can be
-  // run in parallel:
-  parallel::apply_to_subranges(
-    lines.begin(),
-    lines.end(),
-    [](const typename std::vector<ConstraintLine>::iterator &begin,
-       const typename std::vector<ConstraintLine>::iterator &end) {
-      for (ConstraintLine &line : boost::iterator_range<
-             typename std::vector<ConstraintLine>::iterator>(begin, end))
-        {
-          unsigned int duplicates                   = 0;
-          bool         is_sorted_without_duplicates = true;
-          for (unsigned int i = 1; i < line.entries.size(); ++i)
-            if (!(line.entries[i - 1].first < line.entries[i].first))
+  // resolve the chains level by level, and finally sort the entries of each
+  // line and throw out the duplicates mentioned above, so that the lines of
+  // the next level can use the compressed lines. This only touches the lines
+  // of the current level, so it can run in parallel:
+  for (unsigned int level = 0; level <= max_level; ++level)
+    parallel::apply_to_subranges(
+      lines_by_level.cbegin() + level_start[level],
+      lines_by_level.cbegin() + level_start[level + 1],
+      [&](const typename std::vector<size_type>::const_iterator &begin,
+          const typename std::vector<size_type>::const_iterator &end) {
+        for (auto line_index = begin; line_index != end; ++line_index)
+          {
+            ConstraintLine &line = lines[*line_index];
+
+            // loop over the original entries of this line and replace the
+            // ones that are further constrained by their expansion. we do
+            // that by overwriting the entry by the first entry of the
+            // expansion and adding the remaining ones to the end.
+            const size_type n_original_entries = line.entries.size();
+            bool            has_removed_entries = false;
+            for (size_type entry = 0; entry < n_original_entries; ++entry)
               {
-                is_sorted_without_duplicates = false;
-                break;
-              }
-          if (is_sorted_without_duplicates == false)
-            {
-              std::sort(line.entries.begin(),
-                        line.entries.end(),
-                        [](const std::pair<unsigned int, number> &a,
-                           const std::pair<unsigned int, number> &b) -> bool {
-                          // Just look at the index, ignore the value.
-                          return a.first < b.first;
-                        });
-
-              // loop over the now sorted list and see whether any of the
-              // entries references the same dofs more than once in order to
-              // find how many non-duplicate entries we have. This lets us
-              // allocate the correct amount of memory for the constraint
-              // entries.
-              for (size_type i = 1; i < line.entries.size(); ++i)
-                if (line.entries[i].first == line.entries[i - 1].first)
-                  ++duplicates;
-            }
+                const size_type constraint_line =
+                  get_constraint_line(line.entries[entry].first);
+                if (constraint_line == numbers::invalid_size_type)
+                  continue;
 
-          if (duplicates > 0 || (line.entries.size() < line.entries.capacity()))
-            {
-              typename ConstraintLine::Entries new_entries;
+                const ConstraintLine &constrained_line =
+                  lines[constraint_line];
+                Assert(constrained_line.index == line.entries[entry].first,
+                       ExcInternalError());
+                Assert(levels[constraint_line] < level, ExcInternalError());
 
-              // if we have no duplicates, copy verbatim the entries. this way,
-              // the final size is of the vector is correct.
-              if (duplicates == 0)
-                new_entries = line.entries;
-              else
-                {
-                  // otherwise, we need to go through the list and resolve the
-                  // duplicates
-                  new_entries.reserve(line.entries.size() - duplicates);
-                  new_entries.push_back(line.entries[0]);
-                  for (size_type j = 1; j < line.entries.size(); ++j)
-                    if (line.entries[j].first == line.entries[j - 1].first)
-                      {
-                        Assert(new_entries.back().first ==
-                                 line.entries[j].first,
-                               ExcInternalError());
-                        new_entries.back().second += line.entries[j].second;
-                      }
-                    else
-                      new_entries.push_back(line.entries[j]);
-
-                  Assert(new_entries.size() == line.entries.size() - duplicates,
-                         ExcInternalError());
+                const number weight = line.entries[entry].second;
+                if (constrained_line.entries.size() > 0)
+                  {
+                    line.entries[entry] = std::pair<size_type, number>(
+                      constrained_line.entries[0].first,
+                      constrained_line.entries[0].second * weight);
+
+                    for (size_type i = 1; i < constrained_line.entries.size();
+                         ++i)
+                      line.entries.emplace_back(
+                        constrained_line.entries[i].first,
+                        constrained_line.entries[i].second * weight);
+                  }
+                else
+                  // the DoF that we encountered is not constrained by a
+                  // linear combination of other dofs but is equal to just
+                  // the inhomogeneity (i.e. its chain of entries is
+                  // empty). in that case, we can't just overwrite the
+                  // current entry, but we have to actually eliminate it. we
+                  // mark the entry by setting the 'first' entry to
+                  // invalid_size_type here and remove it below
+                  {
+                    line.entries[entry].first = numbers::invalid_size_type;
+                    has_removed_entries       = true;
+                  }
 
-                  // make sure there are really no duplicates left and that the
-                  // list is still sorted
-                  for (size_type j = 1; j < new_entries.size(); ++j)
-                    {
-                      Assert(new_entries[j].first != new_entries[j - 1].first,
-                             ExcInternalError());
-                      Assert(new_entries[j].first > new_entries[j - 1].first,
-                             ExcInternalError());
-                    }
-                }
+                line.inhomogeneity += constrained_line.inhomogeneity * weight;
+              }
 
-              // replace old list of constraints for this dof by the new one
-              line.entries.swap(new_entries);
-            }
+            if (has_removed_entries)
+              line.entries.erase(
+                std::remove_if(line.entries.begin(),
+                               line.entries.end(),
+                               [](const std::pair<size_type, number> &p) {
+                                 return p.first == numbers::invalid_size_type;
+                               }),
+                line.entries.end());
 
-          // Finally do the following check: if the sum of weights for the
-          // constraints is close to one, but not exactly one, then rescale all
-          // the weights so that they sum up to 1. this adds a little numerical
-          // stability and avoids all sorts of problems where the actual value
-          // is close to, but not quite what we expected
-          //
-          // the case where the weights don't quite sum up happens when we
-          // compute the interpolation weights "on the fly", i.e. not from
-          // precomputed tables. in this case, the interpolation weights are
-          // also subject to round-off
-          number sum = 0.;
-          for (const std::pair<size_type, number> &entry : line.entries)
-            sum += entry.second;
-          if (std::abs(sum - number(1.)) < 1.e-13 &&
-              std::abs(sum - number(1.)) > 0.)
-            {
-              const number inverse_sum = number(1.) / sum;
-              for (std::pair<size_type, number> &entry : line.entries)
-                entry.second *= inverse_sum;
-              line.inhomogeneity *= inverse_sum;
-            }
-        }
-    },
-    /* grainsize = */ 100);
+            sort_and_merge_entries(line);
+          }
+      },
+      /* grainsize = */ 100);
 
   // if in debug mode: check that no dof is constrained to another dof that
   // is also constrained. exclude dofs from this check whose constraint
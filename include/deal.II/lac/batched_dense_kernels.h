@@ -0,0 +1,357 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_batched_dense_kernels_h
+#define dealii_batched_dense_kernels_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <cmath>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * Kernels for small dense square matrices stored in a Table<2, Number>. The
+ * functions are templated on the number type and are meant to be used with
+ * VectorizedArray, in which case each lane of the entries represents an
+ * independent matrix and one call factorizes or applies
+ * VectorizedArray::size() matrices at once, e.g. the matrices of the cells
+ * of a cell batch of MatrixFree. All operations are performed with the
+ * arithmetic operations of the number type, so they run at the full SIMD
+ * width without any branches depending on the values of the entries. They
+ * can also be used with scalar number types like `double`.
+ *
+ * Since different lanes would require different pivot sequences, the
+ * factorizations do not use pivoting. They are therefore only stable for
+ * matrices where Gaussian elimination without pivoting is stable, e.g.
+ * symmetric positive definite or diagonally dominant matrices, which
+ * includes the cell blocks of the usual discretizations of elliptic
+ * operators. The factorizations store the inverse of the diagonal entries
+ * to replace the divisions in the triangular solves by multiplications, so
+ * the factorized matrices must only be used with the respective solve
+ * functions.
+ *
+ * @ingroup Matrix2
+ */
+namespace BatchedDenseKernels
+{
+  /**
+   * Compute the LU factorization $A = LU$ of the square matrix @p matrix
+   * without pivoting in place. The strict lower triangle is overwritten by
+   * $L$, which has a unit diagonal, the strict upper triangle by $U$, and
+   * the diagonal by the inverse of the diagonal of $U$. The result is to be
+   * used with lu_solve().
+   */
+  template <typename Number>
+  void
+  lu_factorize(Table<2, Number> &matrix);
+
+  /**
+   * Solve the system $LUx = b$ with the factorization computed by
+   * lu_factorize(). On input, @p rhs_and_solution contains the right hand
+   * side $b$, on output the solution $x$.
+   */
+  template <typename Number>
+  void
+  lu_solve(const Table<2, Number>  &lu_factorization,
+           const ArrayView<Number> &rhs_and_solution);
+
+  /**
+   * Compute the Cholesky factorization $A = LL^T$ of the symmetric positive
+   * definite matrix @p matrix in place. Only the lower triangle of the
+   * matrix is read. The strict lower triangle is overwritten by $L$ and the
+   * diagonal by the inverse of the diagonal of $L$, while the strict upper
+   * triangle is left unchanged. The result is to be used with
+   * cholesky_solve().
+   */
+  template <typename Number>
+  void
+  cholesky_factorize(Table<2, Number> &matrix);
+
+  /**
+   * Solve the system $LL^Tx = b$ with the factorization computed by
+   * cholesky_factorize(). On input, @p rhs_and_solution contains the right
+   * hand side $b$, on output the solution $x$.
+   */
+  template <typename Number>
+  void
+  cholesky_solve(const Table<2, Number>  &cholesky_factorization,
+                 const ArrayView<Number> &rhs_and_solution);
+
+  /**
+   * Replace the square matrix @p matrix by its inverse, computed by
+   * Gauss-Jordan elimination without pivoting in place.
+   */
+  template <typename Number>
+  void
+  invert(Table<2, Number> &matrix);
+
+  /**
+   * Matrix-vector product $dst = A src$ with the matrix @p matrix, which
+   * needs not be square.
+   */
+  template <typename Number>
+  void
+  vmult(const Table<2, Number>        &matrix,
+        const ArrayView<Number>       &dst,
+        const ArrayView<const Number> &src);
+
+  /**
+   * Matrix-vector product $dst += A src$ with the matrix @p matrix, which
+   * needs not be square.
+   */
+  template <typename Number>
+  void
+  vmult_add(const Table<2, Number>        &matrix,
+            const ArrayView<Number>       &dst,
+            const ArrayView<const Number> &src);
+
+  /**
+   * Transpose matrix-vector product $dst = A^T src$ with the matrix
+   * @p matrix, which needs not be square.
+   */
+  template <typename Number>
+  void
+  Tvmult(const Table<2, Number>        &matrix,
+         const ArrayView<Number>       &dst,
+         const ArrayView<const Number> &src);
+
+
+
+  // ------------------------------ inline functions ---------------------
+
+
+
+  template <typename Number>
+  inline void
+  lu_factorize(Table<2, Number> &matrix)
+  {
+    const unsigned int n = matrix.n_rows();
+    AssertDimension(matrix.n_cols(), n);
+
+    for (unsigned int k = 0; k < n; ++k)
+      {
+        const Number inv_pivot = Number(1.) / matrix(k, k);
+        matrix(k, k)           = inv_pivot;
+        for (unsigned int i = k + 1; i < n; ++i)
+          {
+            const Number factor = matrix(i, k) * inv_pivot;
+            matrix(i, k)        = factor;
+            for (unsigned int j = k + 1; j < n; ++j)
+              matrix(i, j) -= factor * matrix(k, j);
+          }
+      }
+  }
+
+
+
+  template <typename Number>
+  inline void
+  lu_solve(const Table<2, Number>  &lu_factorization,
+           const ArrayView<Number> &rhs_and_solution)
+  {
+    const unsigned int n = lu_factorization.n_rows();
+    AssertDimension(lu_factorization.n_cols(), n);
+    AssertDimension(rhs_and_solution.size(), n);
+
+    Number *x = rhs_and_solution.data();
+
+    // forward substitution with the unit lower triangle
+    for (unsigned int i = 1; i < n; ++i)
+      {
+        Number sum = x[i];
+        for (unsigned int j = 0; j < i; ++j)
+          sum -= lu_factorization(i, j) * x[j];
+        x[i] = sum;
+      }
+
+    // backward substitution with the upper triangle
+    for (unsigned int i = n; i > 0;)
+      {
+        --i;
+        Number sum = x[i];
+        for (unsigned int j = i + 1; j < n; ++j)
+          sum -= lu_factorization(i, j) * x[j];
+        x[i] = sum * lu_factorization(i, i);
+      }
+  }
+
+
+
+  template <typename Number>
+  inline void
+  cholesky_factorize(Table<2, Number> &matrix)
+  {
+    const unsigned int n = matrix.n_rows();
+    AssertDimension(matrix.n_cols(), n);
+
+    using std::sqrt;
+    for (unsigned int j = 0; j < n; ++j)
+      {
+        Number diagonal = matrix(j, j);
+        for (unsigned int k = 0; k < j; ++k)
+          diagonal -= matrix(j, k) * matrix(j, k);
+        const Number inv_diagonal = Number(1.) / sqrt(diagonal);
+        matrix(j, j)              = inv_diagonal;
+
+        for (unsigned int i = j + 1; i < n; ++i)
+          {
+            Number sum = matrix(i, j);
+            for (unsigned int k = 0; k < j; ++k)
+              sum -= matrix(i, k) * matrix(j, k);
+            matrix(i, j) = sum * inv_diagonal;
+          }
+      }
+  }
+
+
+
+  template <typename Number>
+  inline void
+  cholesky_solve(const Table<2, Number>  &cholesky_factorization,
+                 const ArrayView<Number> &rhs_and_solution)
+  {
+    const unsigned int n = cholesky_factorization.n_rows();
+    AssertDimension(cholesky_factorization.n_cols(), n);
+    AssertDimension(rhs_and_solution.size(), n);
+
+    Number *x = rhs_and_solution.data();
+
+    // forward substitution with L
+    for (unsigned int i = 0; i < n; ++i)
+      {
+        Number sum = x[i];
+        for (unsigned int j = 0; j < i; ++j)
+          sum -= cholesky_factorization(i, j) * x[j];
+        x[i] = sum * cholesky_factorization(i, i);
+      }
+
+    // backward substitution with L^T
+    for (unsigned int i = n; i > 0;)
+      {
+        --i;
+        Number sum = x[i];
+        for (unsigned int j = i + 1; j < n; ++j)
+          sum -= cholesky_factorization(j, i) * x[j];
+        x[i] = sum * cholesky_factorization(i, i);
+      }
+  }
+
+
+
+  template <typename Number>
+  inline void
+  invert(Table<2, Number> &matrix)
+  {
+    const unsigned int n = matrix.n_rows();
+    AssertDimension(matrix.n_cols(), n);
+
+    for (unsigned int k = 0; k < n; ++k)
+      {
+        const Number inv_pivot = Number(1.) / matrix(k, k);
+        matrix(k, k)           = Number(1.);
+        for (unsigned int j = 0; j < n; ++j)
+          matrix(k, j) *= inv_pivot;
+
+        for (unsigned int i = 0; i < n; ++i)
+          if (i != k)
+            {
+              const Number factor = matrix(i, k);
+              matrix(i, k)        = Number();
+              for (unsigned int j = 0; j < n; ++j)
+                matrix(i, j) -= factor * matrix(k, j);
+            }
+      }
+  }
+
+
+
+  template <typename Number>
+  inline void
+  vmult(const Table<2, Number>        &matrix,
+        const ArrayView<Number>       &dst,
+        const ArrayView<const Number> &src)
+  {
+    AssertDimension(dst.size(), matrix.n_rows());
+    AssertDimension(src.size(), matrix.n_cols());
+    Assert(dst.data() != src.data(),
+           ExcMessage("The source and destination vectors must not alias."));
+
+    const unsigned int m = matrix.n_rows(), n = matrix.n_cols();
+    for (unsigned int i = 0; i < m; ++i)
+      {
+        Number sum = matrix(i, 0) * src[0];
+        for (unsigned int j = 1; j < n; ++j)
+          sum += matrix(i, j) * src[j];
+        dst[i] = sum;
+      }
+  }
+
+
+
+  template <typename Number>
+  inline void
+  vmult_add(const Table<2, Number>        &matrix,
+            const ArrayView<Number>       &dst,
+            const ArrayView<const Number> &src)
+  {
+    AssertDimension(dst.size(), matrix.n_rows());
+    AssertDimension(src.size(), matrix.n_cols());
+    Assert(dst.data() != src.data(),
+           ExcMessage("The source and destination vectors must not alias."));
+
+    const unsigned int m = matrix.n_rows(), n = matrix.n_cols();
+    for (unsigned int i = 0; i < m; ++i)
+      {
+        Number sum = dst[i];
+        for (unsigned int j = 0; j < n; ++j)
+          sum += matrix(i, j) * src[j];
+        dst[i] = sum;
+      }
+  }
+
+
+
+  template <typename Number>
+  inline void
+  Tvmult(const Table<2, Number>        &matrix,
+         const ArrayView<Number>       &dst,
+         const ArrayView<const Number> &src)
+  {
+    AssertDimension(dst.size(), matrix.n_cols());
+    AssertDimension(src.size(), matrix.n_rows());
+    Assert(dst.data() != src.data(),
+           ExcMessage("The source and destination vectors must not alias."));
+
+    const unsigned int m = matrix.n_rows(), n = matrix.n_cols();
+    for (unsigned int j = 0; j < n; ++j)
+      dst[j] = matrix(0, j) * src[0];
+    for (unsigned int i = 1; i < m; ++i)
+      for (unsigned int j = 0; j < n; ++j)
+        dst[j] += matrix(i, j) * src[i];
+  }
+} // namespace BatchedDenseKernels
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -28,6 +28,7 @@
 
 #include <deal.II/lac/read_vector.h>
 #include <deal.II/lac/vector_operation.h>
+#include <deal.II/lac/vector_operations_internal.h>
 #include <deal.II/lac/vector_type_traits.h>
 
 #include <iomanip>
@@ -191,6 +192,27 @@ namespace LinearAlgebra
      * fail in some circumstances. Therefore, it is strongly recommended to
      * not rely on this class to automatically detect the unsupported case.
      *
+     * <h4>16-bit floating point types</h4>
+     *
+     * If the compiler supports the types <code>_Float16</code> (IEEE half
+     * precision) or <code>__bf16</code> (bfloat16), which is indicated by the
+     * macros <code>DEAL_II_HAVE_FP16</code> and <code>DEAL_II_HAVE_BF16</code>,
+     * this class is also instantiated for these types in the Host memory
+     * space. These vectors are meant for storing data with half the memory
+     * traffic of single precision, e.g., for the level vectors of a
+     * matrix-free multigrid preconditioner where FEEvaluation with
+     * <code>Number = float</code> reads and writes the vector entries and does
+     * all arithmetic in single precision. Reductions like norms, inner
+     * products, and mean values are accumulated and returned in single
+     * precision, see numbers::NumberTraits::real_type and
+     * Vector::accumulation_type, to avoid overflow beyond the largest
+     * representable number (65504 for <code>_Float16</code>) and the
+     * stagnation of long sums. Conversions from and to vectors of type float
+     * and double are available via copy_locally_owned_data_from(), reinit(),
+     * and the assignment operator. In MatrixFree::cell_loop(), the ghost
+     * entries of such vectors are exchanged with the partitioner of the vector
+     * rather than on the subset of degrees of freedom accessed by the loop.
+     *
      * <h4>GPU support</h4>
      *
      * This vector class supports two different memory spaces: Host and Default.
@@ -267,6 +289,15 @@ namespace LinearAlgebra
       using size_type       = types::global_dof_index;
       using real_type       = typename numbers::NumberTraits<Number>::real_type;
 
+      /**
+       * The type in which sums over the vector entries are accumulated and
+       * returned by the inner products, add_and_dot(), and mean_value(). This
+       * is @p Number itself, except for the 16-bit floating point types, for
+       * which it is the single-precision real_type.
+       */
+      using accumulation_type =
+        ::dealii::internal::VectorOperations::AccumulationType<Number>;
+
       static_assert(
         std::is_same_v<MemorySpace, ::dealii::MemorySpace::Host> ||
           std::is_same_v<MemorySpace, ::dealii::MemorySpace::Default>,
@@ -773,7 +804,7 @@ namespace LinearAlgebra
       /**
        * Return the scalar product of two vectors.
        */
-      Number
+      accumulation_type
       operator*(const Vector<Number, MemorySpace> &V) const;
 
       /**
@@ -875,7 +906,7 @@ namespace LinearAlgebra
        * implemented as
        * $\left<v,w\right>=\sum_i v_i \bar{w_i}$.
        */
-      Number
+      accumulation_type
       add_and_dot(const Number                       a,
                   const Vector<Number, MemorySpace> &V,
                   const Vector<Number, MemorySpace> &W);
@@ -1172,7 +1203,7 @@ namespace LinearAlgebra
       /**
        * Compute the mean value of all the entries in the vector.
        */
-      Number
+      accumulation_type
       mean_value() const;
 
       /**
@@ -1259,8 +1290,8 @@ namespace LinearAlgebra
        * Exception
        */
       DeclException3(ExcNonMatchingElements,
-                     Number,
-                     Number,
+                     typename numbers::NumberTraits<Number>::double_type,
+                     typename numbers::NumberTraits<Number>::double_type,
                      unsigned int,
                      << "Called compress(VectorOperation::insert), but"
                      << " the element received from a remote processor, value "
@@ -1314,7 +1345,7 @@ namespace LinearAlgebra
        * Local part of the inner product of two vectors.
        */
       template <typename Number2>
-      Number
+      accumulation_type
       inner_product_local(const Vector<Number2, MemorySpace> &V) const;
 
       /**
@@ -1326,7 +1357,7 @@ namespace LinearAlgebra
       /**
        * Local part of mean_value().
        */
-      Number
+      accumulation_type
       mean_value_local() const;
 
       /**
@@ -1358,7 +1389,7 @@ namespace LinearAlgebra
        * vectors. The same applies for complex-valued vectors as for
        * the add_and_dot() function.
        */
-      Number
+      accumulation_type
       add_and_dot_local(const Number                       a,
                         const Vector<Number, MemorySpace> &V,
                         const Vector<Number, MemorySpace> &W);
@@ -1815,6 +1846,24 @@ struct is_serial_vector<LinearAlgebra::distributed::Vector<Number, MemorySpace>>
 
 
 
+namespace internal
+{
+  namespace VectorOperations
+  {
+    /**
+     * LinearAlgebra::distributed::Vector in the host memory space with float
+     * or double entries supports the fused operations of the iterative
+     * solvers.
+     */
+    template <typename Number>
+    constexpr bool supports_fused_operations<
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>> =
+      std::is_same_v<Number, double> || std::is_same_v<Number, float>;
+  } // namespace VectorOperations
+} // namespace internal
+
+
+
 namespace internal
 {
   namespace LinearOperatorImplementation
@@ -1875,7 +1875,7 @@ namespace LinearAlgebra
 
     template <typename Number, typename MemorySpaceType>
     template <typename Number2>
-    Number
+    typename Vector<Number, MemorySpaceType>::accumulation_type
     Vector<Number, MemorySpaceType>::inner_product_local(
       const Vector<Number2, MemorySpaceType> &v) const
     {
@@ -1896,11 +1896,11 @@ namespace LinearAlgebra
 
 
     template <typename Number, typename MemorySpaceType>
-    Number
+    typename Vector<Number, MemorySpaceType>::accumulation_type
     Vector<Number, MemorySpaceType>::operator*(
       const Vector<Number, MemorySpaceType> &v) const
     {
-      Number local_result = inner_product_local(v);
+      const accumulation_type local_result = inner_product_local(v);
       if (partitioner->n_mpi_processes() > 1)
         return Utilities::MPI::sum(local_result,
                                    partitioner->get_mpi_communicator());
@@ -1931,17 +1931,18 @@ namespace LinearAlgebra
 
 
     template <typename Number, typename MemorySpaceType>
-    Number
+    typename Vector<Number, MemorySpaceType>::accumulation_type
     Vector<Number, MemorySpaceType>::mean_value_local() const
     {
       Assert(size() != 0, ExcEmptyObject());
 
       if (partitioner->locally_owned_size() == 0)
-        return Number();
+        return accumulation_type();
 
-      Number sum = ::dealii::internal::VectorOperations::
-        functions<Number, Number, MemorySpaceType>::mean_value(
-          thread_loop_partitioner, partitioner->locally_owned_size(), data);
+      const accumulation_type sum =
+        ::dealii::internal::VectorOperations::
+          functions<Number, Number, MemorySpaceType>::mean_value(
+            thread_loop_partitioner, partitioner->locally_owned_size(), data);
 
       return sum / real_type(partitioner->locally_owned_size());
     }
@@ -1949,10 +1950,10 @@ namespace LinearAlgebra
 
 
     template <typename Number, typename MemorySpaceType>
-    Number
+    typename Vector<Number, MemorySpaceType>::accumulation_type
     Vector<Number, MemorySpaceType>::mean_value() const
     {
-      Number local_result = mean_value_local();
+      const accumulation_type local_result = mean_value_local();
       if (partitioner->n_mpi_processes() > 1)
         return Utilities::MPI::sum(local_result *
                                      static_cast<real_type>(
@@ -2086,7 +2087,7 @@ namespace LinearAlgebra
 
 
     template <typename Number, typename MemorySpaceType>
-    Number
+    typename Vector<Number, MemorySpaceType>::accumulation_type
     Vector<Number, MemorySpaceType>::add_and_dot_local(
       const Number                           a,
       const Vector<Number, MemorySpaceType> &v,
@@ -2096,7 +2097,7 @@ namespace LinearAlgebra
       AssertDimension(vec_size, v.locally_owned_size());
       AssertDimension(vec_size, w.locally_owned_size());
 
-      Number sum = dealii::internal::VectorOperations::
+      const accumulation_type sum = dealii::internal::VectorOperations::
         functions<Number, Number, MemorySpaceType>::add_and_dot(
           thread_loop_partitioner, vec_size, a, v.data, w.data, data);
 
@@ -2108,13 +2109,13 @@ namespace LinearAlgebra
 
 
     template <typename Number, typename MemorySpaceType>
-    Number
+    typename Vector<Number, MemorySpaceType>::accumulation_type
     Vector<Number, MemorySpaceType>::add_and_dot(
       const Number                           a,
       const Vector<Number, MemorySpaceType> &v,
       const Vector<Number, MemorySpaceType> &w)
     {
-      Number local_result = add_and_dot_local(a, v, w);
+      const accumulation_type local_result = add_and_dot_local(a, v, w);
       if (partitioner->n_mpi_processes() > 1)
         return Utilities::MPI::sum(local_result,
                                    partitioner->get_mpi_communicator());
@@ -2199,6 +2200,10 @@ namespace LinearAlgebra
       std::vector<Number> stored_elements(allocated_size);
       data.copy_to(stored_elements.data(), allocated_size);
 
+      // print in the precision of double_type, which also works for 16-bit
+      // floating point types that have no output operator
+      using print_type = typename numbers::NumberTraits<Number>::double_type;
+
       out << "Process #" << partitioner->this_mpi_process() << std::endl
           << "Local range: [" << partitioner->local_range().first << ", "
           << partitioner->local_range().second
@@ -2206,10 +2211,10 @@ namespace LinearAlgebra
           << "Vector data:" << std::endl;
       if (across)
         for (size_type i = 0; i < partitioner->locally_owned_size(); ++i)
-          out << stored_elements[i] << ' ';
+          out << print_type(stored_elements[i]) << ' ';
       else
         for (size_type i = 0; i < partitioner->locally_owned_size(); ++i)
-          out << stored_elements[i] << std::endl;
+          out << print_type(stored_elements[i]) << std::endl;
       out << std::endl;
 
       if (vector_is_ghosted)
@@ -2219,13 +2224,15 @@ namespace LinearAlgebra
             for (size_type i = 0; i < partitioner->n_ghost_indices(); ++i)
               out << '(' << partitioner->ghost_indices().nth_index_in_set(i)
                   << '/'
-                  << stored_elements[partitioner->locally_owned_size() + i]
+                  << print_type(
+                       stored_elements[partitioner->locally_owned_size() + i])
                   << ") ";
           else
             for (size_type i = 0; i < partitioner->n_ghost_indices(); ++i)
               out << '(' << partitioner->ghost_indices().nth_index_in_set(i)
                   << '/'
-                  << stored_elements[partitioner->locally_owned_size() + i]
+                  << print_type(
+                       stored_elements[partitioner->locally_owned_size() + i])
                   << ')' << std::endl;
           out << std::endl;
         }
@@ -53,7 +53,38 @@ namespace LinearAlgebra
      * done on cached data. For these beneficial reasons, this is the default
      * algorithm in the SolverGMRES class.
      */
-    delayed_classical_gram_schmidt
+    delayed_classical_gram_schmidt,
+    /**
+     * Use the communication-avoiding s-step variant of the Arnoldi process.
+     * Rather than orthogonalizing each new Krylov vector as soon as it has
+     * been computed, SolverGMRES generates a block of $s$ Krylov vectors
+     * (with $s$ given by SolverGMRES::AdditionalData::s_step_size) by
+     * successive applications of the (preconditioned) matrix, using a
+     * Newton basis with shifts given by Ritz values in order to keep the
+     * vectors of the block well-conditioned. The block is then orthogonalized
+     * against the previous basis vectors and among itself by a block
+     * classical Gram-Schmidt algorithm with reorthogonalization (BCGS2),
+     * where each of the two passes needs only a single global reduction that
+     * computes the projections onto the previous basis vectors and the Gram
+     * matrix of the block together, followed by a Cholesky QR factorization
+     * of the projected block. The Hessenberg matrix of the Arnoldi process is
+     * reconstructed from the factors of the block orthogonalization and the
+     * change of basis of the Newton polynomials. This reduces the number of
+     * global reductions from one or two per iteration to two per $s$
+     * iterations, which is beneficial for large numbers of MPI processes
+     * where the latency of the reductions dominates.
+     *
+     * The first $s$ iterations, which are needed to compute the Ritz values,
+     * as well as blocks where the Cholesky factorization detects a loss of
+     * rank, are performed by the classical Gram-Schmidt algorithm with
+     * reorthogonalization. The same holds for solvers other than SolverGMRES
+     * (like SolverFGMRES) that do not support the s-step variant.
+     *
+     * @note The Ritz values are computed with LAPACK. If deal.II has not
+     * been configured with LAPACK, SolverGMRES::solve() throws
+     * ExcNeedsLAPACK for this strategy.
+     */
+    s_step_block_classical_gram_schmidt
   };
 } // namespace LinearAlgebra
 
@@ -28,6 +28,7 @@
 #include <deal.II/lac/diagonal_matrix.h>
 #include <deal.II/lac/identity_matrix.h>
 #include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/lac/vector_memory.h>
 
 #include <Kokkos_Core.hpp>
@@ -613,6 +614,23 @@ public:
      * invocation of vmult() or step().
      */
     unsigned int n_iterations;
+
+    /**
+     * If set to true, PreconditionSOR and PreconditionSSOR visit the rows of
+     * a SparseMatrix in a multicolored ordering computed by
+     * SparsityTools::make_greedy_coloring() when the preconditioner is
+     * initialized. The rows of each color are independent of each other and
+     * are processed in parallel, whereas the default is a strictly sequential
+     * sweep over all rows. Note that the multicolored ordering is a
+     * different ordering of the unknowns, so the preconditioner is not the
+     * same as the one obtained with the default setting, and typically
+     * somewhat less effective per iteration.
+     *
+     * This flag is ignored by the other relaxation methods and for matrix
+     * types that do not provide multicolored relaxation functions. It is not
+     * part of the constructor arguments and needs to be set explicitly.
+     */
+    bool use_multicoloring;
   };
 
   /**
@@ -826,6 +844,39 @@ namespace internal
     constexpr bool has_SSOR_step =
       is_supported_operation<SSOR_step_t, T, VectorType>;
 
+    template <typename T, typename VectorType>
+    using multicolored_SOR_t =
+      decltype(std::declval<const T>().precondition_SOR(
+        std::declval<VectorType &>(),
+        std::declval<const VectorType &>(),
+        std::declval<const double>(),
+        std::declval<
+          const std::vector<std::vector<typename T::size_type>> &>()));
+
+    // whether the matrix provides the multicolored variants of the SOR and
+    // SSOR functions, as SparseMatrix does
+    template <typename T, typename VectorType>
+    constexpr bool has_multicolored_relaxation =
+      is_supported_operation<multicolored_SOR_t, T, VectorType>;
+
+    // compute a coloring of the rows of the matrix for the multicolored
+    // relaxation methods, or return an empty object if the matrix does not
+    // support them
+    template <typename MatrixType>
+    std::vector<std::vector<typename MatrixType::size_type>>
+    compute_colored_rows(const MatrixType &A)
+    {
+      if constexpr (has_multicolored_relaxation<
+                      MatrixType,
+                      dealii::Vector<typename MatrixType::value_type>>)
+        return SparsityTools::make_greedy_coloring(A.get_sparsity_pattern());
+      else
+        {
+          (void)A;
+          return {};
+        }
+    }
+
     template <typename MatrixType>
     class PreconditionJacobiImpl
     {
@@ -887,15 +938,32 @@ namespace internal
     class PreconditionSORImpl
     {
     public:
-      PreconditionSORImpl(const MatrixType &A, const double relaxation)
+      using size_type = typename MatrixType::size_type;
+
+      PreconditionSORImpl(const MatrixType &A,
+                          const double      relaxation,
+                          const bool        use_multicoloring = false)
         : A(&A)
         , relaxation(relaxation)
-      {}
+      {
+        if (use_multicoloring)
+          colored_rows = compute_colored_rows(A);
+      }
 
       template <typename VectorType>
       void
       vmult(VectorType &dst, const VectorType &src) const
       {
+        if constexpr (has_multicolored_relaxation<MatrixType, VectorType>)
+          if (colored_rows.size() > 0)
+            {
+              this->A->precondition_SOR(dst,
+                                        src,
+                                        this->relaxation,
+                                        colored_rows);
+              return;
+            }
+
         this->A->precondition_SOR(dst, src, this->relaxation);
       }
 
@@ -903,6 +971,16 @@ namespace internal
       void
       Tvmult(VectorType &dst, const VectorType &src) const
       {
+        if constexpr (has_multicolored_relaxation<MatrixType, VectorType>)
+          if (colored_rows.size() > 0)
+            {
+              this->A->precondition_TSOR(dst,
+                                         src,
+                                         this->relaxation,
+                                         colored_rows);
+              return;
+            }
+
         this->A->precondition_TSOR(dst, src, this->relaxation);
       }
 
@@ -912,6 +990,13 @@ namespace internal
       void
       step(VectorType &dst, const VectorType &src) const
       {
+        if constexpr (has_multicolored_relaxation<MatrixType, VectorType>)
+          if (colored_rows.size() > 0)
+            {
+              this->A->SOR_step(dst, src, this->relaxation, colored_rows);
+              return;
+            }
+
         this->A->SOR_step(dst, src, this->relaxation);
       }
 
@@ -932,6 +1017,13 @@ namespace internal
       void
       Tstep(VectorType &dst, const VectorType &src) const
       {
+        if constexpr (has_multicolored_relaxation<MatrixType, VectorType>)
+          if (colored_rows.size() > 0)
+            {
+              this->A->TSOR_step(dst, src, this->relaxation, colored_rows);
+              return;
+            }
+
         this->A->TSOR_step(dst, src, this->relaxation);
       }
 
@@ -949,6 +1041,12 @@ namespace internal
     private:
       const ObserverPointer<const MatrixType> A;
       const double                            relaxation;
+
+      /**
+       * The rows of the matrix grouped by colors if the multicolored
+       * variant is used, empty otherwise.
+       */
+      std::vector<std::vector<size_type>> colored_rows;
     };
 
     template <typename MatrixType>
@@ -957,10 +1055,15 @@ namespace internal
     public:
       using size_type = typename MatrixType::size_type;
 
-      PreconditionSSORImpl(const MatrixType &A, const double relaxation)
+      PreconditionSSORImpl(const MatrixType &A,
+                           const double      relaxation,
+                           const bool        use_multicoloring = false)
         : A(&A)
         , relaxation(relaxation)
       {
+        if (use_multicoloring)
+          colored_rows = compute_colored_rows(A);
+
         // in case we have a SparseMatrix class, we can extract information
         // about the diagonal.
         const SparseMatrix<typename MatrixType::value_type> *mat =
@@ -993,6 +1096,16 @@ namespace internal
       void
       vmult(VectorType &dst, const VectorType &src) const
       {
+        if constexpr (has_multicolored_relaxation<MatrixType, VectorType>)
+          if (colored_rows.size() > 0)
+            {
+              this->A->precondition_SSOR(dst,
+                                         src,
+                                         this->relaxation,
+                                         colored_rows);
+              return;
+            }
+
         this->A->precondition_SSOR(dst,
                                    src,
                                    this->relaxation,
@@ -1003,10 +1116,8 @@ namespace internal
       void
       Tvmult(VectorType &dst, const VectorType &src) const
       {
-        this->A->precondition_SSOR(dst,
-                                   src,
-                                   this->relaxation,
-                                   pos_right_of_diagonal);
+        // call vmult, since preconditioner is symmetrical
+        this->vmult(dst, src);
       }
 
       template <typename VectorType,
@@ -1015,6 +1126,13 @@ namespace internal
       void
       step(VectorType &dst, const VectorType &src) const
       {
+        if constexpr (has_multicolored_relaxation<MatrixType, VectorType>)
+          if (colored_rows.size() > 0)
+            {
+              this->A->SSOR_step(dst, src, this->relaxation, colored_rows);
+              return;
+            }
+
         this->A->SSOR_step(dst, src, this->relaxation);
       }
 
@@ -1046,6 +1164,12 @@ namespace internal
        * the diagonal is located.
        */
       std::vector<std::size_t> pos_right_of_diagonal;
+
+      /**
+       * The rows of the matrix grouped by colors if the multicolored
+       * variant is used, empty otherwise.
+       */
+      std::vector<std::vector<size_type>> colored_rows;
     };
 
     template <typename MatrixType>
@@ -2203,6 +2327,25 @@ public:
   void
   vmult(VectorType &dst, const VectorType &src) const;
 
+  /**
+   * Compute the action of the preconditioner on <tt>src</tt> like vmult(),
+   * and additionally compute the residual <tt>residual = src - A dst</tt>
+   * of the result with the matrix passed to initialize(). If the matrix
+   * provides a vmult() function taking two additional `std::function`
+   * arguments to be run on subranges of the vectors before and after the
+   * matrix-vector product, as explained for PreconditionRelaxation, the
+   * subtraction from <tt>src</tt> is done within the matrix-vector product,
+   * which saves a sweep through the vectors. This is used by multigrid
+   * methods, which need the residual after the pre-smoothing, see
+   * MGSmootherBase::apply_and_compute_residual().
+   *
+   * The vector <tt>residual</tt> must have the same layout as <tt>src</tt>.
+   */
+  void
+  vmult_and_compute_residual(VectorType       &dst,
+                             VectorType       &residual,
+                             const VectorType &src) const;
+
   /**
    * Compute the action of the transposed preconditioner on <tt>src</tt>,
    * storing the result in <tt>dst</tt>.
@@ -2935,7 +3078,9 @@ PreconditionSOR<MatrixType>::initialize(const MatrixType     &A,
   parameters.relaxation   = 1.0;
   parameters.n_iterations = parameters_in.n_iterations;
   parameters.preconditioner =
-    std::make_shared<PreconditionerType>(A, parameters_in.relaxation);
+    std::make_shared<PreconditionerType>(A,
+                                         parameters_in.relaxation,
+                                         parameters_in.use_multicoloring);
 
   this->BaseClass::initialize(A, parameters);
 }
@@ -2957,7 +3102,9 @@ PreconditionSSOR<MatrixType>::initialize(const MatrixType     &A,
   parameters.relaxation   = 1.0;
   parameters.n_iterations = parameters_in.n_iterations;
   parameters.preconditioner =
-    std::make_shared<PreconditionerType>(A, parameters_in.relaxation);
+    std::make_shared<PreconditionerType>(A,
+                                         parameters_in.relaxation,
+                                         parameters_in.use_multicoloring);
 
   this->BaseClass::initialize(A, parameters);
 }
@@ -3096,6 +3243,7 @@ inline PreconditionRelaxation<MatrixType, PreconditionerType>::AdditionalData::
       safety_factor)
   , relaxation(relaxation)
   , n_iterations(n_iterations)
+  , use_multicoloring(false)
 {}
 
 
@@ -3723,6 +3871,59 @@ namespace internal
         }
     }
 
+    // compute the residual rhs - A * solution for general matrices
+    template <typename MatrixType,
+              typename VectorType,
+              std::enable_if_t<!has_vmult_with_std_functions_for_precondition<
+                                 MatrixType,
+                                 VectorType>,
+                               int> * = nullptr>
+    inline void
+    compute_residual(const MatrixType &matrix,
+                     const VectorType &rhs,
+                     const VectorType &solution,
+                     VectorType       &residual)
+    {
+      matrix.vmult(residual, solution);
+      residual.sadd(-1.0, 1.0, rhs);
+    }
+
+    // compute the residual within the matrix-vector product for matrices
+    // that can work on subranges
+    template <typename MatrixType,
+              typename VectorType,
+              std::enable_if_t<has_vmult_with_std_functions_for_precondition<
+                                 MatrixType,
+                                 VectorType>,
+                               int> * = nullptr>
+    inline void
+    compute_residual(const MatrixType &matrix,
+                     const VectorType &rhs,
+                     const VectorType &solution,
+                     VectorType       &residual)
+    {
+      using Number = typename VectorType::value_type;
+
+      matrix.vmult(
+        residual,
+        solution,
+        [&](const unsigned int start_range, const unsigned int end_range) {
+          // zero 'residual' before running the vmult operation
+          if (end_range > start_range)
+            std::memset(residual.begin() + start_range,
+                        0,
+                        sizeof(Number) * (end_range - start_range));
+        },
+        [&](const unsigned int start_range, const unsigned int end_range) {
+          const auto rhs_ptr      = rhs.begin();
+          const auto residual_ptr = residual.begin();
+
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for (std::size_t i = start_range; i < end_range; ++i)
+            residual_ptr[i] = rhs_ptr[i] - residual_ptr[i];
+        });
+    }
+
     template <typename MatrixType, typename PreconditionerType>
     inline void
     initialize_preconditioner(
@@ -3983,6 +4184,25 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::vmult(
 
 
 
+template <typename MatrixType, typename VectorType, typename PreconditionerType>
+inline void
+PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
+  vmult_and_compute_residual(VectorType       &solution,
+                             VectorType       &residual,
+                             const VectorType &rhs) const
+{
+  AssertDimension(residual.size(), rhs.size());
+
+  vmult(solution, rhs);
+
+  internal::PreconditionChebyshevImplementation::compute_residual(*matrix_ptr,
+                                                                  rhs,
+                                                                  solution,
+                                                                  residual);
+}
+
+
+
 template <typename MatrixType, typename VectorType, typename PreconditionerType>
 inline void
 PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::Tvmult(
@@ -0,0 +1,346 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_precondition_amg_h
+#define dealii_precondition_amg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/observer_pointer.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Preconditioners
+ * @{
+ */
+
+/**
+ * An algebraic multigrid preconditioner based on smoothed aggregation for
+ * matrices of type SparseMatrix<double>, following P. Vaněk, J. Mandel,
+ * M. Brezina: "Algebraic multigrid by smoothed aggregation for second and
+ * fourth order elliptic problems", Computing 56 (1996). It does not depend
+ * on external libraries and can be used for scalar elliptic problems, e.g.
+ * as the coarse-grid solver of geometric multigrid methods or as a
+ * preconditioner for the whole problem, in cases where
+ * TrilinosWrappers::PreconditionAMG or PETScWrappers::PreconditionBoomerAMG
+ * are not available.
+ *
+ * The hierarchy of levels is built in initialize() as follows:
+ * <ol>
+ * <li> The strength of connection is determined by the criterion
+ * $|a_{ij}| > \theta \sqrt{|a_{ii}a_{jj}|}$ with the parameter
+ * AdditionalData::strong_connection_threshold $\theta$.</li>
+ * <li> The unknowns are grouped into aggregates by the three-phase greedy
+ * algorithm of Vaněk et al. To run the aggregation in parallel with threads,
+ * the rows are split into blocks of consecutive indices whose size only
+ * depends on the size of the matrix, and each block is aggregated
+ * independently, ignoring the connections to other blocks. As a result, the
+ * aggregates do not depend on the number of threads. Rows without
+ * off-diagonal entries, such as the ones of constrained degrees of freedom
+ * with an identity row, are not aggregated and only treated by the
+ * smoother.</li>
+ * <li> The tentative prolongator $P_0$ interpolates the constant vector on
+ * each aggregate, and is improved by one step of damped Jacobi, $P = (I -
+ * \frac{\omega}{\lambda} D^{-1}A)P_0$, where $\lambda$ is the Gershgorin
+ * bound on the largest eigenvalue of $D^{-1}A$ and $\omega$ is the parameter
+ * AdditionalData::prolongator_damping.</li>
+ * <li> The coarse matrix is computed by the Galerkin triple product $A_c =
+ * P^T A P$, with both sparse matrix-matrix products computed in parallel
+ * over the rows.</li>
+ * </ol>
+ * The coarsening stops once the matrix size is below
+ * AdditionalData::coarse_size, the maximal number of levels is reached, or
+ * the aggregation does not reduce the size noticeably. On the coarsest
+ * level, the inverse of the matrix is computed explicitly with
+ * FullMatrix::gauss_jordan() and applied as a dense matrix-vector product,
+ * so the matrix there must be non-singular. If the coarsening stopped on a
+ * level with more than PreconditionAMG::coarse_size_factor times
+ * AdditionalData::coarse_size rows, the dense inverse would be too
+ * expensive in time and memory. In that case, only the smoother is applied
+ * on the coarsest level, which keeps the preconditioner usable but makes the
+ * number of iterations grow with the size of that level.
+ *
+ * The method vmult() applies one V-cycle with the smoother selected by
+ * AdditionalData::smoother_type, either a Chebyshev iteration around the
+ * point-Jacobi method with PreconditionChebyshev, which uses the Gershgorin
+ * bound as the largest eigenvalue, or a damped Jacobi method with
+ * PreconditionJacobi. Since pre- and post-smoothing use the same
+ * operation, the V-cycle is symmetric and can be used within SolverCG.
+ *
+ * This class only supports serial matrices; the operations on the matrices
+ * and vectors are parallelized with threads.
+ */
+class PreconditionAMG : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * The factor by which the size of the coarsest level may exceed
+   * AdditionalData::coarse_size for the matrix on that level to be still
+   * inverted directly.
+   */
+  static constexpr unsigned int coarse_size_factor = 10;
+
+  /**
+   * The smoothers that can be selected for the levels of the hierarchy.
+   */
+  enum class SmootherType
+  {
+    /**
+     * PreconditionChebyshev with the inverse diagonal as inner
+     * preconditioner.
+     */
+    chebyshev,
+    /**
+     * PreconditionJacobi with the relaxation parameter
+     * AdditionalData::jacobi_relaxation.
+     */
+    jacobi
+  };
+
+  /**
+   * Standardized data struct to pipe additional parameters to the
+   * preconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const double       strong_connection_threshold = 0.08,
+                   const double       prolongator_damping         = 4. / 3.,
+                   const unsigned int max_levels                  = 20,
+                   const unsigned int coarse_size                 = 200,
+                   const SmootherType smoother_type = SmootherType::chebyshev,
+                   const unsigned int smoother_sweeps   = 2,
+                   const double       smoothing_range   = 20.,
+                   const double       jacobi_relaxation = 0.6);
+
+    /**
+     * The threshold $\theta$ of the strength-of-connection criterion.
+     */
+    double strong_connection_threshold;
+
+    /**
+     * The damping factor $\omega$ of the prolongator smoothing; a value of
+     * zero results in plain aggregation.
+     */
+    double prolongator_damping;
+
+    /**
+     * The maximal number of levels of the hierarchy, including the finest
+     * one.
+     */
+    unsigned int max_levels;
+
+    /**
+     * The size of the matrix below which no further coarsening is done and
+     * the matrix is inverted directly. The coarsest level is only inverted
+     * directly if its size is at most PreconditionAMG::coarse_size_factor
+     * times this value, otherwise the smoother is applied there.
+     */
+    unsigned int coarse_size;
+
+    /**
+     * The smoother on the levels.
+     */
+    SmootherType smoother_type;
+
+    /**
+     * The number of smoothing sweeps before and after the coarse-grid
+     * correction. For the Chebyshev smoother, this is the degree of the
+     * polynomial.
+     */
+    unsigned int smoother_sweeps;
+
+    /**
+     * The range of eigenvalues the Chebyshev smoother should damp, given as
+     * the ratio between the largest eigenvalue and the smallest one to be
+     * treated.
+     */
+    double smoothing_range;
+
+    /**
+     * The relaxation parameter of the Jacobi smoother.
+     */
+    double jacobi_relaxation;
+  };
+
+  /**
+   * Constructor. Does nothing.
+   */
+  PreconditionAMG() = default;
+
+  /**
+   * Destructor.
+   */
+  ~PreconditionAMG() override;
+
+  /**
+   * Build the multigrid hierarchy for the given matrix. The matrix is
+   * referenced as the operator on the finest level, so it must stay alive
+   * and unchanged as long as this object is used.
+   */
+  void
+  initialize(const SparseMatrix<double> &matrix,
+             const AdditionalData       &additional_data = AdditionalData());
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Apply one V-cycle to @p src, starting from a zero initial guess, and
+   * write the result into @p dst.
+   */
+  void
+  vmult(Vector<double> &dst, const Vector<double> &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner, which is the same as vmult()
+   * for symmetric matrices.
+   */
+  void
+  Tvmult(Vector<double> &dst, const Vector<double> &src) const;
+
+  /**
+   * Return the number of levels of the hierarchy.
+   */
+  unsigned int
+  n_levels() const;
+
+  /**
+   * Return the number of rows of the matrix on the given level, where level
+   * zero is the finest one.
+   */
+  size_type
+  m(const unsigned int level = 0) const;
+
+  /**
+   * Return the operator complexity, i.e., the number of nonzero entries of
+   * the matrices on all levels divided by the one of the finest matrix.
+   */
+  double
+  operator_complexity() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The data of one level of the hierarchy.
+   */
+  struct Level
+  {
+    /**
+     * The sparsity patterns of the level matrix (not used on the finest
+     * level), the prolongator from the next coarser level, and its
+     * transpose.
+     */
+    SparsityPattern sparsity, sparsity_prolongation, sparsity_restriction;
+
+    /**
+     * The Galerkin matrix of this level, not used on the finest level.
+     */
+    SparseMatrix<double> owned_matrix;
+
+    /**
+     * Pointer to the matrix of this level.
+     */
+    ObserverPointer<const SparseMatrix<double>> matrix;
+
+    /**
+     * The prolongator from the next coarser level and its transpose.
+     */
+    SparseMatrix<double> prolongation, restriction;
+
+    /**
+     * The smoothers; only the one selected in AdditionalData is set up.
+     */
+    PreconditionChebyshev<SparseMatrix<double>, Vector<double>> chebyshev;
+    PreconditionJacobi<SparseMatrix<double>>                    jacobi;
+
+    /**
+     * Vectors for the residual, the right hand side and the solution on the
+     * next coarser level.
+     */
+    mutable Vector<double> residual, coarse_rhs, coarse_solution;
+  };
+
+  /**
+   * Run a V-cycle on the given level.
+   */
+  void
+  v_cycle(const unsigned int    level,
+          Vector<double>       &solution,
+          const Vector<double> &rhs) const;
+
+  /**
+   * Apply the smoother on the given level, starting from a zero vector
+   * if @p zero_initial_guess is set.
+   */
+  void
+  smooth(const unsigned int    level,
+         Vector<double>       &solution,
+         const Vector<double> &rhs,
+         const bool            zero_initial_guess) const;
+
+  /**
+   * The parameters of the preconditioner.
+   */
+  AdditionalData additional_data;
+
+  /**
+   * The levels of the hierarchy. They are held by pointers because the
+   * matrices reference the sparsity patterns in the same object.
+   */
+  std::vector<std::unique_ptr<Level>> levels;
+
+  /**
+   * The inverse of the matrix on the coarsest level, computed with
+   * FullMatrix::gauss_jordan().
+   */
+  FullMatrix<double> coarse_inverse;
+};
+
+/** @} */
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,318 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sliced_ellpack_matrix_h
+#define dealii_sliced_ellpack_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/types.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/exceptions.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declarations
+#ifndef DOXYGEN
+template <typename number>
+class Vector;
+template <typename number>
+class SparseMatrix;
+#endif
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A sparse matrix stored in the sliced ELLPACK format with sorting scope
+ * (also known as SELL-C-$\sigma$, see M. Kreutzer, G. Hager, G. Wellein,
+ * H. Fehske, A. R. Bishop: A unified sparse matrix data format for efficient
+ * general sparse matrix-vector multiplication on modern processors with wide
+ * SIMD units, SIAM J. Sci. Comput. 36(5):C401-C423, 2014).
+ *
+ * The compressed row storage used by SparseMatrix processes the entries of
+ * one row after the other. For the short rows typical of finite element
+ * matrices, this makes poor use of the SIMD units of modern processors. This
+ * class instead groups the rows of the matrix into chunks of
+ * <tt>C = VectorizedArray<number>::size()</tt> rows and stores the entries of
+ * each chunk in column-major order, i.e., the $j$th entries of all rows of
+ * the chunk are stored next to each other. Rows that are shorter than the
+ * longest row of their chunk are padded with zeros. The matrix-vector
+ * product then computes the results of all rows in a chunk at once with
+ * VectorizedArray, using gather instructions to load the entries of the
+ * source vector.
+ *
+ * In order to reduce the amount of padding, the rows within windows of
+ * @p sorting_scope consecutive rows are sorted by decreasing length before
+ * they are grouped into chunks. Since finite element matrices typically have
+ * rows of similar length, a moderate scope is usually sufficient. A scope of
+ * one retains the original ordering of the rows.
+ *
+ * This class is a read-only copy of a SparseMatrix, set up by the
+ * constructor or the reinit() function, and intended for applications that
+ * perform many matrix-vector products with the same matrix, e.g., in
+ * iterative solvers. It satisfies the requirements of a matrix for the
+ * solver classes, but does not provide access to individual entries. The
+ * matrix-vector products are parallelized by threads over the chunks of
+ * rows. Since the gather instructions use 32-bit offsets, the number of
+ * columns is limited to $2^{32}-1$.
+ */
+template <typename number>
+class SlicedEllpackMatrix : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the matrix entries.
+   */
+  using value_type = number;
+
+  /**
+   * The number of rows grouped into one chunk, given by the number of lanes
+   * of VectorizedArray.
+   */
+  static constexpr unsigned int chunk_size = VectorizedArray<number>::size();
+
+  /**
+   * Constructor. Initializes an empty matrix of dimension zero times zero.
+   */
+  SlicedEllpackMatrix();
+
+  /**
+   * Constructor. Copies the entries of @p matrix, see reinit().
+   */
+  template <typename somenumber>
+  explicit SlicedEllpackMatrix(const SparseMatrix<somenumber> &matrix,
+                               const unsigned int sorting_scope = 256);
+
+  /**
+   * Copy the entries of @p matrix into the sliced ELLPACK format. The rows
+   * are sorted by length within windows of @p sorting_scope rows before they
+   * are grouped into chunks of #chunk_size rows. Entries stored in the
+   * sparsity pattern of @p matrix are kept even if they are zero.
+   */
+  template <typename somenumber>
+  void
+  reinit(const SparseMatrix<somenumber> &matrix,
+         const unsigned int              sorting_scope = 256);
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of rows of the matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of entries of the matrix copied from the original
+   * matrix, excluding the entries added for padding.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the number of stored entries including the padding. The ratio of
+   * n_nonzero_elements() and this number measures the efficiency of the
+   * storage format.
+   */
+  std::size_t
+  n_stored_elements() const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+   * matrix.
+   *
+   * Source and destination must not be the same vector.
+   */
+  void
+  vmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M^T*src$ with $M$ being this
+   * matrix. This function does the same as vmult() but takes the transposed
+   * matrix. Since the columns of the transposed product are scattered, this
+   * function runs on a single thread.
+   *
+   * Source and destination must not be the same vector.
+   */
+  void
+  Tvmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Adding matrix-vector multiplication. Add $M*src$ on $dst$ with $M$ being
+   * this matrix.
+   *
+   * Source and destination must not be the same vector.
+   */
+  void
+  vmult_add(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Adding matrix-vector multiplication. Add $M^T*src$ to $dst$ with $M$
+   * being this matrix. This function does the same as vmult_add() but takes
+   * the transposed matrix.
+   *
+   * Source and destination must not be the same vector.
+   */
+  void
+  Tvmult_add(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * @addtogroup Exceptions
+   * @{
+   */
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcSourceEqualsDestination,
+                   "You are attempting an operation on two vectors that "
+                   "are the same object, but the operation requires that the "
+                   "two objects are in fact different.");
+  /** @} */
+
+private:
+  /**
+   * Compute the product of the chunks in the range <tt>[begin, end)</tt>
+   * with @p src, and write the result into @p dst or add it to @p dst.
+   */
+  void
+  vmult_on_subrange(const unsigned int    begin,
+                    const unsigned int    end,
+                    Vector<number>       &dst,
+                    const Vector<number> &src,
+                    const bool            add) const;
+
+  /**
+   * Number of rows of the matrix.
+   */
+  size_type n_rows;
+
+  /**
+   * Number of columns of the matrix.
+   */
+  size_type n_cols;
+
+  /**
+   * Number of entries copied from the original matrix.
+   */
+  std::size_t n_nonzeros;
+
+  /**
+   * The start of the entries of each chunk in #values, with one additional
+   * entry at the end. The number of entries in a chunk, i.e., the difference
+   * between two subsequent entries of this array, is the length of the
+   * longest row of the chunk.
+   */
+  std::vector<std::size_t> chunk_start;
+
+  /**
+   * The entries of the matrix, with the $j$th entries of the rows of a chunk
+   * combined in one VectorizedArray.
+   */
+  AlignedVector<VectorizedArray<number>> values;
+
+  /**
+   * The column indices of the entries in #values, with #chunk_size indices
+   * for each entry of #values. Padded entries refer to a valid column of the
+   * same row (or column zero for empty rows) to keep the gather operations
+   * within the bounds of the source vector.
+   */
+  std::vector<unsigned int> column_indices;
+
+  /**
+   * The row of the original matrix for each lane of each chunk. The lanes of
+   * the last chunk that do not correspond to a row of the matrix are set to
+   * numbers::invalid_unsigned_int.
+   */
+  std::vector<unsigned int> row_indices;
+};
+
+/** @} */
+
+/*---------------------- Inline functions -----------------------------------*/
+
+#ifndef DOXYGEN
+
+template <typename number>
+inline typename SlicedEllpackMatrix<number>::size_type
+SlicedEllpackMatrix<number>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename number>
+inline typename SlicedEllpackMatrix<number>::size_type
+SlicedEllpackMatrix<number>::n() const
+{
+  return n_cols;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SlicedEllpackMatrix<number>::n_nonzero_elements() const
+{
+  return n_nonzeros;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SlicedEllpackMatrix<number>::n_stored_elements() const
+{
+  return values.size() * chunk_size;
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
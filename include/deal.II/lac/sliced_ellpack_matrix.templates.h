@@ -0,0 +1,288 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sliced_ellpack_matrix_templates_h
+#define dealii_sliced_ellpack_matrix_templates_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/sliced_ellpack_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <algorithm>
+#include <numeric>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <typename number>
+SlicedEllpackMatrix<number>::SlicedEllpackMatrix()
+  : n_rows(0)
+  , n_cols(0)
+  , n_nonzeros(0)
+{}
+
+
+
+template <typename number>
+template <typename somenumber>
+SlicedEllpackMatrix<number>::SlicedEllpackMatrix(
+  const SparseMatrix<somenumber> &matrix,
+  const unsigned int              sorting_scope)
+  : SlicedEllpackMatrix()
+{
+  reinit(matrix, sorting_scope);
+}
+
+
+
+template <typename number>
+void
+SlicedEllpackMatrix<number>::clear()
+{
+  n_rows     = 0;
+  n_cols     = 0;
+  n_nonzeros = 0;
+  chunk_start.clear();
+  values.clear();
+  column_indices.clear();
+  row_indices.clear();
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SlicedEllpackMatrix<number>::reinit(const SparseMatrix<somenumber> &matrix,
+                                    const unsigned int sorting_scope)
+{
+  Assert(sorting_scope > 0, ExcMessage("The sorting scope must be positive."));
+  AssertThrow(matrix.m() < numbers::invalid_unsigned_int &&
+                matrix.n() < numbers::invalid_unsigned_int,
+              ExcMessage("SlicedEllpackMatrix uses 32-bit indices and "
+                         "cannot represent matrices of this size."));
+
+  clear();
+  n_rows     = matrix.m();
+  n_cols     = matrix.n();
+  n_nonzeros = matrix.n_nonzero_elements();
+
+  const SparsityPattern &sparsity = matrix.get_sparsity_pattern();
+
+  // sort the rows by decreasing length within each window of the sorting
+  // scope. use a stable sort to keep the original ordering among rows of
+  // the same length, which retains the locality of the access to the
+  // destination vector
+  std::vector<unsigned int> sorted_rows(n_rows);
+  std::iota(sorted_rows.begin(), sorted_rows.end(), 0U);
+  for (size_type start = 0; start < n_rows; start += sorting_scope)
+    std::stable_sort(sorted_rows.begin() + start,
+                     sorted_rows.begin() +
+                       std::min<size_type>(start + sorting_scope, n_rows),
+                     [&sparsity](const unsigned int a, const unsigned int b) {
+                       return sparsity.row_length(a) > sparsity.row_length(b);
+                     });
+
+  const unsigned int n_chunks = (n_rows + chunk_size - 1) / chunk_size;
+  row_indices.resize(n_chunks * chunk_size, numbers::invalid_unsigned_int);
+  std::copy(sorted_rows.begin(), sorted_rows.end(), row_indices.begin());
+
+  // the width of each chunk is given by its longest row
+  chunk_start.resize(n_chunks + 1);
+  chunk_start[0] = 0;
+  for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+    {
+      unsigned int width = 0;
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        if (row_indices[chunk * chunk_size + v] != numbers::invalid_unsigned_int)
+          width = std::max<unsigned int>(
+            width, sparsity.row_length(row_indices[chunk * chunk_size + v]));
+      chunk_start[chunk + 1] = chunk_start[chunk] + width;
+    }
+
+  values.resize(chunk_start.back(), VectorizedArray<number>(number()));
+  column_indices.resize(chunk_start.back() * chunk_size, 0U);
+  for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+    for (unsigned int v = 0; v < chunk_size; ++v)
+      {
+        const unsigned int row = row_indices[chunk * chunk_size + v];
+        if (row == numbers::invalid_unsigned_int)
+          continue;
+
+        std::size_t  index  = chunk_start[chunk];
+        unsigned int column = 0;
+        for (auto entry = matrix.begin(row); entry != matrix.end(row);
+             ++entry, ++index)
+          {
+            column = entry->column();
+            values[index][v]                        = entry->value();
+            column_indices[index * chunk_size + v] = column;
+          }
+
+        // padded entries are zero already, let them point to the last column
+        // of the row which is likely in cache anyway
+        for (; index < chunk_start[chunk + 1]; ++index)
+          column_indices[index * chunk_size + v] = column;
+      }
+}
+
+
+
+template <typename number>
+void
+SlicedEllpackMatrix<number>::vmult_on_subrange(const unsigned int    begin,
+                                               const unsigned int    end,
+                                               Vector<number>       &dst,
+                                               const Vector<number> &src,
+                                               const bool add) const
+{
+  const number *src_ptr = src.begin();
+  for (unsigned int chunk = begin; chunk < end; ++chunk)
+    {
+      VectorizedArray<number> sum = number();
+      for (std::size_t index = chunk_start[chunk];
+           index < chunk_start[chunk + 1];
+           ++index)
+        {
+          VectorizedArray<number> src_values;
+          src_values.gather(src_ptr, &column_indices[index * chunk_size]);
+          sum += values[index] * src_values;
+        }
+
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        {
+          const unsigned int row = row_indices[chunk * chunk_size + v];
+          if (row == numbers::invalid_unsigned_int)
+            break;
+          if (add)
+            dst(row) += sum[v];
+          else
+            dst(row) = sum[v];
+        }
+    }
+}
+
+
+
+template <typename number>
+void
+SlicedEllpackMatrix<number>::vmult(Vector<number>       &dst,
+                                   const Vector<number> &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(chunk_start.size() - 1),
+    [this, &dst, &src](const unsigned int begin, const unsigned int end) {
+      vmult_on_subrange(begin, end, dst, src, false);
+    },
+    std::max(1U,
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+               chunk_size));
+}
+
+
+
+template <typename number>
+void
+SlicedEllpackMatrix<number>::vmult_add(Vector<number>       &dst,
+                                       const Vector<number> &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(chunk_start.size() - 1),
+    [this, &dst, &src](const unsigned int begin, const unsigned int end) {
+      vmult_on_subrange(begin, end, dst, src, true);
+    },
+    std::max(1U,
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+               chunk_size));
+}
+
+
+
+template <typename number>
+void
+SlicedEllpackMatrix<number>::Tvmult(Vector<number>       &dst,
+                                    const Vector<number> &src) const
+{
+  dst = number();
+  Tvmult_add(dst, src);
+}
+
+
+
+template <typename number>
+void
+SlicedEllpackMatrix<number>::Tvmult_add(Vector<number>       &dst,
+                                        const Vector<number> &src) const
+{
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  for (unsigned int chunk = 0; chunk + 1 < chunk_start.size(); ++chunk)
+    {
+      VectorizedArray<number> src_values = number();
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        {
+          const unsigned int row = row_indices[chunk * chunk_size + v];
+          if (row == numbers::invalid_unsigned_int)
+            break;
+          src_values[v] = src(row);
+        }
+
+      // padded entries add zero to some column of the same row, so there is
+      // no need to skip them
+      for (std::size_t index = chunk_start[chunk];
+           index < chunk_start[chunk + 1];
+           ++index)
+        {
+          const VectorizedArray<number> products = values[index] * src_values;
+          for (unsigned int v = 0; v < chunk_size; ++v)
+            dst(column_indices[index * chunk_size + v]) += products[v];
+        }
+    }
+}
+
+
+
+template <typename number>
+std::size_t
+SlicedEllpackMatrix<number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(chunk_start) +
+         MemoryConsumption::memory_consumption(values) +
+         MemoryConsumption::memory_consumption(column_indices) +
+         MemoryConsumption::memory_consumption(row_indices);
+}
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -25,6 +25,7 @@
 
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector_operations_internal.h>
 
 #include <cmath>
 #include <limits>
@@ -327,11 +328,29 @@ typename SolverBicgstab<VectorType>::IterationResult
   value_type rho   = 1.;
   value_type omega = 1.;
 
+  // For vectors that support it, several vector updates and inner products
+  // are merged into a single pass through the vectors, see
+  // internal::VectorOperations::fused_update_and_reduce(). The inner product
+  // r^T rbar of the next iteration is then computed along the update of the
+  // residual in the current iteration.
+  constexpr bool use_fused_operations =
+    internal::VectorOperations::supports_fused_operations<VectorType>;
+  std::shared_ptr<parallel::internal::TBBPartitioner> thread_loop_partitioner;
+  if (use_fused_operations)
+    thread_loop_partitioner =
+      std::make_shared<parallel::internal::TBBPartitioner>();
+  value_type next_rhobar = value_type();
+
   do
     {
       ++step;
 
-      const value_type rhobar = (step == 1 + last_step) ? res * res : r * rbar;
+      const value_type rhobar =
+        (step == 1 + last_step) ?
+          res * res :
+          ((use_fused_operations && !additional_data.exact_residual) ?
+             next_rhobar :
+             r * rbar);
 
       if (std::fabs(rhobar) < additional_data.breakdown)
         {
@@ -344,6 +363,26 @@ typename SolverBicgstab<VectorType>::IterationResult
         {
           p = r;
         }
+      else if constexpr (use_fused_operations)
+        {
+          // p = beta * (p - omega * v) + r
+          value_type *const p_ptr   = p.begin();
+          const value_type *r_ptr   = r.begin();
+          const value_type *v_ptr   = v.begin();
+          const value_type  omega_i = omega;
+          internal::VectorOperations::fused_update_and_reduce_global<0>(
+            thread_loop_partitioner, p, [&](const auto i, auto &sums) {
+              using T = std::decay_t<decltype(sums[0])>;
+              using internal::VectorOperations::fused_load;
+              using internal::VectorOperations::fused_store;
+              fused_store(beta * (fused_load<T>(p_ptr + i) -
+                                  omega_i * fused_load<T>(v_ptr + i)) +
+                            fused_load<T>(r_ptr + i),
+                          p_ptr + i);
+            });
+          internal::VectorOperations::update_ghost_values_after_fused_operation(
+            p);
+        }
       else
         {
           p.sadd(beta, 1., r);
@@ -377,22 +416,80 @@ typename SolverBicgstab<VectorType>::IterationResult
 
       preconditioner.vmult(z, r);
       A.vmult(t, z);
-      const value_type t_dot_r   = t * r;
-      const real_type  t_squared = t * t;
+      value_type t_dot_r;
+      real_type  t_squared;
+      if constexpr (use_fused_operations)
+        {
+          const value_type *t_ptr = t.begin();
+          const value_type *r_ptr = r.begin();
+          const std::array<value_type, 2> sums = internal::VectorOperations::
+            fused_update_and_reduce_global<2>(
+              thread_loop_partitioner, t, [&](const auto i, auto &sums) {
+                using T = std::decay_t<decltype(sums[0])>;
+                using internal::VectorOperations::fused_load;
+                const T ti = fused_load<T>(t_ptr + i);
+                sums[0] += ti * fused_load<T>(r_ptr + i);
+                sums[1] += ti * ti;
+              });
+          t_dot_r   = sums[0];
+          t_squared = sums[1];
+        }
+      else
+        {
+          t_dot_r   = t * r;
+          t_squared = t * t;
+        }
       if (t_squared < additional_data.breakdown)
         {
           return IterationResult(true, state, step, res);
         }
       omega = t_dot_r / t_squared;
-      x.add(alpha, y, omega, z);
 
       if (additional_data.exact_residual)
         {
+          x.add(alpha, y, omega, z);
           r.add(-omega, t);
           res = criterion(A, x, b, t);
         }
+      else if constexpr (use_fused_operations)
+        {
+          // x += alpha * y + omega * z and r -= omega * t, computing the norm
+          // of the new residual and its inner product with rbar for the next
+          // iteration
+          value_type *const x_ptr    = x.begin();
+          value_type *const r_ptr    = r.begin();
+          const value_type *y_ptr    = y.begin();
+          const value_type *z_ptr    = z.begin();
+          const value_type *t_ptr    = t.begin();
+          const value_type *rbar_ptr = rbar.begin();
+          const value_type  alpha_i  = alpha;
+          const value_type  omega_i  = omega;
+          const std::array<value_type, 2> sums = internal::VectorOperations::
+            fused_update_and_reduce_global<2>(
+              thread_loop_partitioner, x, [&](const auto i, auto &sums) {
+                using T = std::decay_t<decltype(sums[0])>;
+                using internal::VectorOperations::fused_load;
+                using internal::VectorOperations::fused_store;
+                fused_store(fused_load<T>(x_ptr + i) +
+                              alpha_i * fused_load<T>(y_ptr + i) +
+                              omega_i * fused_load<T>(z_ptr + i),
+                            x_ptr + i);
+                const T ri = fused_load<T>(r_ptr + i) -
+                             omega_i * fused_load<T>(t_ptr + i);
+                fused_store(ri, r_ptr + i);
+                sums[0] += ri * ri;
+                sums[1] += ri * fused_load<T>(rbar_ptr + i);
+              });
+          internal::VectorOperations::update_ghost_values_after_fused_operation(
+            x, r);
+          res         = std::sqrt(real_type(sums[0]));
+          next_rhobar = sums[1];
+        }
       else
-        res = std::sqrt(real_type(r.add_and_dot(-omega, t, r)));
+        {
+          x.add(alpha, y, omega, z);
+          res = std::sqrt(real_type(r.add_and_dot(-omega, t, r)));
+        }
 
       state = this->iteration_status(step, res, x);
       print_vectors(step, x, r, y);
@@ -0,0 +1,384 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_block_cg_h
+#define dealii_solver_block_cg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * This class implements the preconditioned conjugate gradient method for
+ * several right hand sides at once. The right hand sides and solutions are
+ * given as block vectors (for example BlockVector or
+ * LinearAlgebra::distributed::BlockVector), where each block holds the
+ * vector for one right hand side. The solver performs an independent CG
+ * iteration for each block, but combines the work of all of them in each
+ * step:
+ * <ul>
+ * <li> The matrix and the preconditioner are applied to all blocks together.
+ * If the class `MatrixType` (or `PreconditionerType`) provides a function
+ * @code
+ * void MatrixType::multi_vmult(BlockVectorType &dst,
+ *                              const BlockVectorType &src) const;
+ * @endcode
+ * that multiplies each block of `src` and writes the result into the
+ * respective block of `dst`, this function is used; this is the case for
+ * SparseMatrix::multi_vmult(), which reads the matrix only once for all
+ * right hand sides. For a matrix-free operator, such a function can be
+ * implemented by a single MatrixFree::cell_loop() over the block vectors
+ * that evaluates the operator for all blocks on a cell at once, sharing the
+ * loop overhead, the access to the geometry data, and the communication of
+ * ghost values. Otherwise, `vmult()` is called with the individual blocks.
+ * </li>
+ * <li> The algorithm uses the variant of the conjugate gradient method by
+ * Chronopoulos and Gear (Algorithm 2.2 of @cite Chronopoulos1989), which
+ * computes all inner products of an iteration at the same point. The inner
+ * products of all blocks are hence combined into a single global reduction
+ * per iteration, rather than two reductions per iteration and right hand
+ * side for SolverCG. </li>
+ * </ul>
+ *
+ * Since each right hand side has its own CG coefficients, the iterates are
+ * (up to roundoff) the same as those of SolverCG applied to the blocks
+ * separately. The iteration stops once the largest residual norm among all
+ * blocks satisfies the criterion of the given SolverControl object. Blocks
+ * whose residual becomes exactly zero are not updated any more.
+ *
+ * The solver requires real-valued vectors. As for SolverCG, the matrix and
+ * the preconditioner must be symmetric and positive definite.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence, where the value passed to the
+ * SolverControl object is the largest residual norm among all blocks.
+ */
+template <typename BlockVectorType = BlockVector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+class SolverBlockCG : public SolverBase<BlockVectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver. This
+   * solver does not take additional data at the moment.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverBlockCG(SolverControl                 &cn,
+                VectorMemory<BlockVectorType> &mem,
+                const AdditionalData          &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverBlockCG(SolverControl        &cn,
+                const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear systems $Ax_i=b_i$ for all blocks $i$ of @p x and @p b.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  void
+  solve(const MatrixType         &A,
+        BlockVectorType          &x,
+        const BlockVectorType    &b,
+        const PreconditionerType &preconditioner);
+
+  /**
+   * Return the residual norms of the individual blocks at the end of the
+   * last call to solve().
+   */
+  const std::vector<double> &
+  get_residual_norms() const;
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+
+  /**
+   * The residual norms of the individual blocks.
+   */
+  std::vector<double> residual_norms;
+};
+
+/** @} */
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverBlockCG
+  {
+    template <typename MatrixType, typename BlockVectorType>
+    using multi_vmult_t = decltype(std::declval<const MatrixType &>()
+                                     .multi_vmult(
+                                       std::declval<BlockVectorType &>(),
+                                       std::declval<const BlockVectorType &>()));
+
+    template <typename MatrixType, typename BlockVectorType>
+    constexpr bool has_multi_vmult =
+      is_supported_operation<multi_vmult_t, MatrixType, BlockVectorType>;
+
+    template <typename BlockVectorType>
+    using get_mpi_communicator_t =
+      decltype(std::declval<const BlockVectorType &>().get_mpi_communicator());
+
+    template <typename BlockVectorType>
+    constexpr bool has_get_mpi_communicator =
+      is_supported_operation<get_mpi_communicator_t, BlockVectorType>;
+
+
+
+    /**
+     * Apply the operator @p op to all blocks of @p src, using multi_vmult()
+     * if the operator provides it.
+     */
+    template <typename OperatorType, typename BlockVectorType>
+    void
+    apply_to_all_blocks(const OperatorType    &op,
+                        BlockVectorType       &dst,
+                        const BlockVectorType &src)
+    {
+      if constexpr (has_multi_vmult<OperatorType, BlockVectorType>)
+        op.multi_vmult(dst, src);
+      else
+        for (unsigned int i = 0; i < src.n_blocks(); ++i)
+          op.vmult(dst.block(i), src.block(i));
+    }
+
+
+
+    /**
+     * Compute the inner products <tt>(r_i,u_i)</tt>, <tt>(w_i,u_i)</tt> and
+     * <tt>(r_i,r_i)</tt> of all blocks <tt>i</tt> with a single global
+     * reduction. The results are stored in @p products with three entries
+     * per block.
+     */
+    template <typename BlockVectorType>
+    void
+    compute_inner_products(const BlockVectorType &r,
+                           const BlockVectorType &u,
+                           const BlockVectorType &w,
+                           std::vector<double>   &products)
+    {
+      const unsigned int n_blocks = r.n_blocks();
+      products.resize(3 * n_blocks);
+      for (unsigned int i = 0; i < n_blocks; ++i)
+        {
+          double     r_u = 0, w_u = 0, r_r = 0;
+          const auto r_ptr = r.block(i).begin();
+          const auto u_ptr = u.block(i).begin();
+          const auto w_ptr = w.block(i).begin();
+
+          // the iterators of the blocks go through the locally owned entries
+          const std::size_t local_size = r.block(i).end() - r_ptr;
+          for (std::size_t j = 0; j < local_size; ++j)
+            {
+              r_u += r_ptr[j] * u_ptr[j];
+              w_u += w_ptr[j] * u_ptr[j];
+              r_r += r_ptr[j] * r_ptr[j];
+            }
+          products[3 * i]     = r_u;
+          products[3 * i + 1] = w_u;
+          products[3 * i + 2] = r_r;
+        }
+
+      if constexpr (has_get_mpi_communicator<BlockVectorType>)
+        Utilities::MPI::sum(ArrayView<const double>(products),
+                            r.get_mpi_communicator(),
+                            ArrayView<double>(products));
+    }
+  } // namespace SolverBlockCG
+} // namespace internal
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+SolverBlockCG<BlockVectorType>::SolverBlockCG(
+  SolverControl                 &cn,
+  VectorMemory<BlockVectorType> &mem,
+  const AdditionalData          &data)
+  : SolverBase<BlockVectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+SolverBlockCG<BlockVectorType>::SolverBlockCG(SolverControl        &cn,
+                                              const AdditionalData &data)
+  : SolverBase<BlockVectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+const std::vector<double> &SolverBlockCG<
+  BlockVectorType>::get_residual_norms() const
+{
+  return residual_norms;
+}
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+template <typename MatrixType, typename PreconditionerType>
+void SolverBlockCG<BlockVectorType>::solve(
+  const MatrixType         &A,
+  BlockVectorType          &x,
+  const BlockVectorType    &b,
+  const PreconditionerType &preconditioner)
+{
+  static_assert(!numbers::NumberTraits<
+                  typename BlockVectorType::value_type>::is_complex,
+                "SolverBlockCG is only implemented for real numbers.");
+  AssertDimension(x.n_blocks(), b.n_blocks());
+
+  using internal::SolverBlockCG::apply_to_all_blocks;
+  using internal::SolverBlockCG::compute_inner_products;
+
+  LogStream::Prefix prefix("block_cg");
+
+  const unsigned int n_blocks = b.n_blocks();
+
+  // r: residual, u: preconditioned residual, w: A*u, p: search direction,
+  // s: A*p
+  typename VectorMemory<BlockVectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer u_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer w_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer s_pointer(this->memory);
+
+  BlockVectorType &r = *r_pointer;
+  BlockVectorType &u = *u_pointer;
+  BlockVectorType &w = *w_pointer;
+  BlockVectorType &p = *p_pointer;
+  BlockVectorType &s = *s_pointer;
+  r.reinit(x, true);
+  u.reinit(x, true);
+  w.reinit(x, true);
+  p.reinit(x);
+  s.reinit(x);
+
+  apply_to_all_blocks(A, r, x);
+  r.sadd(-1., 1., b);
+  apply_to_all_blocks(preconditioner, u, r);
+  apply_to_all_blocks(A, w, u);
+
+  std::vector<double> products;
+  compute_inner_products(r, u, w, products);
+
+  // the CG coefficients of each block. gamma holds (r,u) of the previous
+  // iteration
+  std::vector<double> alpha(n_blocks), beta(n_blocks), gamma(n_blocks);
+
+  residual_norms.resize(n_blocks);
+  const auto update_coefficients_and_norms = [&](const bool first_iteration) {
+    for (unsigned int i = 0; i < n_blocks; ++i)
+      {
+        const double gamma_new = products[3 * i];
+        const double delta     = products[3 * i + 1];
+        residual_norms[i]      = std::sqrt(products[3 * i + 2]);
+
+        // stop updating blocks that are solved exactly to avoid divisions by
+        // zero
+        if (gamma_new == 0.)
+          {
+            alpha[i] = beta[i] = 0.;
+            continue;
+          }
+
+        beta[i] = first_iteration ? 0. : gamma_new / gamma[i];
+        const double denominator =
+          first_iteration ? delta : delta - beta[i] * gamma_new / alpha[i];
+        Assert(denominator != 0., ExcDivideByZero());
+        alpha[i] = gamma_new / denominator;
+        gamma[i] = gamma_new;
+      }
+    return *std::max_element(residual_norms.begin(), residual_norms.end());
+  };
+
+  unsigned int         it = 0;
+  double               max_residual_norm =
+    n_blocks > 0 ? update_coefficients_and_norms(true) : 0.;
+  SolverControl::State solver_state =
+    this->iteration_status(it, max_residual_norm, x);
+
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      for (unsigned int i = 0; i < n_blocks; ++i)
+        {
+          p.block(i).sadd(beta[i], 1., u.block(i));
+          s.block(i).sadd(beta[i], 1., w.block(i));
+          x.block(i).add(alpha[i], p.block(i));
+          r.block(i).add(-alpha[i], s.block(i));
+        }
+
+      apply_to_all_blocks(preconditioner, u, r);
+      apply_to_all_blocks(A, w, u);
+      compute_inner_products(r, u, w, products);
+
+      max_residual_norm = update_coefficients_and_norms(false);
+      solver_state      = this->iteration_status(it, max_residual_norm, x);
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, max_residual_norm));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
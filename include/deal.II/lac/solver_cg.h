@@ -27,6 +27,7 @@
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/tridiagonal_matrix.h>
+#include <deal.II/lac/vector_operations_internal.h>
 
 #include <boost/signals2.hpp>
 
@@ -670,6 +671,12 @@ namespace internal
         IterationWorkerBase<VectorType, MatrixType, PreconditionerType>;
 
 
+      // Thread partitioner for the fused vector updates and the inner product
+      // r^T z of the flexible variant computed along them
+      std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
+                                        thread_loop_partitioner;
+      typename VectorType::value_type r_dot_z;
+
       IterationWorker(const MatrixType         &A,
                       const PreconditionerType &preconditioner,
                       const bool                flexible,
@@ -684,7 +691,13 @@ namespace internal
                     x,
                     b,
                     use_default_residual)
-      {}
+        , r_dot_z(0.)
+      {
+        if constexpr (internal::VectorOperations::supports_fused_operations<
+                        VectorType>)
+          thread_loop_partitioner =
+            std::make_shared<::dealii::parallel::internal::TBBPartitioner>();
+      }
 
       using BaseClass::A;
       using BaseClass::alpha;
@@ -727,7 +740,15 @@ namespace internal
             beta =
               r_dot_preconditioner_dot_r / previous_r_dot_preconditioner_dot_r;
             if (this->flexible)
-              beta -= (r * z) / previous_r_dot_preconditioner_dot_r;
+              {
+                // with fused operations, r^T z was computed along the update
+                // of the residual in the previous iteration
+                if (!internal::VectorOperations::supports_fused_operations<
+                      VectorType> ||
+                    !use_default_residual)
+                  r_dot_z = r * z;
+                beta -= r_dot_z / previous_r_dot_preconditioner_dot_r;
+              }
             p.sadd(beta, 1., direction);
           }
         else
@@ -744,17 +765,29 @@ namespace internal
         this->previous_alpha = alpha;
         alpha                = r_dot_preconditioner_dot_r / p_dot_A_dot_p;
 
-        x.add(alpha, p);
-
         // compute the residual norm with implicit residual
         if (use_default_residual)
           {
-            residual_norm = std::sqrt(std::abs(r.add_and_dot(-alpha, v, r)));
+            if constexpr (internal::VectorOperations::supports_fused_operations<
+                            VectorType>)
+              {
+                if (this->flexible)
+                  fused_update<2>();
+                else
+                  fused_update<1>();
+              }
+            else
+              {
+                x.add(alpha, p);
+                residual_norm =
+                  std::sqrt(std::abs(r.add_and_dot(-alpha, v, r)));
+              }
           }
         // compute the residual norm with the explicit residual, i.e.
         // compute l2 norm of Ax - b.
         else
           {
+            x.add(alpha, p);
             // compute the residual conjugate gradient update
             r.add(-alpha, v);
             // compute explicit residual
@@ -764,6 +797,46 @@ namespace internal
           }
       }
 
+      // Update the solution and the residual in a single pass through the
+      // vectors, computing the residual norm and, for the flexible variant,
+      // the inner product of the new residual with the previous
+      // preconditioned residual needed in the next iteration
+      template <std::size_t n_results>
+      void
+      fused_update()
+      {
+        using Number          = typename VectorType::value_type;
+        Number *const x_ptr   = x.begin();
+        Number *const r_ptr   = r.begin();
+        const Number *p_ptr   = p.begin();
+        const Number *v_ptr   = v.begin();
+        const Number *z_ptr   = z.begin();
+        const Number  alpha_i = alpha;
+
+        const auto sums = internal::VectorOperations::
+          fused_update_and_reduce_global<n_results>(
+            thread_loop_partitioner, x, [&](const auto i, auto &sums) {
+              using T = std::decay_t<decltype(sums[0])>;
+              using internal::VectorOperations::fused_load;
+              using internal::VectorOperations::fused_store;
+              fused_store(fused_load<T>(x_ptr + i) +
+                            alpha_i * fused_load<T>(p_ptr + i),
+                          x_ptr + i);
+              const T ri =
+                fused_load<T>(r_ptr + i) - alpha_i * fused_load<T>(v_ptr + i);
+              fused_store(ri, r_ptr + i);
+              sums[0] += ri * ri;
+              if constexpr (n_results == 2)
+                sums[1] += ri * fused_load<T>(z_ptr + i);
+            });
+        internal::VectorOperations::update_ghost_values_after_fused_operation(
+          x, r);
+
+        residual_norm = std::sqrt(std::abs(sums[0]));
+        if constexpr (n_results == 2)
+          r_dot_z = sums[1];
+      }
+
       void
       finalize_after_convergence(const unsigned int)
       {}
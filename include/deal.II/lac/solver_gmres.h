@@ -180,6 +180,56 @@ namespace internal
         const boost::signals2::signal<void(int)> &reorthogonalize_signal =
           boost::signals2::signal<void(int)>());
 
+      /**
+       * Orthonormalize the @p s vectors at the positions <tt>n + 1, ...,
+       * n + s</tt> within the array @p orthogonal_vectors against the
+       * orthonormal vectors with indices <tt>0, ..., n</tt> and among each
+       * other, using the block classical Gram-Schmidt algorithm with
+       * reorthogonalization (two passes). Each pass computes the projections
+       * onto the previous vectors and the Gram matrix of the block in a
+       * single global reduction, followed by a Cholesky factorization of the
+       * projected Gram matrix. This function is used by the s-step variant of
+       * GMRES, see
+       * LinearAlgebra::OrthogonalizationStrategy::s_step_block_classical_gram_schmidt.
+       *
+       * The vectors of the block are expected to be generated from the vector
+       * with index @p n by the recurrence $\mathrm{OP}\, w_j = \sigma_j
+       * w_{j+1} + \theta_j w_j + \tau_j w_{j-1}$ with $w_0$ the vector at
+       * position @p n, where the shifts $\theta_j$ are given in the
+       * diagonal, the scaling factors $\sigma_j$ in the subdiagonal, and the
+       * coefficients $\tau_j$ in the superdiagonal of the $(s+1) \times s$
+       * matrix @p change_of_basis. The latter are nonzero for the second step
+       * of a pair of complex-conjugate shifts applied in real arithmetic.
+       * From this information and the factors of the
+       * block orthogonalization, the columns <tt>n, ..., n + s - 1</tt> of
+       * the Hessenberg matrix of the Arnoldi process are computed. The
+       * factorization of these columns by Givens rotations is not performed
+       * by this function, but needs to be requested column by column via
+       * transform_hessenberg_column().
+       *
+       * The function returns `false` if the Cholesky factorization detects
+       * that the block is numerically rank deficient, in which case neither
+       * the vectors with indices <tt>0, ..., n</tt> nor the Hessenberg matrix
+       * are modified, and the caller needs to fall back to the step-by-step
+       * orthogonalization via orthonormalize_nth_vector().
+       */
+      template <typename VectorType>
+      bool
+      orthonormalize_block(const unsigned int        n,
+                           const unsigned int        s,
+                           const FullMatrix<double> &change_of_basis,
+                           TmpVectors<VectorType>   &orthogonal_vectors);
+
+      /**
+       * Transform the column @p col of the Hessenberg matrix computed by
+       * orthonormalize_block() into upper triangular form by a Givens
+       * rotation and return the resulting estimate of the residual. The
+       * function must be called for successive columns, starting with the
+       * first column of the block.
+       */
+      double
+      transform_hessenberg_column(const unsigned int col);
+
       /**
        * Using the matrix and right hand side computed during the
        * factorization, solve the underlying minimization problem for the
@@ -237,13 +287,22 @@ namespace internal
        */
       Vector<double> h;
 
+      /**
+       * Auxiliary vector holding the projection coefficients of the first
+       * pass of the classical Gram-Schmidt algorithm while the second pass
+       * reorthogonalizes.
+       */
+      Vector<double> h_first_pass;
+
       /**
        * Flag to keep track reorthogonalization, which is checked every fifth
        * iteration by default for
        * LinearAlgebra::OrthogonalizationStrategy::classical_gram_schmidt and
        * LinearAlgebra::OrthogonalizationStrategy::modified_gram_schmidt; for
        * LinearAlgebra::OrthogonalizationStrategy::delayed_classical_gram_schmidt,
-       * no check is made.
+       * no check is made, and for
+       * LinearAlgebra::OrthogonalizationStrategy::s_step_block_classical_gram_schmidt,
+       * reorthogonalization is always done.
        */
       bool do_reorthogonalization;
 
@@ -501,6 +560,25 @@ public:
      * Strategy to orthogonalize vectors.
      */
     LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy;
+
+    /**
+     * Number of Krylov vectors generated and orthogonalized together in the
+     * s-step variant of GMRES, i.e., when orthogonalization_strategy is set
+     * to
+     * LinearAlgebra::OrthogonalizationStrategy::s_step_block_classical_gram_schmidt.
+     * Larger values reduce the number of global reductions, but the
+     * Krylov vectors within a block become increasingly ill-conditioned,
+     * such that values beyond 10 are rarely useful. The s-step variant is
+     * only used if use_default_residual is set to `true`; otherwise, the
+     * solver uses the classical Gram-Schmidt algorithm with
+     * reorthogonalization. This variable is ignored by the other
+     * orthogonalization strategies. The default is 5.
+     *
+     * The number of blocks orthogonalized by the s-step variant and the
+     * number of blocks that were rank deficient can be queried with
+     * connect_s_step_blocks_slot().
+     */
+    unsigned int s_step_size;
   };
 
   /**
@@ -586,6 +664,17 @@ public:
   boost::signals2::connection
   connect_re_orthogonalization_slot(const std::function<void(int)> &slot);
 
+  /**
+   * Connect a slot to retrieve the number of blocks that were computed with
+   * the s-step variant, see AdditionalData::s_step_size, and the number of
+   * those blocks that were numerically rank deficient and hence replaced by
+   * single steps of the classical Gram-Schmidt algorithm. Called once at the
+   * end of solve() if the s-step variant is used outside the batched mode.
+   */
+  boost::signals2::connection
+  connect_s_step_blocks_slot(
+    const std::function<void(unsigned int, unsigned int)> &slot);
+
 
   DeclException1(ExcTooFewTmpVectors,
                  int,
@@ -652,6 +741,14 @@ protected:
    */
   boost::signals2::signal<void(int)> re_orthogonalize_signal;
 
+  /**
+   * Signal used to retrieve the number of s-step blocks and the number of
+   * rank deficient s-step blocks. Called once when all iterations are
+   * ended.
+   */
+  boost::signals2::signal<void(unsigned int, unsigned int)>
+    s_step_blocks_signal;
+
   /**
    * A reference to the underlying SolverControl object. In the regular case,
    * this is not needed, as the signal from the base class is used, but the
@@ -977,6 +1074,7 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   , force_re_orthogonalization(force_re_orthogonalization)
   , batched_mode(batched_mode)
   , orthogonalization_strategy(orthogonalization_strategy)
+  , s_step_size(5)
 {
   Assert(max_basis_size >= 1,
          ExcMessage("SolverGMRES needs at least one vector in the "
@@ -1378,6 +1476,71 @@ namespace internal
 
 
 
+    // Compute the inner products of the vectors with indices first_column,
+    // ..., first_column + n_columns - 1 with the vectors 0, ..., n_rows - 1,
+    // stored column by column in the vector result
+    template <typename VectorType,
+              std::enable_if_t<!is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_Tvmult(const unsigned int            n_rows,
+                 const unsigned int            first_column,
+                 const unsigned int            n_columns,
+                 const TmpVectors<VectorType> &vectors,
+                 Vector<double>               &result,
+                 std::vector<const typename VectorType::value_type *> &)
+    {
+      result.reinit(n_rows * n_columns);
+      for (unsigned int j = 0; j < n_columns; ++j)
+        for (unsigned int i = 0; i < n_rows; ++i)
+          result(j * n_rows + i) = vectors[first_column + j] * vectors[i];
+    }
+
+
+
+    template <typename VectorType,
+              std::enable_if_t<is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_Tvmult(
+      const unsigned int                                    n_rows,
+      const unsigned int                                    first_column,
+      const unsigned int                                    n_columns,
+      const TmpVectors<VectorType>                         &vectors,
+      Vector<double>                                       &result,
+      std::vector<const typename VectorType::value_type *> &vector_ptrs)
+    {
+      result.reinit(n_rows * n_columns);
+      Vector<double> column(n_rows);
+      for (unsigned int j = 0; j < n_columns; ++j)
+        {
+          const VectorType &current = vectors[first_column + j];
+          column                    = 0.;
+          for (unsigned int b = 0; b < n_blocks(current); ++b)
+            {
+              vector_ptrs.resize(n_rows);
+              for (unsigned int i = 0; i < n_rows; ++i)
+                vector_ptrs[i] = block(vectors[i], b).begin();
+
+              do_Tvmult_add<false>(n_rows,
+                                   block(current, b).end() -
+                                     block(current, b).begin(),
+                                   block(current, b).begin(),
+                                   vector_ptrs,
+                                   column);
+            }
+          for (unsigned int i = 0; i < n_rows; ++i)
+            result(j * n_rows + i) = column(i);
+        }
+
+      // a single global reduction for all columns
+      Utilities::MPI::sum(result,
+                          block(vectors[0], 0).get_mpi_communicator(),
+                          result);
+    }
+
+
+
     template <typename Number>
     inline void
     ArnoldiProcess<Number>::initialize(
@@ -1386,7 +1549,11 @@ namespace internal
       const bool                                     force_reorthogonalization)
     {
       this->orthogonalization_strategy = orthogonalization_strategy;
-      this->do_reorthogonalization     = force_reorthogonalization;
+      this->do_reorthogonalization =
+        force_reorthogonalization ||
+        orthogonalization_strategy ==
+          LinearAlgebra::OrthogonalizationStrategy::
+            s_step_block_classical_gram_schmidt;
 
       hessenberg_matrix.reinit(basis_size + 1, basis_size);
       triangular_matrix.reinit(basis_size + 1, basis_size, true);
@@ -1401,6 +1568,7 @@ namespace internal
         h.reinit(2 * basis_size + 3);
       else
         h.reinit(basis_size + 1);
+      h_first_pass.reinit(basis_size + 1);
     }
 
 
@@ -1531,12 +1699,25 @@ namespace internal
                     vv.add_and_dot(-htmp, orthogonal_vectors[n - 1], vv));
                 }
               else if (orthogonalization_strategy ==
-                       LinearAlgebra::OrthogonalizationStrategy::
-                         classical_gram_schmidt)
+                         LinearAlgebra::OrthogonalizationStrategy::
+                           classical_gram_schmidt ||
+                       orthogonalization_strategy ==
+                         LinearAlgebra::OrthogonalizationStrategy::
+                           s_step_block_classical_gram_schmidt)
                 {
+                  // in the reorthogonalization step, only the projection
+                  // coefficients of the second pass must be subtracted from
+                  // vv, while h accumulates the coefficients of both passes
+                  if (c == 1)
+                    {
+                      h_first_pass.reinit(n);
+                      h.swap(h_first_pass);
+                    }
                   Tvmult_add<false>(n, vv, orthogonal_vectors, h, vector_ptrs);
                   norm_vv = subtract_and_norm<false>(
                     n, orthogonal_vectors, h, vv, vector_ptrs);
+                  if (c == 1)
+                    h += h_first_pass;
                 }
               else
                 {
@@ -1592,6 +1773,151 @@ namespace internal
 
 
 
+    template <typename Number>
+    template <typename VectorType>
+    inline bool
+    ArnoldiProcess<Number>::orthonormalize_block(
+      const unsigned int        n,
+      const unsigned int        s,
+      const FullMatrix<double> &change_of_basis,
+      TmpVectors<VectorType>   &orthogonal_vectors)
+    {
+      AssertIndexRange(n + s, hessenberg_matrix.m());
+      AssertIndexRange(n + s, orthogonal_vectors.size());
+      AssertDimension(change_of_basis.m(), s + 1);
+      AssertDimension(change_of_basis.n(), s);
+      AssertDimension(givens_rotations.size(), n);
+
+      const unsigned int n_rows = n + 1 + s;
+
+      // The factors of the block orthogonalization are accumulated in the
+      // matrix 'factors', which expresses the vectors of the block as they
+      // were passed to this function in terms of the new orthonormal basis:
+      // rows 0 to n hold the projections onto the previous vectors, rows
+      // n + 1 to n + s the upper triangular factor of the block
+      FullMatrix<double> factors(n_rows, s);
+      for (unsigned int j = 0; j < s; ++j)
+        factors(n + 1 + j, j) = 1.;
+
+      Vector<double>     gram;
+      Vector<double>     coefficients(n + 1);
+      FullMatrix<double> cholesky(s, s);
+      FullMatrix<double> new_factors(n_rows, s);
+      for (unsigned int pass = 0; pass < 2; ++pass)
+        {
+          // global reduction for the projections C = Q^T V onto the previous
+          // vectors and the Gram matrix V^T V of the block
+          block_Tvmult(n_rows, n + 1, s, orthogonal_vectors, gram, vector_ptrs);
+
+          // Cholesky factorization R^T R = V^T V - C^T C of the Gram matrix
+          // of the projected block
+          for (unsigned int j = 0; j < s; ++j)
+            for (unsigned int i = 0; i <= j; ++i)
+              {
+                double sum = gram(j * n_rows + n + 1 + i);
+                for (unsigned int k = 0; k <= n; ++k)
+                  sum -= gram(i * n_rows + k) * gram(j * n_rows + k);
+                for (unsigned int k = 0; k < i; ++k)
+                  sum -= cholesky(k, i) * cholesky(k, j);
+                if (i < j)
+                  cholesky(i, j) = sum / cholesky(i, i);
+                else if (sum > 100. * std::numeric_limits<double>::epsilon() *
+                                 gram(j * n_rows + n + 1 + j))
+                  cholesky(j, j) = std::sqrt(sum);
+                else
+                  return false;
+              }
+
+          // compute the new vectors (V - Q C) R^{-1}
+          for (unsigned int j = 0; j < s; ++j)
+            {
+              VectorType &vj = orthogonal_vectors[n + 1 + j];
+              for (unsigned int k = 0; k <= n; ++k)
+                coefficients(k) = -gram(j * n_rows + k);
+              add(vj,
+                  n + 1,
+                  coefficients,
+                  orthogonal_vectors,
+                  false,
+                  vector_ptrs);
+              for (unsigned int i = 0; i < j; ++i)
+                vj.add(-cholesky(i, j), orthogonal_vectors[n + 1 + i]);
+              vj *= 1. / cholesky(j, j);
+            }
+
+          // accumulate the factors of this pass
+          new_factors = 0.;
+          for (unsigned int j = 0; j < s; ++j)
+            {
+              for (unsigned int k = 0; k <= n; ++k)
+                new_factors(k, j) = factors(k, j);
+              for (unsigned int l = 0; l <= j; ++l)
+                {
+                  const double factor = factors(n + 1 + l, j);
+                  for (unsigned int k = 0; k <= n; ++k)
+                    new_factors(k, j) += gram(l * n_rows + k) * factor;
+                  for (unsigned int k = 0; k <= l; ++k)
+                    new_factors(n + 1 + k, j) += cholesky(k, l) * factor;
+                }
+            }
+          factors = new_factors;
+        }
+
+      // The block W = [q_n, w_1, ..., w_s] of the Krylov basis with the
+      // vector q_n that generated it is represented as W = Q R_W in the new
+      // basis Q, where the first column of R_W is the unit vector e_n and the
+      // remaining columns are given by 'factors'. The relation OP W_{0:s-1} =
+      // W B with the change of basis B and the Arnoldi relation OP Q = Q H
+      // then give the new columns of the Hessenberg matrix, H_new R_W(n:n+s-1,
+      // 0:s-1) = R_W B - H_old R_W(0:n-1, 0:s-1), which we solve by forward
+      // substitution with the upper triangular matrix R_W(n:n+s-1, 0:s-1).
+      const auto r_w = [&](const unsigned int row, const unsigned int col) {
+        return col == 0 ? (row == n ? 1. : 0.) : factors(row, col - 1);
+      };
+      for (unsigned int j = 0; j < s; ++j)
+        {
+          const unsigned int col = n + j;
+          for (unsigned int k = 0; k < n_rows; ++k)
+            hessenberg_matrix(k, col) =
+              (j > 0 ? r_w(k, j - 1) * change_of_basis(j - 1, j) : 0.) +
+              r_w(k, j) * change_of_basis(j, j) +
+              r_w(k, j + 1) * change_of_basis(j + 1, j);
+          if (j > 0)
+            for (unsigned int k = 0; k <= n; ++k)
+              for (unsigned int m = (k == 0 ? 0 : k - 1); m < n; ++m)
+                hessenberg_matrix(k, col) -=
+                  hessenberg_matrix(k, m) * r_w(m, j);
+          for (unsigned int i = 0; i < j; ++i)
+            {
+              const double factor = r_w(n + i, j);
+              for (unsigned int k = 0; k < n_rows; ++k)
+                hessenberg_matrix(k, col) -=
+                  hessenberg_matrix(k, n + i) * factor;
+            }
+          const double inverse_diagonal = 1. / r_w(n + j, j);
+          for (unsigned int k = 0; k <= col + 1; ++k)
+            hessenberg_matrix(k, col) *= inverse_diagonal;
+
+          // remove roundoff below the subdiagonal
+          for (unsigned int k = col + 2; k < n_rows; ++k)
+            hessenberg_matrix(k, col) = 0.;
+        }
+
+      return true;
+    }
+
+
+
+    template <typename Number>
+    inline double
+    ArnoldiProcess<Number>::transform_hessenberg_column(const unsigned int col)
+    {
+      return do_givens_rotation(
+        false, col, triangular_matrix, givens_rotations, projected_rhs);
+    }
+
+
+
     template <typename Number>
     inline double
     ArnoldiProcess<Number>::do_givens_rotation(
@@ -1756,6 +2082,90 @@ namespace internal
       return x.real() < y.real() ||
              (x.real() == y.real() && x.imag() < y.imag());
     }
+
+
+
+    // Compute the shifts and scaling factors of the Newton basis used by the
+    // s-step variant of GMRES from the Ritz values, i.e., the eigenvalues of
+    // the leading n x n block of the Hessenberg matrix. The shifts are the
+    // Ritz values in modified Leja ordering, which keeps complex-conjugate
+    // pairs together with the value with positive imaginary part first, such
+    // that each pair can be applied in real arithmetic. The scaling factors
+    // are set to the maximal distance of the Ritz values from the respective
+    // shift, to keep the size of the basis vectors balanced.
+    inline void
+    compute_newton_shifts(const FullMatrix<double>          &hessenberg_matrix,
+                          const unsigned int                 n,
+                          std::vector<std::complex<double>> &shifts,
+                          std::vector<double>               &scalings)
+    {
+      LAPACKFullMatrix<double> matrix(n, n);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j < n; ++j)
+          matrix(i, j) = hessenberg_matrix(i, j);
+      matrix.compute_eigenvalues();
+
+      std::vector<std::complex<double>> ritz_values(n);
+      for (unsigned int i = 0; i < n; ++i)
+        ritz_values[i] = matrix.eigenvalue(i);
+
+      shifts.clear();
+      std::vector<bool> selected(n, false);
+      while (shifts.size() < n)
+        {
+          unsigned int next        = 0;
+          double       max_product = -1.;
+          for (unsigned int i = 0; i < n; ++i)
+            if (selected[i] == false)
+              {
+                double product =
+                  (shifts.empty() ? std::abs(ritz_values[i]) : 1.);
+                for (const std::complex<double> &shift : shifts)
+                  product *= std::abs(ritz_values[i] - shift);
+                if (product > max_product)
+                  {
+                    max_product = product;
+                    next        = i;
+                  }
+              }
+          selected[next] = true;
+
+          const std::complex<double> value = ritz_values[next];
+          if (value.imag() == 0.)
+            shifts.push_back(value);
+          else
+            {
+              // LAPACK returns complex eigenvalues of real matrices in exact
+              // conjugate pairs, so we can look for the partner by equality
+              unsigned int partner = numbers::invalid_unsigned_int;
+              for (unsigned int i = 0; i < n; ++i)
+                if (selected[i] == false && ritz_values[i] == std::conj(value))
+                  {
+                    partner = i;
+                    break;
+                  }
+              if (partner == numbers::invalid_unsigned_int)
+                shifts.emplace_back(value.real(), 0.);
+              else
+                {
+                  selected[partner] = true;
+                  shifts.emplace_back(value.real(), std::abs(value.imag()));
+                  shifts.emplace_back(value.real(), -std::abs(value.imag()));
+                }
+            }
+        }
+
+      scalings.resize(n);
+      for (unsigned int j = 0; j < n; ++j)
+        {
+          double max_distance = 0.;
+          for (const std::complex<double> &value : ritz_values)
+            max_distance = std::max(max_distance, std::abs(value - shifts[j]));
+          scalings[j] = (max_distance > 0. && std::isfinite(max_distance)) ?
+                          max_distance :
+                          1.;
+        }
+    }
   } // namespace SolverGMRESImplementation
 } // namespace internal
 
@@ -1881,6 +2291,24 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
                              basis_size,
                              additional_data.force_re_orthogonalization);
 
+  // Data for the s-step variant: the shifts and scaling factors of the Newton
+  // basis, computed from the Ritz values after the first s iterations, and
+  // the matrix representing the change of basis in a block
+  const bool use_s_step =
+    additional_data.orthogonalization_strategy ==
+      LinearAlgebra::OrthogonalizationStrategy::
+        s_step_block_classical_gram_schmidt &&
+    additional_data.s_step_size > 1 && use_default_residual;
+#ifndef DEAL_II_WITH_LAPACK
+  // the shifts of the Newton basis are computed from the Ritz values with
+  // LAPACK
+  AssertThrow(use_s_step == false, ExcNeedsLAPACK());
+#endif
+  std::vector<std::complex<double>> newton_shifts;
+  std::vector<double>               newton_scalings;
+  FullMatrix<double>                change_of_basis;
+  unsigned int n_s_step_blocks = 0, n_rank_deficient_blocks = 0;
+
   ///////////////////////////////////////////////////////////////////////////
   // outer iteration: loop until we either reach convergence or the maximum
   // number of iterations is exceeded. each cycle of this loop amounts to one
@@ -1966,6 +2394,82 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
               iteration_state == SolverControl::iterate);
            ++inner_iteration)
         {
+          // s-step variant: generate a block of Krylov vectors in the Newton
+          // basis and orthogonalize them together. If the block turns out to
+          // be numerically rank deficient, fall back to a single step of the
+          // classical Arnoldi process below.
+          if (use_s_step && !newton_shifts.empty())
+            {
+              const unsigned int block_size =
+                std::min<unsigned int>(newton_shifts.size(),
+                                       basis_size - inner_iteration);
+              change_of_basis.reinit(block_size + 1, block_size);
+              for (unsigned int j = 0; j < block_size; ++j)
+                {
+                  VectorType &vv = basis_vectors(inner_iteration + j + 1, x);
+                  const VectorType &w = basis_vectors[inner_iteration + j];
+                  if (left_precondition)
+                    {
+                      A.vmult(p, w);
+                      preconditioner.vmult(vv, p);
+                    }
+                  else
+                    {
+                      preconditioner.vmult(p, w);
+                      A.vmult(vv, p);
+                    }
+                  vv.add(-newton_shifts[j].real(), w);
+                  change_of_basis(j, j) = newton_shifts[j].real();
+
+                  // second step of a pair of complex-conjugate shifts
+                  // theta, conj(theta): together with the first step, this
+                  // applies (OP - theta) (OP - conj(theta)) in real
+                  // arithmetic
+                  if (newton_shifts[j].imag() < 0.)
+                    {
+                      Assert(j > 0, ExcInternalError());
+                      const double factor = newton_shifts[j].imag() *
+                                            newton_shifts[j].imag() /
+                                            newton_scalings[j - 1];
+                      vv.add(factor, basis_vectors[inner_iteration + j - 1]);
+                      change_of_basis(j - 1, j) = -factor;
+                    }
+                  vv *= 1. / newton_scalings[j];
+                  change_of_basis(j + 1, j) = newton_scalings[j];
+                }
+
+              if (arnoldi_process.orthonormalize_block(inner_iteration,
+                                                       block_size,
+                                                       change_of_basis,
+                                                       basis_vectors))
+                {
+                  ++n_s_step_blocks;
+                  unsigned int j = 0;
+                  while (j < block_size &&
+                         iteration_state == SolverControl::iterate)
+                    {
+                      ++accumulated_iterations;
+                      res = arnoldi_process.transform_hessenberg_column(
+                        inner_iteration + j);
+                      if (additional_data.batched_mode)
+                        iteration_state =
+                          solver_control.check(accumulated_iterations, res);
+                      else
+                        iteration_state =
+                          this->iteration_status(accumulated_iterations,
+                                                 res,
+                                                 x);
+                      ++j;
+                    }
+
+                  // the loop increment adds the last step
+                  inner_iteration += j - 1;
+                  continue;
+                }
+              else
+                ++n_rank_deficient_blocks;
+            }
+
           ++accumulated_iterations;
           // yet another alias
           VectorType &vv = basis_vectors(inner_iteration + 1, x);
@@ -2039,6 +2543,17 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
                       this->iteration_status(accumulated_iterations, res, x);
                 }
             }
+
+          // compute the shifts for the s-step variant from the Ritz values
+          // of the first s iterations
+          if (use_s_step && newton_shifts.empty() &&
+              inner_iteration + 1 ==
+                std::min(additional_data.s_step_size, basis_size))
+            internal::SolverGMRESImplementation::compute_newton_shifts(
+              arnoldi_process.get_hessenberg_matrix(),
+              inner_iteration + 1,
+              newton_shifts,
+              newton_scalings);
         }
 
       // end of inner iteration; now update the global solution vector x with
@@ -2093,6 +2608,9 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
     }
   while (iteration_state == SolverControl::iterate);
 
+  if (use_s_step && !additional_data.batched_mode)
+    s_step_blocks_signal(n_s_step_blocks, n_rank_deficient_blocks);
+
   // in case of failure: throw exception
   AssertThrow(iteration_state == SolverControl::success,
               SolverControl::NoConvergence(accumulated_iterations, res));
@@ -2177,6 +2695,17 @@ boost::signals2::connection
 
 
 
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+boost::signals2::connection
+  SolverGMRES<VectorType>::connect_s_step_blocks_slot(
+    const std::function<void(unsigned int, unsigned int)> &slot)
+{
+  return s_step_blocks_signal.connect(slot);
+}
+
+
+
 template <typename VectorType>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
 double SolverGMRES<VectorType>::criterion()
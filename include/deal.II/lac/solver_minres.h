@@ -25,6 +25,7 @@
 
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector_operations_internal.h>
 
 #include <cmath>
 
@@ -251,6 +252,17 @@ void SolverMinRes<VectorType>::solve(const MatrixType         &A,
   // The iteration step.
   unsigned int j = 1;
 
+  // For vectors that support it, the vector updates and inner products of
+  // the iteration are merged into a few passes through the vectors, see
+  // internal::VectorOperations::fused_update_and_reduce().
+  using Number = typename VectorType::value_type;
+  constexpr bool use_fused_operations =
+    internal::VectorOperations::supports_fused_operations<VectorType>;
+  std::shared_ptr<parallel::internal::TBBPartitioner> thread_loop_partitioner;
+  if (use_fused_operations)
+    thread_loop_partitioner =
+      std::make_shared<parallel::internal::TBBPartitioner>();
+
 
   // Start of the solution process
   A.vmult(*m[0], x);
@@ -286,11 +298,53 @@ void SolverMinRes<VectorType>::solve(const MatrixType         &A,
         v.reinit(b);
 
       A.vmult(*u[2], v);
-      u[2]->add(-std::sqrt(delta[1] / delta[0]), *u[0]);
 
-      const double gamma = *u[2] * v;
-      u[2]->add(-gamma / std::sqrt(delta[1]), *u[1]);
-      *m[0] = v;
+      double gamma;
+      if constexpr (use_fused_operations)
+        {
+          // u[2] -= sqrt(delta[1] / delta[0]) * u[0] and gamma = u[2] * v,
+          // then u[2] -= gamma / sqrt(delta[1]) * u[1] and m[0] = v
+          Number *const u2_ptr = u[2]->begin();
+          Number *const m0_ptr = m[0]->begin();
+          const Number *u0_ptr = u[0]->begin();
+          const Number *u1_ptr = u[1]->begin();
+          const Number *v_ptr  = v.begin();
+          const Number  factor = -std::sqrt(delta[1] / delta[0]);
+          const std::array<Number, 1> sums = internal::VectorOperations::
+            fused_update_and_reduce_global<1>(
+              thread_loop_partitioner, v, [&](const auto i, auto &sums) {
+                using T = std::decay_t<decltype(sums[0])>;
+                using internal::VectorOperations::fused_load;
+                using internal::VectorOperations::fused_store;
+                const T u2i = fused_load<T>(u2_ptr + i) +
+                              factor * fused_load<T>(u0_ptr + i);
+                fused_store(u2i, u2_ptr + i);
+                sums[0] += u2i * fused_load<T>(v_ptr + i);
+              });
+          gamma = sums[0];
+
+          const Number factor_1 = -gamma / std::sqrt(delta[1]);
+          internal::VectorOperations::fused_update_and_reduce_global<0>(
+            thread_loop_partitioner, v, [&](const auto i, auto &sums) {
+              using T = std::decay_t<decltype(sums[0])>;
+              using internal::VectorOperations::fused_load;
+              using internal::VectorOperations::fused_store;
+              fused_store(fused_load<T>(u2_ptr + i) +
+                            factor_1 * fused_load<T>(u1_ptr + i),
+                          u2_ptr + i);
+              fused_store(fused_load<T>(v_ptr + i), m0_ptr + i);
+            });
+          internal::VectorOperations::update_ghost_values_after_fused_operation(
+            *u[2], *m[0]);
+        }
+      else
+        {
+          u[2]->add(-std::sqrt(delta[1] / delta[0]), *u[0]);
+
+          gamma = *u[2] * v;
+          u[2]->add(-gamma / std::sqrt(delta[1]), *u[1]);
+          *m[0] = v;
+        }
 
       // precondition: solve M v = u[2]
       // Preconditioner has to be positive
@@ -326,11 +380,40 @@ void SolverMinRes<VectorType>::solve(const MatrixType         &A,
       if (j == 1)
         tau = r0 * c;
 
-      m[0]->add(-e[0], *m[1]);
-      if (j > 1)
-        m[0]->add(-f[0], *m[2]);
-      *m[0] *= 1. / d;
-      x.add(tau, *m[0]);
+      if constexpr (use_fused_operations)
+        {
+          // m[0] = (m[0] - e[0] * m[1] - f[0] * m[2]) / d and x += tau * m[0]
+          Number *const m0_ptr = m[0]->begin();
+          Number *const x_ptr  = x.begin();
+          const Number *m1_ptr = m[1]->begin();
+          const Number *m2_ptr = m[2]->begin();
+          const Number  e0     = e[0];
+          const Number  f0     = (j > 1) ? f[0] : 0.;
+          const Number  d_inv  = 1. / d;
+          const Number  tau_i  = tau;
+          internal::VectorOperations::fused_update_and_reduce_global<0>(
+            thread_loop_partitioner, x, [&](const auto i, auto &sums) {
+              using T = std::decay_t<decltype(sums[0])>;
+              using internal::VectorOperations::fused_load;
+              using internal::VectorOperations::fused_store;
+              const T m0i = (fused_load<T>(m0_ptr + i) -
+                             e0 * fused_load<T>(m1_ptr + i) -
+                             f0 * fused_load<T>(m2_ptr + i)) *
+                            d_inv;
+              fused_store(m0i, m0_ptr + i);
+              fused_store(fused_load<T>(x_ptr + i) + tau_i * m0i, x_ptr + i);
+            });
+          internal::VectorOperations::update_ghost_values_after_fused_operation(
+            *m[0], x);
+        }
+      else
+        {
+          m[0]->add(-e[0], *m[1]);
+          if (j > 1)
+            m[0]->add(-f[0], *m[2]);
+          *m[0] *= 1. / d;
+          x.add(tau, *m[0]);
+        }
       r_l2 *= std::fabs(s);
 
       conv = this->iteration_status(j, r_l2, x);
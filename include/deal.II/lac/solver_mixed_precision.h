@@ -0,0 +1,321 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_mixed_precision_h
+#define dealii_solver_mixed_precision_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * A solver that combines an outer iteration in the precision of
+ * @p VectorType (typically double) with an inner solver or preconditioner
+ * that works on vectors of type @p InnerVectorType of lower precision
+ * (typically float). A typical use case is a geometric multigrid
+ * preconditioner based on MatrixFree<dim, float>, which runs almost twice as
+ * fast as its double precision counterpart because the matrix-vector products
+ * are limited by the memory bandwidth, while the outer iteration with the
+ * double precision operator ensures that the final solution is accurate to
+ * the precision of @p VectorType.
+ *
+ * Two variants of the outer iteration are provided, selected by
+ * AdditionalData::max_basis_size:
+ * <ul>
+ * <li> If the basis size is zero (the default), the solver runs iterative
+ * refinement, also known as defect correction: Given the residual $r_k = b -
+ * A x_k$ computed in high precision, the inner solver is applied to $r_k$ in
+ * low precision, and the result is added to $x_k$. This converges as long as
+ * the inner solver reduces the error by a constant factor, e.g., by a
+ * multigrid V-cycle or an inner Krylov solver with a relative tolerance of
+ * $10^{-2}$ or $10^{-3}$.
+ * <li> If the basis size is positive, the outer iteration is a flexible GMRES
+ * method (SolverFGMRES) with the given maximal basis size that uses the inner
+ * solver as a (variable) preconditioner. This is more robust than iterative
+ * refinement if the inner solver is only a rough approximation of the
+ * inverse, at the cost of storing two vectors per iteration.
+ * </ul>
+ *
+ * The inner solver or preconditioner is passed to solve() and needs to
+ * provide a function <code>vmult(InnerVectorType &dst, const InnerVectorType
+ * &src) const</code>. An inner Krylov solver in low precision can be passed,
+ * e.g., as an inverse_operator() of the low-precision operator.
+ *
+ * The conversion between the two precisions is done by copying the locally
+ * owned entries into two vectors of type @p InnerVectorType, which are
+ * allocated once at the beginning of solve(), such that no memory allocation
+ * happens in the iterations. For LinearAlgebra::distributed::Vector, the
+ * conversion uses
+ * LinearAlgebra::distributed::Vector::copy_locally_owned_data_from() and thus
+ * runs in parallel on all threads and involves no communication.
+ *
+ * The convergence criterion is the norm of the residual $b - A x_k$ in the
+ * precision of @p VectorType, which is passed to the SolverControl object.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * For the iterative refinement variant, the solve() function of this class
+ * uses the mechanism described in the Solver base class to determine
+ * convergence. This mechanism can also be used to observe the progress of the
+ * iteration. For the flexible GMRES variant, the residual is checked by the
+ * SolverFGMRES object, which uses the SolverControl object of this class but
+ * not the slots connected to this class.
+ */
+template <typename VectorType      = LinearAlgebra::distributed::Vector<double>,
+          typename InnerVectorType = LinearAlgebra::distributed::Vector<float>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType> &&
+                       concepts::is_vector_space_vector<InnerVectorType>)
+class SolverMixedPrecision : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor. By default, the solver runs iterative refinement.
+     */
+    explicit AdditionalData(const unsigned int max_basis_size = 0)
+      : max_basis_size(max_basis_size)
+    {}
+
+    /**
+     * Maximum size of the basis of the outer flexible GMRES method. If set to
+     * zero, iterative refinement is used instead.
+     */
+    unsigned int max_basis_size;
+  };
+
+  /**
+   * Constructor.
+   */
+  SolverMixedPrecision(SolverControl            &cn,
+                       VectorMemory<VectorType> &mem,
+                       const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverMixedPrecision(SolverControl        &cn,
+                       const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x, using @p inner_solver in the
+   * precision of @p InnerVectorType to compute corrections.
+   */
+  template <typename MatrixType, typename InnerSolverType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<InnerSolverType, InnerVectorType>))
+  void solve(const MatrixType      &A,
+             VectorType            &x,
+             const VectorType      &b,
+             const InnerSolverType &inner_solver);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+
+  /**
+   * A reference to the object that controls convergence, needed for the
+   * outer flexible GMRES method.
+   */
+  SolverControl &solver_control;
+};
+
+/** @} */
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverMixedPrecision
+  {
+    template <typename VectorType, typename OtherVectorType>
+    using copy_locally_owned_data_from_t =
+      decltype(std::declval<VectorType &>().copy_locally_owned_data_from(
+        std::declval<const OtherVectorType &>()));
+
+    /**
+     * Copy the locally owned entries of @p src into @p dst, converting them
+     * to the number type of @p dst.
+     */
+    template <typename VectorType, typename OtherVectorType>
+    void
+    copy_with_conversion(VectorType &dst, const OtherVectorType &src)
+    {
+      if constexpr (is_supported_operation<copy_locally_owned_data_from_t,
+                                           VectorType,
+                                           OtherVectorType>)
+        dst.copy_locally_owned_data_from(src);
+      else
+        dst = src;
+    }
+
+
+
+    /**
+     * A class that applies an inner solver or preconditioner working on
+     * vectors of type @p InnerVectorType to vectors of type @p VectorType,
+     * converting the vectors before and after the operation.
+     */
+    template <typename VectorType,
+              typename InnerVectorType,
+              typename InnerSolverType>
+    class InnerSolver
+    {
+    public:
+      InnerSolver(const InnerSolverType &inner_solver, const VectorType &x)
+        : inner_solver(inner_solver)
+      {
+        src.reinit(x, true);
+        dst.reinit(x, true);
+      }
+
+      /**
+       * Apply the inner solver to @p in and write the result to @p out. The
+       * two vectors may be the same.
+       */
+      void
+      vmult(VectorType &out, const VectorType &in) const
+      {
+        copy_with_conversion(src, in);
+        inner_solver.vmult(dst, src);
+        copy_with_conversion(out, dst);
+      }
+
+    private:
+      const InnerSolverType &inner_solver;
+
+      mutable InnerVectorType src;
+      mutable InnerVectorType dst;
+    };
+  } // namespace SolverMixedPrecision
+} // namespace internal
+
+
+
+template <typename VectorType, typename InnerVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType> &&
+                       concepts::is_vector_space_vector<InnerVectorType>)
+SolverMixedPrecision<VectorType, InnerVectorType>::SolverMixedPrecision(
+  SolverControl            &cn,
+  VectorMemory<VectorType> &mem,
+  const AdditionalData     &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+  , solver_control(cn)
+{}
+
+
+
+template <typename VectorType, typename InnerVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType> &&
+                       concepts::is_vector_space_vector<InnerVectorType>)
+SolverMixedPrecision<VectorType, InnerVectorType>::SolverMixedPrecision(
+  SolverControl        &cn,
+  const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+  , solver_control(cn)
+{}
+
+
+
+template <typename VectorType, typename InnerVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType> &&
+                       concepts::is_vector_space_vector<InnerVectorType>)
+template <typename MatrixType, typename InnerSolverType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<InnerSolverType, InnerVectorType>))
+void SolverMixedPrecision<VectorType, InnerVectorType>::solve(
+  const MatrixType      &A,
+  VectorType            &x,
+  const VectorType      &b,
+  const InnerSolverType &inner_solver)
+{
+  LogStream::Prefix prefix("MixedPrecision");
+
+  const internal::SolverMixedPrecision::
+    InnerSolver<VectorType, InnerVectorType, InnerSolverType>
+      preconditioner(inner_solver, x);
+
+  if (additional_data.max_basis_size > 0)
+    {
+      SolverFGMRES<VectorType> solver(
+        solver_control,
+        this->memory,
+        typename SolverFGMRES<VectorType>::AdditionalData(
+          additional_data.max_basis_size));
+      solver.solve(A, x, b, preconditioner);
+      return;
+    }
+
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  VectorType                                &r = *r_pointer;
+  r.reinit(x, true);
+
+  SolverControl::State state = SolverControl::iterate;
+  unsigned int         it    = 0;
+  double               residual_norm;
+  while (true)
+    {
+      // compute the residual in high precision
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+      residual_norm = r.l2_norm();
+
+      state = this->iteration_status(it, residual_norm, x);
+      if (state != SolverControl::iterate)
+        break;
+
+      // compute the correction in low precision
+      preconditioner.vmult(r, r);
+      x += r;
+
+      ++it;
+    }
+
+  AssertThrow(state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
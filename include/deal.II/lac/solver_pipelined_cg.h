@@ -0,0 +1,372 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_pipelined_cg_h
+#define dealii_solver_pipelined_cg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <array>
+#include <cmath>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * This class implements the pipelined preconditioned conjugate gradient
+ * method of Ghysels and Vanroose (Algorithm 4 of @cite Ghysels2014). In exact
+ * arithmetic, it computes the same iterates as SolverCG. However, SolverCG
+ * needs two global reductions per iteration, each of which waits for the
+ * result of the preceding matrix-vector product or preconditioner
+ * application. The pipelined variant instead computes all inner products of
+ * an iteration at the same point and combines them into a single global
+ * reduction. This reduction is started as a non-blocking operation
+ * (<code>MPI_Iallreduce</code>) before the preconditioner and the
+ * matrix-vector product of the iteration are applied, and only waited for
+ * afterwards, such that the latency of the reduction can be hidden behind
+ * the computations. This makes the method attractive for large numbers of
+ * MPI processes with small local problem sizes, where the global reductions
+ * of SolverCG limit scalability.
+ *
+ * The price for this is a higher number of vector operations (four
+ * additional vector updates per iteration) and the storage of five
+ * additional vectors compared to SolverCG. Furthermore, the recurrences used
+ * for the auxiliary vectors lead to a somewhat larger accumulation of
+ * roundoff errors, which can limit the attainable accuracy for very strict
+ * tolerances.
+ *
+ * The non-blocking reduction is used for vector types that give access to
+ * their locally owned elements via <code>local_element()</code> and to their
+ * MPI communicator via <code>get_mpi_communicator()</code>, such as
+ * LinearAlgebra::distributed::Vector. For other vector types, the inner
+ * products are computed with the usual (blocking) operations of the vector.
+ *
+ * The convergence criterion is the norm of the (unpreconditioned) residual,
+ * which is passed to the SolverControl object. Since the norm is computed in
+ * the same reduction as the other inner products, the residual of iteration
+ * $k$ is only known in the middle of iteration $k$. The solver hence applies
+ * the matrix and the preconditioner once more than SolverCG before it
+ * detects convergence. The solver is only implemented for real-valued
+ * vectors.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ */
+template <typename VectorType = Vector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver. This
+   * solver does not take additional data at the moment.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverPipelinedCG(SolverControl            &cn,
+                    VectorMemory<VectorType> &mem,
+                    const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverPipelinedCG(SolverControl        &cn,
+                    const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+/** @} */
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverPipelinedCG
+  {
+    template <typename VectorType>
+    using local_element_t =
+      decltype(std::declval<const VectorType &>().local_element(0));
+
+    template <typename VectorType>
+    using get_mpi_communicator_t =
+      decltype(std::declval<const VectorType &>().get_mpi_communicator());
+
+    template <typename VectorType>
+    constexpr bool supports_nonblocking_reduction =
+      is_supported_operation<local_element_t, VectorType> &&
+      is_supported_operation<get_mpi_communicator_t, VectorType>;
+
+
+
+    /**
+     * A class that computes the inner products $(r,u)$, $(w,u)$, and $(r,r)$
+     * needed in one iteration of the pipelined CG method. The function
+     * start() computes the contributions of the locally owned elements and
+     * starts the global reduction, and wait() finishes it.
+     */
+    class InnerProducts
+    {
+    public:
+      InnerProducts()
+#  ifdef DEAL_II_WITH_MPI
+        : request(MPI_REQUEST_NULL)
+#  endif
+      {}
+
+      ~InnerProducts()
+      {
+        wait();
+      }
+
+      template <typename VectorType>
+      void
+      start(const VectorType &r, const VectorType &u, const VectorType &w)
+      {
+        if constexpr (supports_nonblocking_reduction<VectorType>)
+          {
+            double r_u = 0, w_u = 0, r_r = 0;
+            for (std::size_t i = 0; i < r.locally_owned_size(); ++i)
+              {
+                const double r_i = r.local_element(i);
+                const double u_i = u.local_element(i);
+                r_u += r_i * u_i;
+                w_u += w.local_element(i) * u_i;
+                r_r += r_i * r_i;
+              }
+            values = {{r_u, w_u, r_r}};
+
+#  ifdef DEAL_II_WITH_MPI
+            if (Utilities::MPI::job_supports_mpi() &&
+                Utilities::MPI::n_mpi_processes(r.get_mpi_communicator()) > 1)
+              {
+                const int ierr = MPI_Iallreduce(MPI_IN_PLACE,
+                                                values.data(),
+                                                values.size(),
+                                                MPI_DOUBLE,
+                                                MPI_SUM,
+                                                r.get_mpi_communicator(),
+                                                &request);
+                AssertThrowMPI(ierr);
+              }
+#  endif
+          }
+        else
+          values = {{r * u, w * u, r * r}};
+      }
+
+      void
+      wait()
+      {
+#  ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
+#  endif
+      }
+
+      /**
+       * The inner products $(r,u)$, $(w,u)$, and $(r,r)$. Only valid after
+       * wait() has been called.
+       */
+      std::array<double, 3> values;
+
+    private:
+#  ifdef DEAL_II_WITH_MPI
+      MPI_Request request;
+#  endif
+    };
+  } // namespace SolverPipelinedCG
+} // namespace internal
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl            &cn,
+                                                 VectorMemory<VectorType> &mem,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl        &cn,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverPipelinedCG<VectorType>::solve(
+  const MatrixType         &A,
+  VectorType               &x,
+  const VectorType         &b,
+  const PreconditionerType &preconditioner)
+{
+  static_assert(
+    !numbers::NumberTraits<typename VectorType::value_type>::is_complex,
+    "SolverPipelinedCG is only implemented for real numbers.");
+
+  LogStream::Prefix prefix("pipelined_cg");
+
+  // The notation follows Algorithm 4 of Ghysels and Vanroose: r is the
+  // residual, u = M^{-1} r the preconditioned residual, w = A u, m = M^{-1} w,
+  // n = A m, and p, s, q, z the search directions for x, r, u, w.
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer u_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer w_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer m_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer n_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer s_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer q_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer z_pointer(this->memory);
+
+  VectorType &r = *r_pointer;
+  VectorType &u = *u_pointer;
+  VectorType &w = *w_pointer;
+  VectorType &m = *m_pointer;
+  VectorType &n = *n_pointer;
+  VectorType &p = *p_pointer;
+  VectorType &s = *s_pointer;
+  VectorType &q = *q_pointer;
+  VectorType &z = *z_pointer;
+  r.reinit(x, true);
+  u.reinit(x, true);
+  w.reinit(x, true);
+  m.reinit(x, true);
+  n.reinit(x, true);
+  p.reinit(x);
+  s.reinit(x);
+  q.reinit(x);
+  z.reinit(x);
+
+  A.vmult(r, x);
+  r.sadd(-1., 1., b);
+  preconditioner.vmult(u, r);
+  A.vmult(w, u);
+
+  internal::SolverPipelinedCG::InnerProducts inner_products;
+
+  double alpha = 0, beta = 0, gamma_old = 0;
+
+  SolverControl::State solver_state = SolverControl::iterate;
+  unsigned int         it           = 0;
+  double               residual_norm;
+  while (true)
+    {
+      // start the reduction and hide its latency behind the preconditioner
+      // and the matrix-vector product
+      inner_products.start(r, u, w);
+      preconditioner.vmult(m, w);
+      A.vmult(n, m);
+      inner_products.wait();
+
+      const double gamma = inner_products.values[0];
+      const double delta = inner_products.values[1];
+      residual_norm      = std::sqrt(inner_products.values[2]);
+
+      solver_state = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      if (it == 0)
+        {
+          beta  = 0;
+          alpha = gamma / delta;
+        }
+      else
+        {
+          beta  = gamma / gamma_old;
+          alpha = gamma / (delta - beta * gamma / alpha);
+        }
+      Assert(std::isfinite(alpha), ExcDivideByZero());
+      gamma_old = gamma;
+
+      z.sadd(beta, 1., n);
+      q.sadd(beta, 1., m);
+      s.sadd(beta, 1., w);
+      p.sadd(beta, 1., u);
+
+      x.add(alpha, p);
+      r.add(-alpha, s);
+      u.add(-alpha, q);
+      w.add(-alpha, z);
+
+      ++it;
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -17,6 +17,9 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/lac/sparse_matrix.h>
 
 #include <cmath>
@@ -323,6 +326,66 @@ protected:
   void
   prebuild_lower_bound();
 
+  /**
+   * The rows of the matrix sorted by level for the forward substitution with
+   * the lower triangular factor. A row is on level zero if the strictly lower
+   * triangular part of the row is empty, and otherwise on the level one
+   * larger than the maximal level of the rows referenced by its strictly
+   * lower triangular part. The rows of one level hence only depend on rows of
+   * previous levels and can be processed concurrently. The rows of level
+   * <tt>l</tt> are stored in the range
+   * <tt>[lower_level_start[l], lower_level_start[l+1])</tt>.
+   */
+  std::vector<size_type> lower_level_rows;
+
+  /**
+   * The start of each level in #lower_level_rows, with one additional entry
+   * at the end.
+   */
+  std::vector<size_type> lower_level_start;
+
+  /**
+   * Same as #lower_level_rows, but for the backward substitution with the
+   * upper triangular factor, i.e., with levels defined by the strictly upper
+   * triangular part of the rows.
+   */
+  std::vector<size_type> upper_level_rows;
+
+  /**
+   * The start of each level in #upper_level_rows, with one additional entry
+   * at the end.
+   */
+  std::vector<size_type> upper_level_start;
+
+  /**
+   * Fill the arrays #lower_level_rows, #lower_level_start,
+   * #upper_level_rows, and #upper_level_start by an analysis of the
+   * dependencies in the triangular substitutions. Requires that
+   * prebuild_lower_bound() has been called before.
+   */
+  void
+  compute_level_sets();
+
+  /**
+   * Call @p row_function for all rows of the matrix in an order that is
+   * valid for the forward substitution with the lower triangular factor (if
+   * @p upper_triangle is false) or the backward substitution with the upper
+   * triangular factor (if @p upper_triangle is true), i.e., such that all
+   * rows a row depends on have been processed before.
+   *
+   * If more than one thread is available and the levels computed by
+   * compute_level_sets() contain enough rows on average to be worth
+   * splitting up, the rows of each level are processed in parallel via
+   * parallel::apply_to_subranges(). Otherwise, the rows are visited one after
+   * the other in ascending (lower triangle) or descending (upper triangle)
+   * order. Both variants perform the same arithmetic operations for each row
+   * and hence give identical results.
+   */
+  template <typename RowFunction>
+  void
+  apply_in_substitution_order(const bool         upper_triangle,
+                              const RowFunction &row_function) const;
+
 private:
   /**
    * In general this pointer is zero except for the case that no
@@ -375,6 +438,52 @@ SparseLUDecomposition<number>::n() const
   return SparseMatrix<number>::n();
 }
 
+template <typename number>
+template <typename RowFunction>
+inline void
+SparseLUDecomposition<number>::apply_in_substitution_order(
+  const bool         upper_triangle,
+  const RowFunction &row_function) const
+{
+  const size_type N = this->m();
+
+  const std::vector<size_type> &level_rows =
+    upper_triangle ? upper_level_rows : lower_level_rows;
+  const std::vector<size_type> &level_start =
+    upper_triangle ? upper_level_start : lower_level_start;
+  AssertDimension(level_rows.size(), N);
+
+  // only go through the levels if there is enough work on each level to
+  // split it into several chunks. otherwise, the scheduling overhead and the
+  // less regular access to the vectors would not pay off
+  const size_type n_levels = level_start.size() - 1;
+  if (MultithreadInfo::n_threads() > 1 &&
+      N >= static_cast<std::size_t>(n_levels) *
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size)
+    {
+      for (size_type level = 0; level < n_levels; ++level)
+        parallel::apply_to_subranges(
+          level_start[level],
+          level_start[level + 1],
+          [&level_rows, &row_function](const size_type begin,
+                                       const size_type end) {
+            for (size_type i = begin; i < end; ++i)
+              row_function(level_rows[i]);
+          },
+          internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    }
+  else if (upper_triangle)
+    {
+      for (size_type row = N; row > 0;)
+        row_function(--row);
+    }
+  else
+    {
+      for (size_type row = 0; row < N; ++row)
+        row_function(row);
+    }
+}
+
 // Note: This function is required for full compatibility with
 // the LinearOperator class. ::MatrixInterfaceWithVmultAdd
 // picks up the vmult_add function in the protected SparseMatrix
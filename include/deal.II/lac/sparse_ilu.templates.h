@@ -46,6 +46,7 @@ SparseILU<number>::initialize(const SparseMatrix<somenumber> &matrix,
 
   this->strengthen_diagonal = data.strengthen_diagonal;
   this->prebuild_lower_bound();
+  this->compute_level_sets();
   this->copy_from(matrix);
 
   if (data.strengthen_diagonal > 0)
@@ -142,7 +143,6 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
          ExcDimensionMismatch(dst.size(), src.size()));
   Assert(dst.size() == this->m(), ExcDimensionMismatch(dst.size(), this->m()));
 
-  const size_type          N = dst.size();
   const std::size_t *const rowstart_indices =
     this->get_sparsity_pattern().rowstart.get();
   const size_type *const column_numbers =
@@ -160,26 +160,29 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
   // we split the y_i = b_i off and
   // perform it at the outset of the
   // loop
+  //
+  // rows only depend on rows that have been processed before, which allows
+  // to process independent rows in parallel (see
+  // SparseLUDecomposition::apply_in_substitution_order())
   dst = src;
-  for (size_type row = 0; row < N; ++row)
-    {
-      // get start of this row. skip the
-      // diagonal element
-      const size_type *const rowstart =
-        &column_numbers[rowstart_indices[row] + 1];
-      // find the position where the part
-      // right of the diagonal starts
-      const size_type *const first_after_diagonal =
-        this->prebuilt_lower_bound[row];
-
-      somenumber    dst_row = dst(row);
-      const number *luval =
-        this->SparseMatrix<number>::val.get() + (rowstart - column_numbers);
-      for (const size_type *col = rowstart; col != first_after_diagonal;
-           ++col, ++luval)
-        dst_row -= *luval * dst(*col);
-      dst(row) = dst_row;
-    }
+  this->apply_in_substitution_order(false, [&](const size_type row) {
+    // get start of this row. skip the
+    // diagonal element
+    const size_type *const rowstart =
+      &column_numbers[rowstart_indices[row] + 1];
+    // find the position where the part
+    // right of the diagonal starts
+    const size_type *const first_after_diagonal =
+      this->prebuilt_lower_bound[row];
+
+    somenumber    dst_row = dst(row);
+    const number *luval =
+      this->SparseMatrix<number>::val.get() + (rowstart - column_numbers);
+    for (const size_type *col = rowstart; col != first_after_diagonal;
+         ++col, ++luval)
+      dst_row -= *luval * dst(*col);
+    dst(row) = dst_row;
+  });
 
   // now the backward solve. same
   // procedure, but we need not set
@@ -189,28 +192,26 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
   // note that we need to scale now,
   // since the diagonal is not equal to
   // one now
-  for (int row = N - 1; row >= 0; --row)
-    {
-      // get end of this row
-      const size_type *const rowend =
-        &column_numbers[rowstart_indices[row + 1]];
-      // find the position where the part
-      // right of the diagonal starts
-      const size_type *const first_after_diagonal =
-        this->prebuilt_lower_bound[row];
-
-      somenumber    dst_row = dst(row);
-      const number *luval   = this->SparseMatrix<number>::val.get() +
-                            (first_after_diagonal - column_numbers);
-      for (const size_type *col = first_after_diagonal; col != rowend;
-           ++col, ++luval)
-        dst_row -= *luval * dst(*col);
-
-      // scale by the diagonal element.
-      // note that the diagonal element
-      // was stored inverted
-      dst(row) = dst_row * this->diag_element(row);
-    }
+  this->apply_in_substitution_order(true, [&](const size_type row) {
+    // get end of this row
+    const size_type *const rowend = &column_numbers[rowstart_indices[row + 1]];
+    // find the position where the part
+    // right of the diagonal starts
+    const size_type *const first_after_diagonal =
+      this->prebuilt_lower_bound[row];
+
+    somenumber    dst_row = dst(row);
+    const number *luval   = this->SparseMatrix<number>::val.get() +
+                          (first_after_diagonal - column_numbers);
+    for (const size_type *col = first_after_diagonal; col != rowend;
+         ++col, ++luval)
+      dst_row -= *luval * dst(*col);
+
+    // scale by the diagonal element.
+    // note that the diagonal element
+    // was stored inverted
+    dst(row) = dst_row * this->diag_element(row);
+  });
 }
 
 
@@ -1192,6 +1192,35 @@ public:
   void
   Tvmult_add(OutVector &dst, const InVector &src) const;
 
+  /**
+   * Matrix-vector multiplication with several vectors at once: let
+   * <i>dst.block(i) = M*src.block(i)</i> for all blocks <i>i</i> of the
+   * block vectors, with <i>M</i> being this matrix. In other words, each
+   * block of @p src and @p dst represents one vector of size n() and m(),
+   * respectively, as opposed to vmult(), which interprets a block vector as
+   * one long vector.
+   *
+   * Compared to calling vmult() for each block separately, this function
+   * reads the matrix only once. To this end, the entries of @p src are first
+   * copied into an interleaved array, such that the entries of all vectors
+   * at a given index are adjacent in memory and can be used together with
+   * each matrix entry. Since matrix-vector products are limited by the
+   * memory bandwidth, this reduces the cost per vector considerably if
+   * several vectors are to be multiplied, e.g., in block Krylov methods or
+   * for multiple right hand sides.
+   *
+   * This function can be used with BlockVector and
+   * LinearAlgebra::distributed::BlockVector objects. In the latter case, the
+   * blocks must not be distributed over several processes.
+   *
+   * Source and destination must not be the same vector.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename BlockVectorType>
+  void
+  multi_vmult(BlockVectorType &dst, const BlockVectorType &src) const;
+
   /**
    * Return the square of the norm of the vector $v$ with respect to the norm
    * induced by this matrix, i.e. $\left(v,Mv\right)$. This is useful, e.g. in
@@ -1392,6 +1421,64 @@ public:
                     const Vector<somenumber> &src,
                     const number              omega = 1.) const;
 
+  /**
+   * Apply SSOR preconditioning to <tt>src</tt> with damping <tt>omega</tt>,
+   * visiting the rows in the multicolored ordering given by
+   * <tt>colored_rows</tt>. The forward sweep processes the colors in the
+   * order given, the backward sweep in reverse order.
+   *
+   * Each entry of <tt>colored_rows</tt> lists the rows of one color, and no
+   * two rows of the same color may be coupled by an off-diagonal entry of the
+   * matrix, as computed e.g. by SparsityTools::make_greedy_coloring(). Since
+   * the rows of one color are independent of each other, they are processed
+   * in parallel using parallel::apply_to_subranges(). The result is the SSOR
+   * preconditioner of the matrix renumbered color by color, which generally
+   * differs from the one of the original ordering.
+   *
+   * The vectors <tt>dst</tt> and <tt>src</tt> must not be the same object.
+   */
+  template <typename somenumber>
+  void
+  precondition_SSOR(
+    Vector<somenumber>                         &dst,
+    const Vector<somenumber>                   &src,
+    const number                                omega,
+    const std::vector<std::vector<size_type>> &colored_rows) const;
+
+  /**
+   * Apply SOR preconditioning matrix to <tt>src</tt>, visiting the rows in
+   * the multicolored ordering given by <tt>colored_rows</tt> and processing
+   * the rows of each color in parallel. See the multicolored
+   * precondition_SSOR() function for the requirements on
+   * <tt>colored_rows</tt>. The result is identical to the one of PSOR() with
+   * the permutation obtained by concatenating the rows of all colors.
+   *
+   * The vectors <tt>dst</tt> and <tt>src</tt> must not be the same object.
+   */
+  template <typename somenumber>
+  void
+  precondition_SOR(
+    Vector<somenumber>                         &dst,
+    const Vector<somenumber>                   &src,
+    const number                                omega,
+    const std::vector<std::vector<size_type>> &colored_rows) const;
+
+  /**
+   * Apply transpose SOR preconditioning matrix to <tt>src</tt>, visiting the
+   * colors of <tt>colored_rows</tt> in reverse order and processing the rows
+   * of each color in parallel. This is the transpose of the multicolored
+   * precondition_SOR() function.
+   *
+   * The vectors <tt>dst</tt> and <tt>src</tt> must not be the same object.
+   */
+  template <typename somenumber>
+  void
+  precondition_TSOR(
+    Vector<somenumber>                         &dst,
+    const Vector<somenumber>                   &src,
+    const number                                omega,
+    const std::vector<std::vector<size_type>> &colored_rows) const;
+
   /**
    * Perform SSOR preconditioning in-place.  Apply the preconditioner matrix
    * without copying to a second vector.  <tt>omega</tt> is the relaxation
@@ -1491,6 +1578,43 @@ public:
   SSOR_step(Vector<somenumber>       &v,
             const Vector<somenumber> &b,
             const number              omega = 1.) const;
+
+  /**
+   * Do one SOR step on <tt>v</tt> with right hand side <tt>b</tt>, visiting
+   * the rows in the multicolored ordering given by <tt>colored_rows</tt> and
+   * processing the rows of each color in parallel. See the multicolored
+   * precondition_SSOR() function for the requirements on
+   * <tt>colored_rows</tt>.
+   */
+  template <typename somenumber>
+  void
+  SOR_step(Vector<somenumber>                         &v,
+           const Vector<somenumber>                   &b,
+           const number                                omega,
+           const std::vector<std::vector<size_type>> &colored_rows) const;
+
+  /**
+   * Do one adjoint SOR step on <tt>v</tt> with right hand side <tt>b</tt>,
+   * visiting the colors of <tt>colored_rows</tt> in reverse order.
+   */
+  template <typename somenumber>
+  void
+  TSOR_step(Vector<somenumber>                         &v,
+            const Vector<somenumber>                   &b,
+            const number                                omega,
+            const std::vector<std::vector<size_type>> &colored_rows) const;
+
+  /**
+   * Do one SSOR step on <tt>v</tt> with right hand side <tt>b</tt> in the
+   * multicolored ordering given by <tt>colored_rows</tt>, by performing the
+   * multicolored TSOR_step() after the multicolored SOR_step().
+   */
+  template <typename somenumber>
+  void
+  SSOR_step(Vector<somenumber>                         &v,
+            const Vector<somenumber>                   &b,
+            const number                                omega,
+            const std::vector<std::vector<size_type>> &colored_rows) const;
   /** @} */
   /**
    * @name Iterators
@@ -849,6 +849,80 @@ SparseMatrix<number>::Tvmult_add(OutVector &dst, const InVector &src) const
 }
 
 
+
+
+template <typename number>
+template <typename BlockVectorType>
+void
+SparseMatrix<number>::multi_vmult(BlockVectorType       &dst,
+                                  const BlockVectorType &src) const
+{
+  using Number = typename BlockVectorType::value_type;
+
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(dst.n_blocks(), src.n_blocks());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  const unsigned int n_vectors = src.n_blocks();
+  if (n_vectors == 0)
+    return;
+
+  std::vector<const Number *> src_ptrs(n_vectors);
+  std::vector<Number *>       dst_ptrs(n_vectors);
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      Assert(m() == dst.block(v).size(),
+             ExcDimensionMismatch(m(), dst.block(v).size()));
+      Assert(n() == src.block(v).size(),
+             ExcDimensionMismatch(n(), src.block(v).size()));
+      AssertDimension(dst.block(v).locally_owned_size(), m());
+      AssertDimension(src.block(v).locally_owned_size(), n());
+      src_ptrs[v] = src.block(v).begin();
+      dst_ptrs[v] = dst.block(v).begin();
+    }
+
+  // copy the source vectors into an interleaved array, such that the entries
+  // with the same index are next to each other
+  std::vector<Number> interleaved_src(n() * n_vectors);
+  parallel::apply_to_subranges(
+    0U,
+    n(),
+    [&](const size_type begin, const size_type end) {
+      for (size_type i = begin; i < end; ++i)
+        for (unsigned int v = 0; v < n_vectors; ++v)
+          interleaved_src[i * n_vectors + v] = src_ptrs[v][i];
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+
+  // go through the matrix once and multiply each entry with the entries of
+  // all source vectors
+  const std::size_t *rowstart = cols->rowstart.get();
+  const size_type   *colnums  = cols->colnums.get();
+  parallel::apply_to_subranges(
+    0U,
+    m(),
+    [&](const size_type begin_row, const size_type end_row) {
+      std::vector<Number> sums(n_vectors);
+      for (size_type row = begin_row; row < end_row; ++row)
+        {
+          std::fill(sums.begin(), sums.end(), Number());
+          for (std::size_t j = rowstart[row]; j < rowstart[row + 1]; ++j)
+            {
+              const Number  value = Number(val[j]);
+              const Number *src_values =
+                interleaved_src.data() + colnums[j] * n_vectors;
+              for (unsigned int v = 0; v < n_vectors; ++v)
+                sums[v] += value * src_values[v];
+            }
+          for (unsigned int v = 0; v < n_vectors; ++v)
+            dst_ptrs[v][row] = sums[v];
+        }
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+}
+
+
 namespace internal
 {
   namespace SparseMatrixImplementation
@@ -1368,6 +1442,36 @@ namespace internal
           (void)matrix;
         }
     }
+
+
+
+    // call the given function for all rows listed in colored_rows, one color
+    // after the other (in reverse order if requested). since the rows of one
+    // color are not coupled to each other, the rows within a color are
+    // processed in parallel
+    template <typename RowFunction>
+    void
+    apply_to_colored_rows(
+      const std::vector<std::vector<size_type>> &colored_rows,
+      const bool                                 reverse_color_order,
+      const RowFunction                         &row_function)
+    {
+      const std::size_t n_colors = colored_rows.size();
+      for (std::size_t c = 0; c < n_colors; ++c)
+        {
+          const std::vector<size_type> &rows =
+            colored_rows[reverse_color_order ? n_colors - 1 - c : c];
+          parallel::apply_to_subranges(
+            std::size_t(0),
+            rows.size(),
+            [&rows, &row_function](const std::size_t begin,
+                                   const std::size_t end) {
+              for (std::size_t i = begin; i < end; ++i)
+                row_function(rows[i]);
+            },
+            minimum_parallel_grain_size);
+        }
+    }
   } // namespace SparseMatrixImplementation
 } // namespace internal
 
@@ -1581,6 +1685,133 @@ SparseMatrix<number>::precondition_TSOR(Vector<somenumber>       &dst,
 }
 
 
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::precondition_SSOR(
+  Vector<somenumber>                         &dst,
+  const Vector<somenumber>                   &src,
+  const number                                omega,
+  const std::vector<std::vector<size_type>> &colored_rows) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
+
+  // The rows of a color only couple to rows of other colors. If we start
+  // from a zero vector, the entries of the colors that have not been
+  // visited yet do not contribute, so we can sum over all off-diagonal
+  // entries of a row instead of only the ones of previous colors. The
+  // backward sweep must not see the values of the forward sweep, which is
+  // why we keep the latter in a temporary vector.
+  GrowingVectorMemory<Vector<somenumber>>            mem;
+  typename VectorMemory<Vector<somenumber>>::Pointer tmp(mem);
+  tmp->reinit(dst.size());
+
+  Vector<somenumber> &forward = *tmp;
+
+  // forward sweep
+  internal::SparseMatrixImplementation::apply_to_colored_rows(
+    colored_rows, false, [&](const size_type row) {
+      number s = 0;
+      for (size_type j = cols->rowstart[row] + 1; j < cols->rowstart[row + 1];
+           ++j)
+        s += val[j] * number(forward(cols->colnums[j]));
+
+      forward(row) = (src(row) - somenumber(s * omega)) /
+                     somenumber(val[cols->rowstart[row]]);
+    });
+
+  // backward sweep, including the multiplication by omega(2-omega)D
+  dst = somenumber();
+  internal::SparseMatrixImplementation::apply_to_colored_rows(
+    colored_rows, true, [&](const size_type row) {
+      number s = 0;
+      for (size_type j = cols->rowstart[row] + 1; j < cols->rowstart[row + 1];
+           ++j)
+        s += val[j] * number(dst(cols->colnums[j]));
+
+      const number diagonal = val[cols->rowstart[row]];
+      dst(row) =
+        (somenumber(omega * (number(2.) - omega) * diagonal) * forward(row) -
+         somenumber(s * omega)) /
+        somenumber(diagonal);
+    });
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::precondition_SOR(
+  Vector<somenumber>                         &dst,
+  const Vector<somenumber>                   &src,
+  const number                                omega,
+  const std::vector<std::vector<size_type>> &colored_rows) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
+
+  // start from a zero vector, such that the entries of the colors not yet
+  // visited do not contribute to the sums below (see precondition_SSOR())
+  dst = somenumber();
+  internal::SparseMatrixImplementation::apply_to_colored_rows(
+    colored_rows, false, [&](const size_type row) {
+      somenumber s = src(row);
+      for (size_type j = cols->rowstart[row] + 1; j < cols->rowstart[row + 1];
+           ++j)
+        s -= somenumber(val[j]) * dst(cols->colnums[j]);
+
+      dst(row) = s * somenumber(omega) / somenumber(val[cols->rowstart[row]]);
+    });
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::precondition_TSOR(
+  Vector<somenumber>                         &dst,
+  const Vector<somenumber>                   &src,
+  const number                                omega,
+  const std::vector<std::vector<size_type>> &colored_rows) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
+
+  dst = somenumber();
+  internal::SparseMatrixImplementation::apply_to_colored_rows(
+    colored_rows, true, [&](const size_type row) {
+      somenumber s = src(row);
+      for (size_type j = cols->rowstart[row] + 1; j < cols->rowstart[row + 1];
+           ++j)
+        s -= somenumber(val[j]) * dst(cols->colnums[j]);
+
+      dst(row) = s * somenumber(omega) / somenumber(val[cols->rowstart[row]]);
+    });
+}
+
+
 template <typename number>
 template <typename somenumber>
 void
@@ -1815,6 +2046,77 @@ SparseMatrix<number>::SSOR_step(Vector<somenumber>       &v,
 
 
 
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::SOR_step(
+  Vector<somenumber>                         &v,
+  const Vector<somenumber>                   &b,
+  const number                                omega,
+  const std::vector<std::vector<size_type>> &colored_rows) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  Assert(m() == v.size(), ExcDimensionMismatch(m(), v.size()));
+  Assert(m() == b.size(), ExcDimensionMismatch(m(), b.size()));
+
+  internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
+
+  internal::SparseMatrixImplementation::apply_to_colored_rows(
+    colored_rows, false, [&](const size_type row) {
+      somenumber s = b(row);
+      for (size_type j = cols->rowstart[row]; j < cols->rowstart[row + 1]; ++j)
+        s -= somenumber(val[j]) * v(cols->colnums[j]);
+      v(row) += s * somenumber(omega) / somenumber(val[cols->rowstart[row]]);
+    });
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::TSOR_step(
+  Vector<somenumber>                         &v,
+  const Vector<somenumber>                   &b,
+  const number                                omega,
+  const std::vector<std::vector<size_type>> &colored_rows) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  Assert(m() == v.size(), ExcDimensionMismatch(m(), v.size()));
+  Assert(m() == b.size(), ExcDimensionMismatch(m(), b.size()));
+
+  internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
+
+  internal::SparseMatrixImplementation::apply_to_colored_rows(
+    colored_rows, true, [&](const size_type row) {
+      somenumber s = b(row);
+      for (size_type j = cols->rowstart[row]; j < cols->rowstart[row + 1]; ++j)
+        s -= somenumber(val[j]) * v(cols->colnums[j]);
+      v(row) += s * somenumber(omega) / somenumber(val[cols->rowstart[row]]);
+    });
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::SSOR_step(
+  Vector<somenumber>                         &v,
+  const Vector<somenumber>                   &b,
+  const number                                omega,
+  const std::vector<std::vector<size_type>> &colored_rows) const
+{
+  SOR_step(v, b, omega, colored_rows);
+  TSOR_step(v, b, omega, colored_rows);
+}
+
+
+
 template <typename number>
 template <typename somenumber>
 void
@@ -156,6 +156,25 @@ namespace SparsityTools
   color_sparsity_pattern(const SparsityPattern     &sparsity_pattern,
                          std::vector<unsigned int> &color_indices);
 
+  /**
+   * Compute a coloring of the rows of a square sparsity pattern such that no
+   * two rows of the same color are coupled, i.e., rows $i\neq j$ get
+   * different colors whenever $(i,j)$ or $(j,i)$ is an entry of
+   * @p sparsity_pattern. In contrast to color_sparsity_pattern(), the
+   * pattern need not be symmetric, and the function does not need ZOLTAN:
+   * It uses a simple greedy algorithm that visits the rows in ascending
+   * order and assigns each row the smallest color not used by any of its
+   * neighbors that have already been colored.
+   *
+   * The function returns the rows grouped by color, i.e., the $c$-th entry
+   * of the returned vector contains all rows of color $c$ in ascending
+   * order. This is the format expected by the multicolored relaxation
+   * methods of SparseMatrix such as SparseMatrix::precondition_SOR(), which
+   * process the rows of one color in parallel.
+   */
+  std::vector<std::vector<SparsityPattern::size_type>>
+  make_greedy_coloring(const SparsityPattern &sparsity_pattern);
+
   /**
    * For a given sparsity pattern, compute a re-enumeration of row/column
    * indices based on the algorithm by Cuthill-McKee.
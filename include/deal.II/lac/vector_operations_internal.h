@@ -20,15 +20,18 @@
 
 #include <deal.II/base/memory_space.h>
 #include <deal.II/base/memory_space_data.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/multithread_info.h>
 #include <deal.II/base/parallel.h>
 #include <deal.II/base/types.h>
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/vector_operation.h>
+#include <deal.II/lac/vector_type_traits.h>
 
 #include <Kokkos_Core.hpp>
 
+#include <array>
 #include <cstdio>
 #include <cstring>
 
@@ -747,6 +750,18 @@ namespace internal
 
 
 
+    // The type in which sums over vector entries are accumulated. This is the
+    // number type itself, except for 16-bit storage types like _Float16,
+    // whose sums are accumulated in the single-precision real_type set by
+    // numbers::NumberTraits to avoid overflow and loss of accuracy.
+    template <typename Number>
+    using AccumulationType = std::conditional_t<
+      numbers::NumberTraits<Number>::is_complex,
+      Number,
+      typename numbers::NumberTraits<Number>::real_type>;
+
+
+
     // All sums over all the vector entries (l2-norm, inner product, etc.) are
     // performed with the same code, using a templated operation defined
     // here. There are always two versions defined, a standard one that covers
@@ -763,10 +778,12 @@ namespace internal
         , Y(Y)
       {}
 
-      Number
+      AccumulationType<Number>
       operator()(const size_type i) const
       {
-        return X[i] * Number(numbers::NumberTraits<Number2>::conjugate(Y[i]));
+        return AccumulationType<Number>(X[i]) *
+               AccumulationType<Number>(
+                 numbers::NumberTraits<Number2>::conjugate(Y[i]));
       }
 
       VectorizedArray<Number>
@@ -882,7 +899,7 @@ namespace internal
         : X(X)
       {}
 
-      Number
+      AccumulationType<Number>
       operator()(const size_type i) const
       {
         return X[i];
@@ -914,11 +931,13 @@ namespace internal
         , a(a)
       {}
 
-      Number
+      AccumulationType<Number>
       operator()(const size_type i) const
       {
         X[i] += a * V[i];
-        return X[i] * Number(numbers::NumberTraits<Number>::conjugate(W[i]));
+        return AccumulationType<Number>(X[i]) *
+               AccumulationType<Number>(
+                 numbers::NumberTraits<Number>::conjugate(W[i]));
       }
 
       VectorizedArray<Number>
@@ -1287,6 +1306,169 @@ namespace internal
 
 
 
+    // Fused vector operations: Krylov solvers typically issue several vector
+    // updates and inner products in a row, each of which streams all vector
+    // entries from memory. If the operations run over the same index range
+    // and each entry only depends on the entries with the same index, they
+    // can be combined into a single loop through the vectors, given by a
+    // kernel that performs all operations on some entries at a time, see
+    // fused_update_and_reduce() further down. The following classes and
+    // functions implement the accumulation of the sums computed by such a
+    // kernel with the same chunking and pairwise summation as the other
+    // reductions in this file, which allows to use the parallel_reduce()
+    // function also for fused operations.
+
+    /**
+     * The sums computed by a fused vector operation.
+     */
+    template <typename Number, std::size_t n_results>
+    struct FusedSums
+    {
+      FusedSums &
+      operator+=(const FusedSums &other)
+      {
+        for (unsigned int i = 0; i < n_results; ++i)
+          values[i] += other.values[i];
+        return *this;
+      }
+
+      FusedSums
+      operator+(const FusedSums &other) const
+      {
+        FusedSums result = *this;
+        result += other;
+        return result;
+      }
+
+      std::array<Number, n_results> values = {};
+    };
+
+
+
+    /**
+     * A wrapper around the kernel of a fused vector operation that selects
+     * the overload of accumulate_recursive() below.
+     */
+    template <typename Number, std::size_t n_results, typename Kernel>
+    struct FusedOperation
+    {
+      const Kernel &kernel;
+    };
+
+
+
+    /**
+     * Load the vector entries starting at @p ptr into an object of type @p T,
+     * which is either the scalar type @p Number (one entry) or
+     * VectorizedArray<Number> (as many entries as there are lanes). This is
+     * used by the kernels of fused vector operations, which get called for
+     * both types.
+     */
+    template <typename T, typename Number>
+    DEAL_II_ALWAYS_INLINE inline T
+    fused_load(const Number *ptr)
+    {
+      if constexpr (std::is_same_v<T, Number>)
+        return *ptr;
+      else
+        {
+          T value;
+          value.load(ptr);
+          return value;
+        }
+    }
+
+
+
+    /**
+     * Store @p value to the vector entries starting at @p ptr, the inverse
+     * operation of fused_load().
+     */
+    template <typename T, typename Number>
+    DEAL_II_ALWAYS_INLINE inline void
+    fused_store(const T &value, Number *ptr)
+    {
+      if constexpr (std::is_same_v<T, Number>)
+        *ptr = value;
+      else
+        value.store(ptr);
+    }
+
+
+
+    // The accumulation of fused operations: Runs the kernel in chunks of 32
+    // entries on all lanes of VectorizedArray and on the remaining entries
+    // with scalars, and sums the results of the chunks pairwise, splitting
+    // long ranges recursively like the other accumulate_recursive() function
+    // above.
+    template <typename Number, std::size_t n_results, typename Kernel>
+    void
+    accumulate_recursive(const FusedOperation<Number, n_results, Kernel> &op,
+                         const size_type                                  first,
+                         const size_type                                  last,
+                         FusedSums<Number, n_results> &result)
+    {
+      const size_type vec_size = last - first;
+      if (vec_size == 0)
+        {
+          result = FusedSums<Number, n_results>();
+          return;
+        }
+
+      if (vec_size <= vector_accumulation_recursion_threshold * 32)
+        {
+          FusedSums<Number, n_results>
+            outer_results[vector_accumulation_recursion_threshold * 2];
+
+          constexpr unsigned int n_lanes = VectorizedArray<Number>::size();
+          static_assert(n_lanes <= 16 && 16 % n_lanes == 0,
+                        "VectorizedArray::size() must be 1, 2, 4, 8, or 16");
+
+          size_type n_chunks = 0;
+          size_type index    = first;
+          for (; index + 32 <= last; index += 32, ++n_chunks)
+            {
+              std::array<VectorizedArray<Number>, n_results> sums = {};
+              for (unsigned int j = 0; j < 32; j += n_lanes)
+                op.kernel(index + j, sums);
+              for (unsigned int i = 0; i < n_results; ++i)
+                outer_results[n_chunks].values[i] = sums[i].sum();
+            }
+          if (index < last)
+            {
+              std::array<Number, n_results> sums = {};
+              for (; index < last; ++index)
+                op.kernel(index, sums);
+              outer_results[n_chunks++].values = sums;
+            }
+
+          AssertIndexRange(n_chunks,
+                           vector_accumulation_recursion_threshold + 1);
+          size_type j = 0;
+          for (; j + 1 < n_chunks; j += 2, ++n_chunks)
+            outer_results[n_chunks] = outer_results[j] + outer_results[j + 1];
+          result = outer_results[n_chunks - 1];
+        }
+      else
+        {
+          const size_type new_size =
+            (vec_size / (vector_accumulation_recursion_threshold * 32)) *
+            vector_accumulation_recursion_threshold * 8;
+          Assert(first + 3 * new_size < last, ExcInternalError());
+          FusedSums<Number, n_results> r0, r1, r2, r3;
+          accumulate_recursive(op, first, first + new_size, r0);
+          accumulate_recursive(op, first + new_size, first + 2 * new_size, r1);
+          accumulate_recursive(op,
+                               first + 2 * new_size,
+                               first + 3 * new_size,
+                               r2);
+          accumulate_recursive(op, first + 3 * new_size, last, r3);
+          result = (r0 + r1) + (r2 + r3);
+        }
+    }
+
+
+
 #ifdef DEAL_II_WITH_TBB
     /**
      * This struct takes the loop range from the tbb parallel for loop and
@@ -1462,6 +1644,109 @@ namespace internal
     }
 
 
+
+    /**
+     * Run a fused vector operation on the index range [0, @p size) in a
+     * single pass and return the @p n_results sums it computes, accumulated
+     * over all entries and threads but not over MPI processes. This is used
+     * by iterative solvers to combine several vector updates and inner
+     * products, e.g., $x \leftarrow x + \alpha p$, $r \leftarrow r - \alpha
+     * q$ and the computation of $r^T r$ and $r^T z$, into one loop, which
+     * reduces the memory traffic if some vectors appear in more than one of
+     * the operations.
+     *
+     * The functor @p kernel gets called as <code>kernel(i, sums)</code> where
+     * <code>sums</code> is of type <code>std::array<T, n_results></code>. The
+     * kernel must perform all operations on the entries starting at index
+     * <code>i</code>, loading and storing them with fused_load() and
+     * fused_store(), and add its contribution to the sums. The kernel is
+     * called with <code>T = VectorizedArray<Number></code>, working on as many
+     * entries as there are lanes, and with <code>T = Number</code> for the
+     * remaining entries, so it is typically written as a generic lambda:
+     * @code
+     * const std::array<double, 2> sums =
+     *   fused_update_and_reduce<double, 2>(
+     *     partitioner, size, [&](const auto i, auto &sums) {
+     *       using T = std::decay_t<decltype(sums[0])>;
+     *       const T ri = fused_load<T>(r + i) - alpha * fused_load<T>(q + i);
+     *       fused_store(ri, r + i);
+     *       sums[0] += ri * ri;
+     *       sums[1] += ri * fused_load<T>(z + i);
+     *     });
+     * @endcode
+     * The kernel must only access the entries starting at index <code>i</code>
+     * of the vectors, such that the loop can be split among threads. The sums
+     * are computed with the same pairwise summation and in the same order as
+     * the other reductions in this file, i.e., the result is deterministic for
+     * a fixed number of threads.
+     */
+    template <typename Number, std::size_t n_results, typename Kernel>
+    std::array<Number, n_results>
+    fused_update_and_reduce(
+      const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
+                     &partitioner,
+      const size_type size,
+      const Kernel   &kernel)
+    {
+      FusedSums<Number, n_results> result;
+      parallel_reduce(FusedOperation<Number, n_results, Kernel>{kernel},
+                      0,
+                      size,
+                      result,
+                      partitioner);
+      return result.values;
+    }
+
+
+
+    /**
+     * Run a fused vector operation on the locally owned entries of
+     * @p vector like fused_update_and_reduce() and sum the results over all
+     * MPI processes of the communicator of @p vector. The pointers the kernel
+     * works on must refer to vectors with the same parallel layout as
+     * @p vector.
+     */
+    template <std::size_t n_results, typename VectorType, typename Kernel>
+    std::array<typename VectorType::value_type, n_results>
+    fused_update_and_reduce_global(
+      const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
+                       &partitioner,
+      const VectorType &vector,
+      const Kernel     &kernel)
+    {
+      using Number = typename VectorType::value_type;
+      std::array<Number, n_results> sums =
+        fused_update_and_reduce<Number, n_results>(
+          partitioner, vector.locally_owned_size(), kernel);
+      if constexpr (n_results > 0)
+        Utilities::MPI::sum(ArrayView<const Number>(sums.data(), n_results),
+                            vector.get_mpi_communicator(),
+                            ArrayView<Number>(sums.data(), n_results));
+      return sums;
+    }
+
+
+
+    /**
+     * The fused operations write the locally owned entries through raw
+     * pointers, which does not update the ghost entries like Vector::add()
+     * and similar functions do for vectors in ghosted state. Call this
+     * function with the vectors written by a fused operation to bring the
+     * ghost entries of those in ghosted state up to date.
+     */
+    template <typename... VectorTypes>
+    void
+    update_ghost_values_after_fused_operation(VectorTypes &...vectors)
+    {
+      const auto update = [](auto &vector) {
+        if (vector.has_ghost_elements())
+          vector.update_ghost_values();
+      };
+      (update(vectors), ...);
+    }
+
+
+
     template <typename Number, typename Number2, typename MemorySpace>
     struct functions
     {
@@ -1956,7 +2241,7 @@ namespace internal
         parallel_for(vector_equ, 0, size, thread_loop_partitioner);
       }
 
-      static Number
+      static AccumulationType<Number>
       dot(const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
                          &thread_loop_partitioner,
           const size_type size,
@@ -1966,7 +2251,7 @@ namespace internal
                                                  ::dealii::MemorySpace::Host>
             &data)
       {
-        Number                                                   sum;
+        AccumulationType<Number>                                 sum;
         dealii::internal::VectorOperations::Dot<Number, Number2> dot(
           data.values.data(), v_data.values.data());
         dealii::internal::VectorOperations::parallel_reduce(
@@ -1990,7 +2275,7 @@ namespace internal
         parallel_reduce(norm2, 0, size, sum, thread_loop_partitioner);
       }
 
-      static Number
+      static AccumulationType<Number>
       mean_value(
         const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
                        &thread_loop_partitioner,
@@ -1998,8 +2283,8 @@ namespace internal
         const ::dealii::MemorySpace::
           MemorySpaceData<Number, ::dealii::MemorySpace::Host> &data)
       {
-        Number            sum;
-        MeanValue<Number> mean(data.values.data());
+        AccumulationType<Number> sum;
+        MeanValue<Number>        mean(data.values.data());
         parallel_reduce(mean, 0, size, sum, thread_loop_partitioner);
 
         return sum;
@@ -2039,7 +2324,7 @@ namespace internal
         parallel_reduce(normp, 0, size, sum, thread_loop_partitioner);
       }
 
-      static Number
+      static AccumulationType<Number>
       add_and_dot(
         const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
                        &thread_loop_partitioner,
@@ -2053,11 +2338,11 @@ namespace internal
                                                ::dealii::MemorySpace::Host>
           &data)
       {
-        Number            sum;
-        AddAndDot<Number> adder(data.values.data(),
-                                v_data.values.data(),
-                                w_data.values.data(),
-                                a);
+        AccumulationType<Number> sum;
+        AddAndDot<Number>        adder(data.values.data(),
+                                       v_data.values.data(),
+                                       w_data.values.data(),
+                                       a);
         parallel_reduce(adder, 0, size, sum, thread_loop_partitioner);
 
         return sum;
@@ -46,6 +46,24 @@ template <typename T>
 struct is_serial_vector;
 
 
+namespace internal
+{
+  namespace VectorOperations
+  {
+    /**
+     * Whether the iterative solvers can combine vector updates and inner
+     * products on vectors of type @p VectorType into a single pass through
+     * the vectors with fused_update_and_reduce(), which works on the raw
+     * vector entries. The default is false; vector classes that store their
+     * locally owned entries contiguously in host memory specialize this
+     * variable in the header file of the vector declaration.
+     */
+    template <typename VectorType>
+    constexpr bool supports_fused_operations = false;
+  } // namespace VectorOperations
+} // namespace internal
+
+
 DEAL_II_NAMESPACE_CLOSE
 
 #endif
@@ -0,0 +1,547 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_cell_block_jacobi_h
+#define dealii_matrix_free_cell_block_jacobi_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/batched_dense_kernels.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace MatrixFreeOperators
+{
+  /**
+   * A block Jacobi preconditioner for operators discretized with
+   * discontinuous elements, operating on the cells of a MatrixFree object.
+   * The blocks are the couplings between the degrees of freedom of a cell,
+   * i.e., the action of the preconditioner is
+   * @f[
+   * P^{-1} = \omega \sum_{c} R_c^T A_c^{-1} R_c,
+   * @f]
+   * with the restriction $R_c$ to the degrees of freedom of cell $c$, the
+   * cell block $A_c$ of the matrix, and the relaxation parameter $\omega$.
+   * Since the degrees of freedom of discontinuous elements are not shared
+   * between cells, the blocks do not overlap.
+   *
+   * The cell blocks are computed from the operator in the same way as
+   * MatrixFreeTools::compute_diagonal() does for the diagonal, by applying
+   * the user-provided cell operation, and optionally a face operation for
+   * the face integrals of discontinuous Galerkin methods, to the unit
+   * vectors of the cell. All operations on the blocks work on the
+   * VectorizedArrayType::size() cells of a cell batch at once with the
+   * functions in BatchedDenseKernels: the blocks are either inverted or
+   * factorized, and the application of the preconditioner is a
+   * matrix-vector product or a pair of triangular solves per cell batch,
+   * respectively. As the kernels do not use pivoting, the blocks must allow
+   * for Gaussian elimination without pivoting, which is the case for the
+   * usual discretizations of elliptic operators.
+   *
+   * @tparam dim The space dimension.
+   * @tparam n_components The number of components of the finite element.
+   * @tparam Number The number type of the vectors and the cell blocks.
+   * @tparam VectorizedArrayType The vectorized number type of the
+   * MatrixFree object.
+   */
+  template <int dim,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType = VectorizedArray<Number>>
+  class PreconditionCellBlockJacobi
+  {
+  public:
+    /**
+     * The vector type the preconditioner works on.
+     */
+    using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+    /**
+     * The type of the MatrixFree object.
+     */
+    using MatrixFreeType = MatrixFree<dim, Number, VectorizedArrayType>;
+
+    /**
+     * The type of the evaluator passed to the cell operation.
+     */
+    using CellEvaluatorType =
+      FEEvaluation<dim, -1, 0, n_components, Number, VectorizedArrayType>;
+
+    /**
+     * The type of the evaluator passed to the face operation.
+     */
+    using FaceEvaluatorType =
+      FEFaceEvaluation<dim, -1, 0, n_components, Number, VectorizedArrayType>;
+
+    /**
+     * The way the cell blocks are stored and applied.
+     */
+    enum class BlockSolver
+    {
+      /**
+       * Compute the inverse of the blocks with
+       * BatchedDenseKernels::invert() and apply it by a matrix-vector
+       * product.
+       */
+      inverse,
+      /**
+       * Compute an LU factorization of the blocks with
+       * BatchedDenseKernels::lu_factorize() and apply it by forward and
+       * backward substitution.
+       */
+      lu,
+      /**
+       * Compute a Cholesky factorization of the blocks with
+       * BatchedDenseKernels::cholesky_factorize() and apply it by forward
+       * and backward substitution. The blocks must be symmetric and
+       * positive definite.
+       */
+      cholesky
+    };
+
+    /**
+     * Standardized data struct to pipe additional parameters to the
+     * preconditioner.
+     */
+    struct AdditionalData
+    {
+      /**
+       * Constructor.
+       */
+      AdditionalData(
+        const std::function<void(CellEvaluatorType &)> &cell_operation = {},
+        const std::function<void(FaceEvaluatorType &)> &face_operation = {},
+        const BlockSolver  block_solver      = BlockSolver::inverse,
+        const double       relaxation        = 1.,
+        const unsigned int dof_handler_index = 0,
+        const unsigned int quadrature_index  = 0)
+        : cell_operation(cell_operation)
+        , face_operation(face_operation)
+        , block_solver(block_solver)
+        , relaxation(relaxation)
+        , dof_handler_index(dof_handler_index)
+        , quadrature_index(quadrature_index)
+      {}
+
+      /**
+       * The cell integral of the operator. The function gets an evaluator
+       * that is set to a cell batch and holds the input values in its
+       * degrees of freedom, e.g., `phi.evaluate(EvaluationFlags::gradients)`
+       * followed by a loop over the quadrature points and
+       * `phi.integrate(EvaluationFlags::gradients)`, and must leave the
+       * result in the degrees of freedom of the evaluator. This is the same
+       * function as passed to MatrixFreeTools::compute_diagonal().
+       */
+      std::function<void(CellEvaluatorType &)> cell_operation;
+
+      /**
+       * The face integrals of the operator that couple the degrees of
+       * freedom of a cell with themselves, or an empty function if the
+       * operator only consists of cell integrals. The function gets an
+       * evaluator that is set to a face of a cell batch with
+       * FEFaceEvaluation::reinit(cell_batch_index, face_number) and holds
+       * the input values in the degrees of freedom of the cell, and must
+       * leave the result in the same place. The values on the neighbor are
+       * zero by definition of the block. Whether the face is at the
+       * boundary can be queried with
+       * MatrixFree::get_faces_by_cells_boundary_id(). Using a face operation
+       * requires that the MatrixFree object has been set up with
+       * MatrixFree::AdditionalData::mapping_update_flags_faces_by_cells,
+       * and with MatrixFree::AdditionalData::mapping_update_flags_inner_faces
+       * or MatrixFree::AdditionalData::mapping_update_flags_boundary_faces
+       * such that the faces are set up in the first place.
+       */
+      std::function<void(FaceEvaluatorType &)> face_operation;
+
+      /**
+       * The way the cell blocks are stored and applied.
+       */
+      BlockSolver block_solver;
+
+      /**
+       * The relaxation parameter $\omega$ the result is multiplied with.
+       */
+      double relaxation;
+
+      /**
+       * The index of the DoFHandler within the MatrixFree object the
+       * vectors are associated with.
+       */
+      unsigned int dof_handler_index;
+
+      /**
+       * The index of the quadrature formula within the MatrixFree object
+       * the cell and face operations are evaluated with.
+       */
+      unsigned int quadrature_index;
+    };
+
+    /**
+     * Constructor. Does nothing.
+     */
+    PreconditionCellBlockJacobi() = default;
+
+    /**
+     * Compute and factorize the cell blocks of the operator given by the
+     * cell and face operations in @p additional_data on the cells of
+     * @p matrix_free. The finite element of the selected DoFHandler must be
+     * discontinuous.
+     */
+    void
+    initialize(const MatrixFreeType &matrix_free,
+               const AdditionalData &additional_data);
+
+    /**
+     * Set up the preconditioner for the MatrixFree object of @p matrix,
+     * which must provide a function `get_matrix_free()` returning a pointer
+     * to it, as the classes derived from MatrixFreeOperators::Base do. This
+     * is the interface used by MGSmootherPrecondition.
+     */
+    template <typename MatrixType>
+    void
+    initialize(const MatrixType &matrix, const AdditionalData &additional_data);
+
+    /**
+     * Release all memory and return to a state just like after having
+     * called the default constructor.
+     */
+    void
+    clear();
+
+    /**
+     * Apply the preconditioner to @p src and write the result into @p dst.
+     */
+    void
+    vmult(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Apply the transpose of the preconditioner to @p src and write the
+     * result into @p dst. Not implemented for BlockSolver::lu.
+     */
+    void
+    Tvmult(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Return the memory consumption of this class in bytes.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Apply the inverse of the cell blocks, or their transpose, on a range
+     * of cell batches.
+     */
+    template <bool transpose>
+    void
+    local_apply_inverse(
+      const MatrixFreeType                        &matrix_free,
+      VectorType                                  &dst,
+      const VectorType                            &src,
+      const std::pair<unsigned int, unsigned int> &cell_range) const;
+
+    /**
+     * Pointer to the MatrixFree object.
+     */
+    ObserverPointer<const MatrixFreeType> matrix_free;
+
+    /**
+     * The parameters of the preconditioner.
+     */
+    AdditionalData additional_data;
+
+    /**
+     * The inverses or factorizations of the cell blocks of each cell batch.
+     */
+    std::vector<Table<2, VectorizedArrayType>> cell_blocks;
+  };
+
+
+
+  // ------------------------------ inline functions ---------------------
+
+
+
+  template <int dim,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  inline void
+  PreconditionCellBlockJacobi<dim, n_components, Number, VectorizedArrayType>::
+    initialize(const MatrixFreeType &matrix_free,
+               const AdditionalData &additional_data)
+  {
+    AssertThrow(additional_data.cell_operation,
+                ExcMessage("The cell blocks can only be computed with a "
+                           "cell operation."));
+
+    this->matrix_free     = &matrix_free;
+    this->additional_data = additional_data;
+
+    const unsigned int        dof_index = additional_data.dof_handler_index;
+    const FiniteElement<dim> &fe =
+      matrix_free.get_dof_handler(dof_index).get_fe();
+    AssertThrow(fe.n_dofs_per_face() == 0,
+                ExcMessage("The cell block Jacobi preconditioner is only "
+                           "implemented for discontinuous elements."));
+
+    CellEvaluatorType phi(matrix_free,
+                          dof_index,
+                          additional_data.quadrature_index);
+    std::unique_ptr<FaceEvaluatorType> phi_face;
+    if (additional_data.face_operation)
+      phi_face =
+        std::make_unique<FaceEvaluatorType>(matrix_free,
+                                            true,
+                                            dof_index,
+                                            additional_data.quadrature_index);
+
+    const unsigned int n_dofs = phi.dofs_per_cell;
+    const unsigned int n_faces = fe.reference_cell().n_faces();
+
+    cell_blocks.resize(matrix_free.n_cell_batches());
+    for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+      {
+        Table<2, VectorizedArrayType> &block = cell_blocks[cell];
+        block.reinit(n_dofs, n_dofs);
+
+        // apply the operator to the unit vectors of the cell, one column
+        // of the block at a time
+        phi.reinit(cell);
+        for (unsigned int j = 0; j < n_dofs; ++j)
+          {
+            for (unsigned int i = 0; i < n_dofs; ++i)
+              phi.begin_dof_values()[i] = VectorizedArrayType();
+            phi.begin_dof_values()[j] = Number(1.);
+            additional_data.cell_operation(phi);
+            for (unsigned int i = 0; i < n_dofs; ++i)
+              block(i, j) = phi.begin_dof_values()[i];
+          }
+
+        if (phi_face)
+          for (unsigned int face = 0; face < n_faces; ++face)
+            {
+              phi_face->reinit(cell, face);
+              for (unsigned int j = 0; j < n_dofs; ++j)
+                {
+                  for (unsigned int i = 0; i < n_dofs; ++i)
+                    phi_face->begin_dof_values()[i] = VectorizedArrayType();
+                  phi_face->begin_dof_values()[j] = Number(1.);
+                  additional_data.face_operation(*phi_face);
+                  for (unsigned int i = 0; i < n_dofs; ++i)
+                    block(i, j) += phi_face->begin_dof_values()[i];
+                }
+            }
+
+        // fill unused lanes with the identity matrix to keep the blocks
+        // invertible
+        for (unsigned int v = matrix_free.n_active_entries_per_cell_batch(cell);
+             v < VectorizedArrayType::size();
+             ++v)
+          for (unsigned int i = 0; i < n_dofs; ++i)
+            for (unsigned int j = 0; j < n_dofs; ++j)
+              block(i, j)[v] = (i == j) ? Number(1.) : Number(0.);
+
+        switch (additional_data.block_solver)
+          {
+            case BlockSolver::inverse:
+              BatchedDenseKernels::invert(block);
+              break;
+            case BlockSolver::lu:
+              BatchedDenseKernels::lu_factorize(block);
+              break;
+            case BlockSolver::cholesky:
+              BatchedDenseKernels::cholesky_factorize(block);
+              break;
+            default:
+              DEAL_II_NOT_IMPLEMENTED();
+          }
+      }
+  }
+
+
+
+  template <int dim,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  template <typename MatrixType>
+  inline void
+  PreconditionCellBlockJacobi<dim, n_components, Number, VectorizedArrayType>::
+    initialize(const MatrixType &matrix, const AdditionalData &additional_data)
+  {
+    initialize(*matrix.get_matrix_free(), additional_data);
+  }
+
+
+
+  template <int dim,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  inline void
+  PreconditionCellBlockJacobi<dim, n_components, Number, VectorizedArrayType>::
+    clear()
+  {
+    matrix_free = nullptr;
+    cell_blocks.clear();
+  }
+
+
+
+  template <int dim,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  inline void
+  PreconditionCellBlockJacobi<dim, n_components, Number, VectorizedArrayType>::
+    vmult(VectorType &dst, const VectorType &src) const
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+
+    matrix_free->cell_loop(
+      &PreconditionCellBlockJacobi::template local_apply_inverse<false>,
+      this,
+      dst,
+      src,
+      true);
+  }
+
+
+
+  template <int dim,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  inline void
+  PreconditionCellBlockJacobi<dim, n_components, Number, VectorizedArrayType>::
+    Tvmult(VectorType &dst, const VectorType &src) const
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+    AssertThrow(additional_data.block_solver != BlockSolver::lu,
+                ExcNotImplemented());
+
+    matrix_free->cell_loop(
+      &PreconditionCellBlockJacobi::template local_apply_inverse<true>,
+      this,
+      dst,
+      src,
+      true);
+  }
+
+
+
+  template <int dim,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  inline std::size_t
+  PreconditionCellBlockJacobi<dim, n_components, Number, VectorizedArrayType>::
+    memory_consumption() const
+  {
+    return MemoryConsumption::memory_consumption(cell_blocks);
+  }
+
+
+
+  template <int dim,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  template <bool transpose>
+  inline void
+  PreconditionCellBlockJacobi<dim, n_components, Number, VectorizedArrayType>::
+    local_apply_inverse(
+      const MatrixFreeType                        &matrix_free,
+      VectorType                                  &dst,
+      const VectorType                            &src,
+      const std::pair<unsigned int, unsigned int> &cell_range) const
+  {
+    CellEvaluatorType phi(matrix_free,
+                          additional_data.dof_handler_index,
+                          additional_data.quadrature_index);
+    AlignedVector<VectorizedArrayType> local_src(phi.dofs_per_cell);
+
+    const ArrayView<VectorizedArrayType> local_dst(phi.begin_dof_values(),
+                                                   phi.dofs_per_cell);
+    const ArrayView<const VectorizedArrayType> local_src_view(
+      local_src.data(), local_src.size());
+    const VectorizedArrayType relaxation =
+      static_cast<Number>(additional_data.relaxation);
+
+    for (unsigned int cell = cell_range.first; cell < cell_range.second;
+         ++cell)
+      {
+        phi.reinit(cell);
+        phi.read_dof_values(src);
+
+        switch (additional_data.block_solver)
+          {
+            case BlockSolver::inverse:
+              for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+                local_src[i] = phi.begin_dof_values()[i];
+              if (transpose)
+                BatchedDenseKernels::Tvmult(cell_blocks[cell],
+                                            local_dst,
+                                            local_src_view);
+              else
+                BatchedDenseKernels::vmult(cell_blocks[cell],
+                                           local_dst,
+                                           local_src_view);
+              break;
+            case BlockSolver::lu:
+              BatchedDenseKernels::lu_solve(cell_blocks[cell], local_dst);
+              break;
+            case BlockSolver::cholesky:
+              BatchedDenseKernels::cholesky_solve(cell_blocks[cell],
+                                                  local_dst);
+              break;
+            default:
+              DEAL_II_NOT_IMPLEMENTED();
+          }
+
+        if (additional_data.relaxation != 1.)
+          for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+            phi.begin_dof_values()[i] *= relaxation;
+
+        phi.distribute_local_to_global(dst);
+      }
+  }
+} // end of namespace MatrixFreeOperators
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,509 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_cell_patch_schwarz_h
+#define dealii_matrix_free_cell_patch_schwarz_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/tensor_product_matrix_creator.h>
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace MatrixFreeOperators
+{
+  /**
+   * An additive Schwarz preconditioner for the constant-coefficient Laplace
+   * operator discretized with FE_Q elements on (nearly) Cartesian meshes,
+   * operating on the cells of a MatrixFree object. Each cell defines a
+   * subdomain (patch) that contains all degrees of freedom of the cell,
+   * including the ones on its boundary that are shared with the neighbors.
+   * The local problem on the patch is the Laplacian restricted to these
+   * degrees of freedom, where the entries of the boundary degrees of freedom
+   * include the contributions of the neighboring cells. The local matrices
+   * are set up by
+   * TensorProductMatrixCreator::create_laplace_tensor_product_matrix() with
+   * the extent of the cell and its neighbors in each coordinate direction and
+   * are inverted by the fast diagonalization method of
+   * TensorProductMatrixSymmetricSumCollection, which costs about as much as
+   * the application of the operator on the cell. On a uniform Cartesian
+   * mesh, the local matrices coincide with the respective sub-matrices of
+   * the global matrix, while for affine or mildly deformed meshes, they are
+   * an approximation based on the distance between opposite faces.
+   *
+   * The contributions of the patches are summed with a symmetric weighting
+   * by the inverse square root of the number of patches that share a degree
+   * of freedom, i.e., the action of the preconditioner is
+   * @f[
+   * P^{-1} = \omega W^{1/2} \left(\sum_{c} R_c^T A_c^{-1} R_c\right) W^{1/2},
+   * @f]
+   * with the restriction $R_c$ to the degrees of freedom of cell $c$, the
+   * local matrix $A_c$, the diagonal weight matrix $W$, and the relaxation
+   * parameter $\omega$. The weighting keeps the spectrum of the preconditioned
+   * operator bounded independently of the number of overlapping patches, so
+   * the preconditioner can be used as a smoother in a Richardson iteration,
+   * e.g. with MGSmootherPrecondition on the levels of a geometric multigrid
+   * method with MGTransferGlobalCoarsening or MGTransferMatrixFree, or as the
+   * inner preconditioner of PreconditionChebyshev. Degrees of freedom that are
+   * subject to constraints in the MatrixFree object, e.g. homogeneous
+   * Dirichlet conditions, are set to zero in the result.
+   *
+   * Since the patches only contain the degrees of freedom of one cell, the
+   * subdomains overlap by the degrees of freedom on the faces, edges and
+   * vertices. Patches that include the interior degrees of freedom of the
+   * neighbors, as in vertex-star smoothers, would need access to degrees of
+   * freedom outside of the cell batches of MatrixFree and are not supported.
+   *
+   * @tparam dim The space dimension.
+   * @tparam Number The number type of the vectors and the local matrices.
+   * @tparam VectorizedArrayType The vectorized number type of the
+   * MatrixFree object.
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType = VectorizedArray<Number>>
+  class PreconditionCellPatchSchwarz
+  {
+  public:
+    /**
+     * The vector type the preconditioner works on.
+     */
+    using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+    /**
+     * The type of the MatrixFree object.
+     */
+    using MatrixFreeType = MatrixFree<dim, Number, VectorizedArrayType>;
+
+    /**
+     * Standardized data struct to pipe additional parameters to the
+     * preconditioner.
+     */
+    struct AdditionalData
+    {
+      /**
+       * Constructor.
+       */
+      AdditionalData(
+        const std::set<types::boundary_id> &dirichlet_boundaries = {},
+        const double                        relaxation           = 1.,
+        const unsigned int                  dof_handler_index    = 0)
+        : dirichlet_boundaries(dirichlet_boundaries)
+        , relaxation(relaxation)
+        , dof_handler_index(dof_handler_index)
+      {}
+
+      /**
+       * The boundary ids with Dirichlet conditions, where the degrees of
+       * freedom are removed from the local problems. All other boundaries
+       * are treated as Neumann boundaries. Periodic boundaries are treated
+       * like interior faces.
+       */
+      std::set<types::boundary_id> dirichlet_boundaries;
+
+      /**
+       * The relaxation parameter $\omega$ the result is multiplied with.
+       */
+      double relaxation;
+
+      /**
+       * The index of the DoFHandler within the MatrixFree object the
+       * vectors are associated with.
+       */
+      unsigned int dof_handler_index;
+    };
+
+    /**
+     * Constructor. Does nothing.
+     */
+    PreconditionCellPatchSchwarz() = default;
+
+    /**
+     * Set up the local matrices and the weights for the cells of
+     * @p matrix_free. The finite element of the selected DoFHandler must be
+     * a scalar FE_Q element.
+     */
+    void
+    initialize(const MatrixFreeType &matrix_free,
+               const AdditionalData &additional_data = AdditionalData());
+
+    /**
+     * Set up the preconditioner for the MatrixFree object of @p matrix,
+     * which must provide a function `get_matrix_free()` returning a pointer
+     * to it, as the classes derived from MatrixFreeOperators::Base do. This
+     * is the interface used by MGSmootherPrecondition.
+     */
+    template <typename MatrixType>
+    void
+    initialize(const MatrixType     &matrix,
+               const AdditionalData &additional_data = AdditionalData());
+
+    /**
+     * Release all memory and return to a state just like after having
+     * called the default constructor.
+     */
+    void
+    clear();
+
+    /**
+     * Apply the preconditioner to @p src and write the result into @p dst.
+     */
+    void
+    vmult(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Apply the transpose of the preconditioner, which is the same as
+     * vmult() as the preconditioner is symmetric.
+     */
+    void
+    Tvmult(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Return the memory consumption of this class in bytes.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Apply the inverse of the local matrices on a range of cell batches.
+     */
+    void
+    local_apply_inverse(
+      const MatrixFreeType                        &matrix_free,
+      VectorType                                  &dst,
+      const VectorType                            &src,
+      const std::pair<unsigned int, unsigned int> &cell_range) const;
+
+    /**
+     * Pointer to the MatrixFree object.
+     */
+    ObserverPointer<const MatrixFreeType> matrix_free;
+
+    /**
+     * The parameters of the preconditioner.
+     */
+    AdditionalData additional_data;
+
+    /**
+     * The local matrices of the cell batches in fast-diagonalization form.
+     */
+    std::unique_ptr<
+      TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>
+      local_inverses;
+
+    /**
+     * The inverse square root of the number of patches each degree of
+     * freedom is part of, or zero for constrained degrees of freedom.
+     */
+    VectorType weights;
+
+    /**
+     * Temporary vector for the weighted source vector.
+     */
+    mutable VectorType tmp;
+  };
+
+
+
+  // ------------------------------ inline functions ---------------------
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  inline void
+  PreconditionCellPatchSchwarz<dim, Number, VectorizedArrayType>::initialize(
+    const MatrixFreeType &matrix_free,
+    const AdditionalData &additional_data)
+  {
+    this->matrix_free     = &matrix_free;
+    this->additional_data = additional_data;
+
+    const unsigned int dof_index = additional_data.dof_handler_index;
+    const FiniteElement<dim> &fe =
+      matrix_free.get_dof_handler(dof_index).get_fe();
+    AssertThrow(dynamic_cast<const FE_Q<dim> *>(&fe) != nullptr,
+                ExcMessage("The cell patch Schwarz preconditioner is only "
+                           "implemented for scalar FE_Q elements."));
+
+    const FE_Q<1>   fe_1d(fe.degree);
+    const QGauss<1> quadrature_1d(fe.degree + 1);
+
+    using LaplaceBoundaryType = TensorProductMatrixCreator::LaplaceBoundaryType;
+
+    // the distance between the centers of two opposite faces as the extent
+    // of a cell in the respective direction
+    const auto cell_extent =
+      [](const typename Triangulation<dim>::cell_iterator &cell,
+         const unsigned int                                direction) {
+        return cell->face(2 * direction)
+          ->center()
+          .distance(cell->face(2 * direction + 1)->center());
+      };
+
+    // on typical meshes, many cells share the same extents and boundary
+    // types, so cache the 1d matrices of the configurations already set up
+    using MatrixPair = std::pair<std::array<FullMatrix<Number>, dim>,
+                                 std::array<FullMatrix<Number>, dim>>;
+    std::map<std::vector<double>, MatrixPair> cache;
+
+    constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+    local_inverses = std::make_unique<
+      TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>();
+    local_inverses->reserve(matrix_free.n_cell_batches());
+
+    for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+      {
+        std::array<Table<2, VectorizedArrayType>, dim> Ms, Ks;
+
+        const unsigned int n_filled_lanes =
+          matrix_free.n_active_entries_per_cell_batch(cell);
+        for (unsigned int v = 0; v < n_lanes; ++v)
+          {
+            // fill unused lanes with the data of the first lane to keep the
+            // local matrices invertible
+            const typename Triangulation<dim>::cell_iterator cell_it =
+              matrix_free.get_cell_iterator(cell,
+                                            v < n_filled_lanes ? v : 0,
+                                            dof_index);
+
+            dealii::ndarray<LaplaceBoundaryType, dim, 2> boundary_types;
+            dealii::ndarray<double, dim, 3>              extents;
+            std::vector<double>                          key;
+            key.reserve(5 * dim);
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                extents[d][1] = cell_extent(cell_it, d);
+                for (unsigned int side = 0; side < 2; ++side)
+                  {
+                    const unsigned int face = 2 * d + side;
+                    double            &neighbor_extent = extents[d][2 * side];
+                    neighbor_extent                    = 0.;
+                    if (cell_it->at_boundary(face) == false ||
+                        cell_it->has_periodic_neighbor(face))
+                      {
+                        boundary_types[d][side] =
+                          LaplaceBoundaryType::internal_boundary;
+                        neighbor_extent = cell_extent(
+                          cell_it->neighbor_or_periodic_neighbor(face), d);
+                      }
+                    else if (additional_data.dirichlet_boundaries.find(
+                               cell_it->face(face)->boundary_id()) !=
+                             additional_data.dirichlet_boundaries.end())
+                      boundary_types[d][side] = LaplaceBoundaryType::dirichlet;
+                    else
+                      boundary_types[d][side] = LaplaceBoundaryType::neumann;
+                  }
+                key.push_back(boundary_types[d][0]);
+                key.push_back(boundary_types[d][1]);
+                for (unsigned int e = 0; e < 3; ++e)
+                  key.push_back(extents[d][e]);
+              }
+
+            auto entry = cache.find(key);
+            if (entry == cache.end())
+              entry =
+                cache
+                  .emplace(key,
+                           TensorProductMatrixCreator::
+                             create_laplace_tensor_product_matrix<dim, Number>(
+                               fe_1d, quadrature_1d, boundary_types, extents))
+                  .first;
+
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                const FullMatrix<Number> &M = entry->second.first[d];
+                const FullMatrix<Number> &K = entry->second.second[d];
+                if (v == 0)
+                  {
+                    Ms[d].reinit(M.m(), M.n());
+                    Ks[d].reinit(K.m(), K.n());
+                  }
+                for (unsigned int i = 0; i < M.m(); ++i)
+                  for (unsigned int j = 0; j < M.n(); ++j)
+                    {
+                      Ms[d][i][j][v] = M(i, j);
+                      Ks[d][i][j][v] = K(i, j);
+                    }
+              }
+          }
+
+        local_inverses->insert(cell, Ms, Ks);
+      }
+    local_inverses->finalize();
+
+    // count the number of patches each degree of freedom is part of and
+    // compute the weights
+    matrix_free.initialize_dof_vector(weights, dof_index);
+    matrix_free.initialize_dof_vector(tmp, dof_index);
+    const std::function<void(const MatrixFreeType &,
+                             VectorType &,
+                             const VectorType &,
+                             const std::pair<unsigned int, unsigned int> &)>
+      count_patches = [dof_index](
+                        const MatrixFreeType                        &data,
+                        VectorType                                  &dst,
+                        const VectorType                            &,
+                        const std::pair<unsigned int, unsigned int> &range) {
+        FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(
+          data, dof_index);
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            phi.reinit(cell);
+            for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+              phi.begin_dof_values()[i] = Number(1.);
+            phi.distribute_local_to_global(dst);
+          }
+      };
+    matrix_free.cell_loop(count_patches, weights, tmp, true);
+
+    for (unsigned int i = 0; i < weights.locally_owned_size(); ++i)
+      weights.local_element(i) =
+        weights.local_element(i) > Number(0.) ?
+          Number(1.) / std::sqrt(weights.local_element(i)) :
+          Number(0.);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  template <typename MatrixType>
+  inline void
+  PreconditionCellPatchSchwarz<dim, Number, VectorizedArrayType>::initialize(
+    const MatrixType     &matrix,
+    const AdditionalData &additional_data)
+  {
+    initialize(*matrix.get_matrix_free(), additional_data);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  inline void
+  PreconditionCellPatchSchwarz<dim, Number, VectorizedArrayType>::clear()
+  {
+    matrix_free = nullptr;
+    local_inverses.reset();
+    weights.reinit(0);
+    tmp.reinit(0);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  inline void
+  PreconditionCellPatchSchwarz<dim, Number, VectorizedArrayType>::vmult(
+    VectorType       &dst,
+    const VectorType &src) const
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+
+    tmp = src;
+    tmp.scale(weights);
+    matrix_free->cell_loop(
+      &PreconditionCellPatchSchwarz::local_apply_inverse, this, dst, tmp, true);
+    dst.scale(weights);
+    if (additional_data.relaxation != 1.)
+      dst *= static_cast<Number>(additional_data.relaxation);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  inline void
+  PreconditionCellPatchSchwarz<dim, Number, VectorizedArrayType>::Tvmult(
+    VectorType       &dst,
+    const VectorType &src) const
+  {
+    vmult(dst, src);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  inline std::size_t
+  PreconditionCellPatchSchwarz<dim, Number, VectorizedArrayType>::
+    memory_consumption() const
+  {
+    return (local_inverses ? local_inverses->memory_consumption() : 0) +
+           weights.memory_consumption() + tmp.memory_consumption();
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  inline void
+  PreconditionCellPatchSchwarz<dim, Number, VectorizedArrayType>::
+    local_apply_inverse(
+      const MatrixFreeType                        &matrix_free,
+      VectorType                                  &dst,
+      const VectorType                            &src,
+      const std::pair<unsigned int, unsigned int> &cell_range) const
+  {
+    FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(
+      matrix_free, additional_data.dof_handler_index);
+    AlignedVector<VectorizedArrayType> local_src(phi.dofs_per_cell);
+
+    for (unsigned int cell = cell_range.first; cell < cell_range.second;
+         ++cell)
+      {
+        phi.reinit(cell);
+        phi.read_dof_values(src);
+        for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+          local_src[i] = phi.begin_dof_values()[i];
+        local_inverses->apply_inverse(
+          cell,
+          make_array_view(phi.begin_dof_values(),
+                          phi.begin_dof_values() + phi.dofs_per_cell),
+          make_array_view(local_src.begin(), local_src.end()));
+        phi.distribute_local_to_global(dst);
+      }
+  }
+} // end of namespace MatrixFreeOperators
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
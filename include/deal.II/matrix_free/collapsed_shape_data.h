@@ -0,0 +1,232 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_collapsed_shape_data_h
+#define dealii_matrix_free_collapsed_shape_data_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/std_cxx20/type_traits.h>
+
+#include <array>
+#include <functional>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+class ReferenceCell;
+
+
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    /**
+     * This struct stores a factorized representation of the shape functions
+     * of elements on simplices and wedges, which do not have a tensor product
+     * structure, for the evaluation at quadrature points that do have such
+     * a structure. This allows to replace the dense matrix-vector products
+     * with the shape functions by sum factorization.
+     *
+     * For simplices, the quadrature points need to be the image of a tensor
+     * product grid under the collapsed-coordinate (Duffy) transformation,
+     * see QGaussCollapsedSimplex. The element is represented in the modal
+     * basis of Dubiner, which factorizes in the collapsed coordinates
+     * $\xi_0, \xi_1, \xi_2$ as
+     * @f[
+     * \psi_{ijl}(\xi) = P_i(\xi_0)\;
+     * (1-\xi_1)^i P_j^{(2i+1,0)}(\xi_1)\;
+     * (1-\xi_2)^{i+j} P_l^{(2i+2j+2,0)}(\xi_2), \quad i+j+l\leq k,
+     * @f]
+     * with the Jacobi polynomials $P_n^{(\alpha,\beta)}$ on the unit
+     * interval, and the 2d basis given by the first two factors. For
+     * wedges, the quadrature points need to be a tensor product of points
+     * on the triangle and on the line, as for QGaussWedge, and the basis is
+     * the product of the Lagrange bases on the triangle and on the line.
+     *
+     * The modal basis is organized as a tree with one level per factor: The
+     * functions of the first level (index $i$ for simplices, the triangle
+     * functions for wedges) are multiplied by the functions of the second
+     * level that belong to them (index $j$ for a given $i$, or the line
+     * functions), and so on. An evaluation first transforms the coefficients
+     * of the element's basis to the modal basis and then contracts the
+     * levels from the last to the first one, each time only over the
+     * quadrature points of the respective level. Gradients are computed
+     * with respect to the collapsed coordinates and transformed to the
+     * reference coordinates at the end.
+     *
+     * @ingroup matrixfree
+     */
+    template <typename Number>
+    struct CollapsedShapeData
+    {
+      /**
+       * Empty constructor. Sets default configuration.
+       */
+      CollapsedShapeData();
+
+      /**
+       * Set up the factorized representation for the scalar element with
+       * @p n_dofs shape functions of complete degree @p degree on
+       * @p reference_cell, whose values are given by @p shape_value, and
+       * the quadrature formula @p quadrature. If the quadrature formula
+       * does not have the required tensor structure, the element does not
+       * span the polynomial space the modal basis is built for, or the
+       * factorized evaluation is not expected to be cheaper than the dense
+       * one, the object is left in the state where is_initialized() returns
+       * false.
+       */
+      template <int dim>
+      void
+      reinit(const ReferenceCell   &reference_cell,
+             const unsigned int     degree,
+             const Quadrature<dim> &quadrature,
+             const unsigned int     n_dofs,
+             const std_cxx20::type_identity_t<
+               std::function<double(const unsigned int, const Point<dim> &)>>
+               &shape_value);
+
+      /**
+       * Return whether the factorized representation has been set up and
+       * can be used.
+       */
+      bool
+      is_initialized() const;
+
+      /**
+       * Return the memory consumption of this class in bytes.
+       */
+      std::size_t
+      memory_consumption() const;
+
+      /**
+       * The number of levels of the modal basis, i.e., 2 for triangles and
+       * wedges and 3 for tetrahedra, or zero if the object is not
+       * initialized.
+       */
+      unsigned int n_levels;
+
+      /**
+       * The number of quadrature points of each level. The quadrature
+       * points are numbered with the index of the first level running
+       * fastest.
+       */
+      std::array<unsigned int, 3> n_q_points;
+
+      /**
+       * The number of derivatives of the first level, which is 1 for
+       * simplices and 2 (the derivatives in x and y direction of the
+       * triangle) for wedges. All other levels have one derivative.
+       */
+      unsigned int n_derivatives_first_level;
+
+      /**
+       * The number of modal basis functions in each level, where the
+       * functions of a level are the ones of the previous level combined
+       * with their children. The last entry is the number of degrees of
+       * freedom.
+       */
+      std::array<unsigned int, 3> n_functions;
+
+      /**
+       * The index of the first child within the next level of each
+       * function of the first and second level, with an additional entry
+       * at the end, i.e., the children of function $i$ of level $\ell$ are
+       * the functions `child_offsets[l][i]` to `child_offsets[l][i+1]` of
+       * level $\ell+1$.
+       */
+      std::array<std::vector<unsigned int>, 2> child_offsets;
+
+      /**
+       * The values of the one-dimensional factors of the modal basis
+       * functions of each level at the quadrature points of the level,
+       * with the index of the quadrature point running fastest.
+       */
+      std::array<AlignedVector<Number>, 3> shape_values;
+
+      /**
+       * The derivatives of the factors with respect to the collapsed
+       * coordinates in the same layout as @p shape_values. For the first
+       * level, the @p n_derivatives_first_level derivatives are stored
+       * one after the other.
+       */
+      std::array<AlignedVector<Number>, 3> shape_derivatives;
+
+      /**
+       * The transformation from the coefficients of the element's basis to
+       * the coefficients of the modal basis, with the index of the element's
+       * basis running fastest, or an empty field if the transformation is a
+       * permutation stored in @p modal_permutation.
+       */
+      AlignedVector<Number> nodal_to_modal;
+
+      /**
+       * If the transformation to the modal basis is a permutation, the
+       * index of the element's basis function that corresponds to each
+       * modal basis function.
+       */
+      std::vector<unsigned int> modal_permutation;
+
+      /**
+       * The derivatives of the collapsed coordinates with respect to the
+       * reference coordinates at each quadrature point, with the index of
+       * the collapsed coordinate running fastest, used to transform the
+       * gradients with respect to the collapsed coordinates to the
+       * reference coordinates. Empty if the coordinates are not collapsed,
+       * as for wedges.
+       */
+      AlignedVector<Number> derivative_transformation;
+
+      /**
+       * The number of entries of temporary storage needed by the evaluation
+       * and integration of one component.
+       */
+      unsigned int scratch_size;
+    };
+
+
+
+    // ------------------------------------------ inline functions
+
+    template <typename Number>
+    inline CollapsedShapeData<Number>::CollapsedShapeData()
+      : n_levels(0)
+      , n_q_points{{0, 0, 0}}
+      , n_derivatives_first_level(0)
+      , n_functions{{0, 0, 0}}
+      , scratch_size(0)
+    {}
+
+
+
+    template <typename Number>
+    inline bool
+    CollapsedShapeData<Number>::is_initialized() const
+    {
+      return n_levels > 0;
+    }
+
+  } // end of namespace MatrixFreeFunctions
+
+} // end of namespace internal
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
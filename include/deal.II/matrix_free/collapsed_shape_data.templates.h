@@ -0,0 +1,567 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_collapsed_shape_data_templates_h
+#define dealii_matrix_free_collapsed_shape_data_templates_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/polynomials_barycentric.h>
+
+#include <deal.II/grid/reference_cell.h>
+
+#include <deal.II/lac/full_matrix.h>
+
+#include <deal.II/matrix_free/collapsed_shape_data.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    namespace CollapsedShapeDataImplementation
+    {
+      /**
+       * Return the value and the derivative of the function
+       * $(1-x)^p P_n^{(\alpha,0)}(x)$ on the unit interval.
+       */
+      inline std::pair<double, double>
+      collapsed_jacobi_value_and_derivative(const unsigned int power,
+                                            const unsigned int degree,
+                                            const int          alpha,
+                                            const double       x)
+      {
+        const double jacobi =
+          Polynomials::jacobi_polynomial_value(degree, alpha, 0, x);
+        const double jacobi_derivative =
+          degree == 0 ? 0. :
+                        (degree + alpha + 1) *
+                          Polynomials::jacobi_polynomial_value(degree - 1,
+                                                               alpha + 1,
+                                                               1,
+                                                               x);
+        const double factor = std::pow(1. - x, power);
+        const double factor_derivative =
+          power == 0 ? 0. : -(power * std::pow(1. - x, power - 1.));
+        return {factor * jacobi,
+                factor_derivative * jacobi + factor * jacobi_derivative};
+      }
+
+
+
+      /**
+       * Split the points of a quadrature formula into the points of the
+       * levels of a tensor product, where the coordinates of each point are
+       * given by @p coordinates and the points of level $\ell$ are given by
+       * the coordinates `level_coordinates[l]`. Returns false if the points
+       * do not form a tensor product with the first level running fastest.
+       */
+      inline bool
+      split_into_tensor_product(
+        const std::vector<std::vector<double>> &coordinates,
+        const std::vector<unsigned int>        &level_coordinates,
+        std::vector<std::vector<unsigned int>> &level_points,
+        std::array<unsigned int, 3>            &n_q_points)
+      {
+        const unsigned int n_levels  = level_coordinates.size() - 1;
+        const unsigned int n_points  = coordinates.size();
+        const double       tolerance = 1e-12;
+
+        // return whether two points agree in the coordinates of the given
+        // level and all later levels
+        const auto same_coordinates = [&](const unsigned int q1,
+                                          const unsigned int q2,
+                                          const unsigned int level) {
+          for (unsigned int d = level_coordinates[level];
+               d < level_coordinates.back();
+               ++d)
+            if (std::abs(coordinates[q1][d] - coordinates[q2][d]) > tolerance)
+              return false;
+          return true;
+        };
+
+        // the number of points of each level is the number of consecutive
+        // points that share the coordinates of all later levels
+        unsigned int stride = 1;
+        for (unsigned int level = 0; level < n_levels; ++level)
+          {
+            unsigned int n = 1;
+            if (level + 1 < n_levels)
+              while (n * stride < n_points &&
+                     same_coordinates(0, n * stride, level + 1))
+                ++n;
+            else
+              n = n_points / stride;
+            n_q_points[level] = n;
+            stride *= n;
+          }
+        if (stride != n_points)
+          return false;
+
+        // check the tensor product structure for all points and extract the
+        // representative points of each level
+        level_points.clear();
+        level_points.resize(n_levels);
+        stride = 1;
+        for (unsigned int level = 0; level < n_levels; ++level)
+          {
+            for (unsigned int i = 0; i < n_q_points[level]; ++i)
+              level_points[level].push_back(i * stride);
+            stride *= n_q_points[level];
+          }
+        for (unsigned int q = 0; q < n_points; ++q)
+          {
+            unsigned int index = q;
+            for (unsigned int level = 0; level < n_levels; ++level)
+              {
+                const unsigned int i = index % n_q_points[level];
+                index /= n_q_points[level];
+                const unsigned int representative = level_points[level][i];
+                for (unsigned int d = level_coordinates[level];
+                     d < level_coordinates[level + 1];
+                     ++d)
+                  if (std::abs(coordinates[q][d] -
+                               coordinates[representative][d]) > tolerance)
+                    return false;
+              }
+          }
+        return true;
+      }
+    } // namespace CollapsedShapeDataImplementation
+
+
+
+    template <typename Number>
+    template <int dim>
+    void
+    CollapsedShapeData<Number>::reinit(
+      const ReferenceCell   &reference_cell,
+      const unsigned int     degree,
+      const Quadrature<dim> &quadrature,
+      const unsigned int     n_dofs,
+      const std_cxx20::type_identity_t<
+        std::function<double(const unsigned int, const Point<dim> &)>>
+        &shape_value)
+    {
+      using namespace CollapsedShapeDataImplementation;
+
+      *this = CollapsedShapeData<Number>();
+
+      const bool is_simplex =
+        (dim == 2 && reference_cell == ReferenceCells::Triangle) ||
+        (dim == 3 && reference_cell == ReferenceCells::Tetrahedron);
+      const bool is_wedge = dim == 3 && reference_cell == ReferenceCells::Wedge;
+      if (!is_simplex && !is_wedge)
+        return;
+
+      const unsigned int k                    = degree;
+      const unsigned int n_triangle_functions = (k + 1) * (k + 2) / 2;
+      const unsigned int n_modes =
+        is_wedge ? n_triangle_functions * (k + 1) :
+                   (dim == 2 ? n_triangle_functions :
+                               n_triangle_functions * (k + 3) / 3);
+      if (n_dofs != n_modes || quadrature.empty())
+        return;
+
+      const unsigned int n_points = quadrature.size();
+
+      // coordinates of the quadrature points in the coordinate system that
+      // is a tensor product: the collapsed coordinates for simplices and
+      // the reference coordinates for wedges
+      std::vector<std::vector<double>> coordinates(n_points,
+                                                   std::vector<double>(dim));
+      for (unsigned int q = 0; q < n_points; ++q)
+        {
+          const Point<dim> &p = quadrature.point(q);
+          if (is_wedge)
+            for (unsigned int d = 0; d < dim; ++d)
+              coordinates[q][d] = p[d];
+          else
+            {
+              // invert the collapsed-coordinate transformation, starting
+              // with the last coordinate that is not collapsed
+              double factor = 1.;
+              for (int d = dim - 1; d >= 0; --d)
+                {
+                  if (factor < 1e-12)
+                    return;
+                  coordinates[q][d] = p[d] / factor;
+                  factor -= p[d];
+                }
+            }
+        }
+
+      const std::vector<unsigned int> level_coordinates =
+        is_wedge ? std::vector<unsigned int>{0, 2, 3} :
+                   (dim == 2 ? std::vector<unsigned int>{0, 1, 2} :
+                               std::vector<unsigned int>{0, 1, 2, 3});
+      const unsigned int n_levels_local = level_coordinates.size() - 1;
+
+      std::vector<std::vector<unsigned int>> level_points;
+      if (!split_into_tensor_product(coordinates,
+                                     level_coordinates,
+                                     level_points,
+                                     n_q_points))
+        return;
+
+      // the modal basis can only be identified from the values at the
+      // quadrature points if the points are unisolvent for it, which is the
+      // case for at least k+1 points per collapsed coordinate
+      if (is_simplex)
+        {
+          for (unsigned int l = 0; l < n_levels_local; ++l)
+            if (n_q_points[l] < k + 1)
+              return;
+        }
+      else if (n_q_points[0] < n_triangle_functions || n_q_points[1] < k + 1)
+        return;
+
+      n_derivatives_first_level = is_wedge ? 2 : 1;
+
+      // the tables are computed in double precision and copied to the
+      // number type at the end
+      std::array<std::vector<double>, 3> values, derivatives;
+
+      // set up the tree of the modal basis and the values and derivatives
+      // of the factors at the points of each level
+      if (is_wedge)
+        {
+          const BarycentricPolynomials<2> triangle_basis =
+            BarycentricPolynomials<2>::get_fe_p_basis(k);
+          const BarycentricPolynomials<1> line_basis =
+            BarycentricPolynomials<1>::get_fe_p_basis(k);
+
+          n_functions = {{n_triangle_functions, n_modes, 0}};
+          child_offsets[0].resize(n_triangle_functions + 1);
+          for (unsigned int i = 0; i <= n_triangle_functions; ++i)
+            child_offsets[0][i] = i * (k + 1);
+
+          values[0].resize(n_triangle_functions * n_q_points[0]);
+          derivatives[0].resize(2 * n_triangle_functions * n_q_points[0]);
+          for (unsigned int i = 0; i < n_triangle_functions; ++i)
+            for (unsigned int q = 0; q < n_q_points[0]; ++q)
+              {
+                const std::vector<double> &x = coordinates[level_points[0][q]];
+                const Point<2>             p(x[0], x[1]);
+                const unsigned int         index = i * n_q_points[0] + q;
+                values[0][index]        = triangle_basis.compute_value(i, p);
+                const Tensor<1, 2> grad = triangle_basis.compute_grad(i, p);
+                for (unsigned int d = 0; d < 2; ++d)
+                  derivatives[0][d * values[0].size() + index] = grad[d];
+              }
+
+          values[1].resize(n_modes * n_q_points[1]);
+          derivatives[1].resize(n_modes * n_q_points[1]);
+          for (unsigned int i = 0; i < n_triangle_functions; ++i)
+            for (unsigned int j = 0; j <= k; ++j)
+              for (unsigned int q = 0; q < n_q_points[1]; ++q)
+                {
+                  const Point<1>     p(coordinates[level_points[1][q]][2]);
+                  const unsigned int index =
+                    (child_offsets[0][i] + j) * n_q_points[1] + q;
+                  values[1][index]      = line_basis.compute_value(j, p);
+                  derivatives[1][index] = line_basis.compute_grad(j, p)[0];
+                }
+        }
+      else
+        {
+          n_functions = {{k + 1, n_triangle_functions, dim == 3 ? n_modes : 0}};
+          if (dim == 2)
+            n_functions[1] = n_modes;
+
+          // first level: Legendre polynomials
+          values[0].resize((k + 1) * n_q_points[0]);
+          derivatives[0].resize((k + 1) * n_q_points[0]);
+          for (unsigned int i = 0; i <= k; ++i)
+            for (unsigned int q = 0; q < n_q_points[0]; ++q)
+              {
+                const auto value = collapsed_jacobi_value_and_derivative(
+                  0, i, 0, coordinates[level_points[0][q]][0]);
+                values[0][i * n_q_points[0] + q]      = value.first;
+                derivatives[0][i * n_q_points[0] + q] = value.second;
+              }
+
+          // second level: (1-x)^i P_j^{(2i+1,0)}
+          child_offsets[0].resize(k + 2);
+          values[1].resize(n_triangle_functions * n_q_points[1]);
+          derivatives[1].resize(n_triangle_functions * n_q_points[1]);
+          unsigned int index = 0;
+          for (unsigned int i = 0; i <= k; ++i)
+            {
+              child_offsets[0][i] = index;
+              for (unsigned int j = 0; i + j <= k; ++j, ++index)
+                for (unsigned int q = 0; q < n_q_points[1]; ++q)
+                  {
+                    const auto value = collapsed_jacobi_value_and_derivative(
+                      i, j, 2 * i + 1, coordinates[level_points[1][q]][1]);
+                    values[1][index * n_q_points[1] + q]      = value.first;
+                    derivatives[1][index * n_q_points[1] + q] = value.second;
+                  }
+            }
+          child_offsets[0][k + 1] = index;
+
+          // third level: (1-x)^{i+j} P_l^{(2i+2j+2,0)}
+          if (dim == 3)
+            {
+              child_offsets[1].resize(n_triangle_functions + 1);
+              values[2].resize(n_modes * n_q_points[2]);
+              derivatives[2].resize(n_modes * n_q_points[2]);
+              unsigned int index2 = 0;
+              index               = 0;
+              for (unsigned int i = 0; i <= k; ++i)
+                for (unsigned int j = 0; i + j <= k; ++j, ++index)
+                  {
+                    child_offsets[1][index] = index2;
+                    for (unsigned int l = 0; i + j + l <= k; ++l, ++index2)
+                      for (unsigned int q = 0; q < n_q_points[2]; ++q)
+                        {
+                          const auto value =
+                            collapsed_jacobi_value_and_derivative(
+                              i + j,
+                              l,
+                              2 * i + 2 * j + 2,
+                              coordinates[level_points[2][q]][2]);
+                          values[2][index2 * n_q_points[2] + q] = value.first;
+                          derivatives[2][index2 * n_q_points[2] + q] =
+                            value.second;
+                        }
+                  }
+              child_offsets[1][n_triangle_functions] = index2;
+            }
+        }
+
+      // scale the Jacobi factors to a maximal value of one at the quadrature
+      // points to improve the conditioning of the least-squares fit below;
+      // the Lagrange factors for wedges are kept as they are in order to
+      // detect the case where the element's basis is the product basis
+      for (unsigned int l = 0; l < (is_simplex ? n_levels_local : 0); ++l)
+        {
+          const unsigned int n_derivatives =
+            l == 0 ? n_derivatives_first_level : 1;
+          const unsigned int nq = n_q_points[l];
+          for (unsigned int i = 0; i < n_functions[l]; ++i)
+            {
+              double max_value = 0.;
+              for (unsigned int q = 0; q < nq; ++q)
+                max_value =
+                  std::max(max_value, std::abs(values[l][i * nq + q]));
+              if (max_value == 0.)
+                continue;
+              for (unsigned int q = 0; q < nq; ++q)
+                values[l][i * nq + q] /= max_value;
+              for (unsigned int d = 0; d < n_derivatives; ++d)
+                for (unsigned int q = 0; q < nq; ++q)
+                  derivatives[l][(d * n_functions[l] + i) * nq + q] /=
+                    max_value;
+            }
+        }
+
+      // evaluate the modal basis at all quadrature points by multiplying
+      // the factors along the tree
+      FullMatrix<double> modal_values(n_points, n_modes);
+      for (unsigned int q = 0; q < n_points; ++q)
+        {
+          const unsigned int q0 = q % n_q_points[0];
+          const unsigned int q1 = (q / n_q_points[0]) % n_q_points[1];
+          const unsigned int q2 =
+            n_levels_local == 3 ? q / (n_q_points[0] * n_q_points[1]) : 0;
+          for (unsigned int i = 0; i < n_functions[0]; ++i)
+            for (unsigned int j = child_offsets[0][i];
+                 j < child_offsets[0][i + 1];
+                 ++j)
+              {
+                const double value =
+                  values[0][i * n_q_points[0] + q0] *
+                  values[1][j * n_q_points[1] + q1];
+                if (n_levels_local == 2)
+                  modal_values(q, j) = value;
+                else
+                  for (unsigned int l = child_offsets[1][j];
+                       l < child_offsets[1][j + 1];
+                       ++l)
+                    modal_values(q, l) =
+                      value * values[2][l * n_q_points[2] + q2];
+              }
+        }
+
+      // find the transformation to the modal basis by a least-squares fit
+      // of the element's shape functions at the quadrature points, which
+      // is exact if the element spans the same space
+      FullMatrix<double> element_values(n_points, n_dofs);
+      for (unsigned int q = 0; q < n_points; ++q)
+        for (unsigned int i = 0; i < n_dofs; ++i)
+          element_values(q, i) = shape_value(i, quadrature.point(q));
+
+      FullMatrix<double> gram(n_modes, n_modes);
+      modal_values.Tmmult(gram, modal_values);
+      gram.gauss_jordan();
+      FullMatrix<double> projected(n_modes, n_dofs);
+      modal_values.Tmmult(projected, element_values);
+      FullMatrix<double> transformation(n_modes, n_dofs);
+      gram.mmult(transformation, projected);
+
+      FullMatrix<double> reconstructed(n_points, n_dofs);
+      modal_values.mmult(reconstructed, transformation);
+      double max_value = 1., max_error = 0.;
+      for (unsigned int q = 0; q < n_points; ++q)
+        for (unsigned int i = 0; i < n_dofs; ++i)
+          {
+            max_value = std::max(max_value, std::abs(element_values(q, i)));
+            max_error =
+              std::max(max_error,
+                       std::abs(element_values(q, i) - reconstructed(q, i)));
+          }
+      if (!(max_error < 1e-10 * max_value))
+        {
+          *this = CollapsedShapeData<Number>();
+          return;
+        }
+
+      // store the transformation as a permutation if possible
+      modal_permutation.resize(n_modes, numbers::invalid_unsigned_int);
+      for (unsigned int m = 0; m < n_modes; ++m)
+        for (unsigned int i = 0; i < n_dofs; ++i)
+          if (std::abs(transformation(m, i)) > 1e-12)
+            {
+              if (modal_permutation[m] == numbers::invalid_unsigned_int &&
+                  std::abs(transformation(m, i) - 1.) < 1e-12)
+                modal_permutation[m] = i;
+              else
+                modal_permutation[m] = numbers::invalid_unsigned_int - 1;
+            }
+      if (std::any_of(modal_permutation.begin(),
+                      modal_permutation.end(),
+                      [](const unsigned int i) {
+                        return i >= numbers::invalid_unsigned_int - 1;
+                      }))
+        {
+          modal_permutation.clear();
+          nodal_to_modal.resize(n_modes * n_dofs);
+          for (unsigned int m = 0; m < n_modes; ++m)
+            for (unsigned int i = 0; i < n_dofs; ++i)
+              nodal_to_modal[m * n_dofs + i] = transformation(m, i);
+        }
+
+      // derivatives of the collapsed coordinates with respect to the
+      // reference coordinates
+      if (is_simplex)
+        {
+          derivative_transformation.resize(n_points * dim * dim);
+          for (unsigned int q = 0; q < n_points; ++q)
+            {
+              const std::vector<double> &xi = coordinates[q];
+              Number *jac = &derivative_transformation[q * dim * dim];
+              for (unsigned int e = 0; e < dim * dim; ++e)
+                jac[e] = Number();
+              if (dim == 2)
+                {
+                  const double inv_0 = 1. / (1. - xi[1]);
+                  // d xi_0 / d(x,y)
+                  jac[0 * dim + 0] = inv_0;
+                  jac[1 * dim + 0] = xi[0] * inv_0;
+                  // d xi_1 / d(x,y)
+                  jac[1 * dim + 1] = 1.;
+                }
+              else
+                {
+                  const double inv_0 = 1. / ((1. - xi[1]) * (1. - xi[2]));
+                  const double inv_1 = 1. / (1. - xi[2]);
+                  // d xi_0 / d(x,y,z)
+                  jac[0 * dim + 0] = inv_0;
+                  jac[1 * dim + 0] = xi[0] * inv_0;
+                  jac[2 * dim + 0] = xi[0] * inv_0;
+                  // d xi_1 / d(x,y,z)
+                  jac[1 * dim + 1] = inv_1;
+                  jac[2 * dim + 1] = xi[1] * inv_1;
+                  // d xi_2 / d(x,y,z)
+                  jac[2 * dim + 2] = 1.;
+                }
+            }
+        }
+
+      // count the arithmetic operations of an evaluation of values and
+      // gradients and compare with the dense matrix-vector products
+      std::size_t n_operations =
+        nodal_to_modal.size() + derivative_transformation.size();
+      const unsigned int last = n_levels_local - 1;
+      n_operations += 2 * n_functions[last] * n_q_points[last];
+      if (n_levels_local == 3)
+        n_operations += 3 * n_functions[1] * n_q_points[1] * n_q_points[2];
+      n_operations += (2 + n_derivatives_first_level) * n_functions[0] *
+                      n_points;
+      if (n_operations >= (dim + 1) * n_dofs * n_points)
+        {
+          *this = CollapsedShapeData<Number>();
+          return;
+        }
+
+      // temporary storage: the modal coefficients, the partial sums of the
+      // levels, and the test functions in collapsed coordinates for the
+      // integration
+      scratch_size = n_modes + (dim + 1) * n_points;
+      if (n_levels_local == 2)
+        scratch_size += 2 * n_functions[0] * n_q_points[1];
+      else
+        scratch_size += 2 * n_functions[1] * n_q_points[2] +
+                        3 * n_functions[0] * n_q_points[1] * n_q_points[2];
+
+      for (unsigned int l = 0; l < n_levels_local; ++l)
+        {
+          shape_values[l].resize(values[l].size());
+          for (unsigned int i = 0; i < values[l].size(); ++i)
+            shape_values[l][i] = values[l][i];
+          shape_derivatives[l].resize(derivatives[l].size());
+          for (unsigned int i = 0; i < derivatives[l].size(); ++i)
+            shape_derivatives[l][i] = derivatives[l][i];
+        }
+
+      n_levels = n_levels_local;
+    }
+
+
+
+    template <typename Number>
+    std::size_t
+    CollapsedShapeData<Number>::memory_consumption() const
+    {
+      std::size_t memory = sizeof(*this);
+      for (unsigned int l = 0; l < 3; ++l)
+        memory += shape_values[l].memory_consumption() +
+                  shape_derivatives[l].memory_consumption();
+      for (unsigned int l = 0; l < 2; ++l)
+        memory += MemoryConsumption::memory_consumption(child_offsets[l]);
+      memory += nodal_to_modal.memory_consumption() +
+                MemoryConsumption::memory_consumption(modal_permutation) +
+                derivative_transformation.memory_consumption();
+      return memory;
+    }
+
+  } // end of namespace MatrixFreeFunctions
+
+} // end of namespace internal
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -330,6 +330,21 @@ namespace internal
         const TaskInfo                                &task_info,
         const std::vector<FaceToCellTopology<length>> &faces);
 
+      /**
+       * Add the connectivity between the chunks of cells of the loop in
+       * @p task_info that access the same vector entries, either through the
+       * cells of the chunk or through the cells adjacent to the faces of the
+       * chunk, to the sparsity pattern @p connectivity. Only chunks within
+       * the same part of the loop are connected, as the parts are run one
+       * after the other.
+       */
+      template <int length>
+      void
+      make_chunk_connectivity_graph(
+        const TaskInfo                                &task_info,
+        const std::vector<FaceToCellTopology<length>> &faces,
+        DynamicSparsityPattern                        &connectivity) const;
+
       /**
        * Return the memory consumption in bytes of this class.
        */
@@ -23,6 +23,7 @@
 #include <deal.II/base/parallel.h>
 
 #include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
 
 #include <deal.II/matrix_free/constraint_info.h>
 #include <deal.II/matrix_free/dof_info.h>
@@ -578,6 +579,98 @@ namespace internal
 
 
 
+    template <int length>
+    void
+    DoFInfo::make_chunk_connectivity_graph(
+      const TaskInfo                                &task_info,
+      const std::vector<FaceToCellTopology<length>> &faces,
+      DynamicSparsityPattern                        &connectivity) const
+    {
+      AssertDimension(length, vectorization_length);
+      const unsigned int n_components = start_components.back();
+
+      // collect the pairs of vector entries and chunks that access them, and
+      // connect all chunks that appear for the same entry
+      std::vector<unsigned int>                          cells_in_interval;
+      std::vector<std::pair<unsigned int, unsigned int>> dof_to_chunk;
+      std::vector<unsigned int>                          chunks_of_dof;
+      for (unsigned int part = 0;
+           part < task_info.partition_row_index.size() - 2;
+           ++part)
+        {
+          dof_to_chunk.clear();
+          for (unsigned int chunk = task_info.partition_row_index[part];
+               chunk < task_info.partition_row_index[part + 1];
+               ++chunk)
+            {
+              cells_in_interval.clear();
+              for (unsigned int cell = task_info.cell_partition_data[chunk];
+                   cell < task_info.cell_partition_data[chunk + 1];
+                   ++cell)
+                for (unsigned int v = 0; v < vectorization_length; ++v)
+                  cells_in_interval.push_back(cell * vectorization_length + v);
+              if (faces.size() > 0)
+                {
+                  for (unsigned int face =
+                         task_info.face_partition_data[chunk];
+                       face < task_info.face_partition_data[chunk + 1];
+                       ++face)
+                    for (unsigned int v = 0; v < vectorization_length; ++v)
+                      {
+                        if (faces[face].cells_interior[v] !=
+                            numbers::invalid_unsigned_int)
+                          cells_in_interval.push_back(
+                            faces[face].cells_interior[v]);
+                        if (faces[face].cells_exterior[v] !=
+                            numbers::invalid_unsigned_int)
+                          cells_in_interval.push_back(
+                            faces[face].cells_exterior[v]);
+                      }
+                  for (unsigned int face =
+                         task_info.boundary_partition_data[chunk];
+                       face < task_info.boundary_partition_data[chunk + 1];
+                       ++face)
+                    for (unsigned int v = 0; v < vectorization_length; ++v)
+                      if (faces[face].cells_interior[v] !=
+                          numbers::invalid_unsigned_int)
+                        cells_in_interval.push_back(
+                          faces[face].cells_interior[v]);
+                }
+              std::sort(cells_in_interval.begin(), cells_in_interval.end());
+              cells_in_interval.erase(std::unique(cells_in_interval.begin(),
+                                                  cells_in_interval.end()),
+                                      cells_in_interval.end());
+
+              for (const unsigned int cell : cells_in_interval)
+                for (unsigned int it = row_starts[cell * n_components].first;
+                     it != row_starts[(cell + 1) * n_components].first;
+                     ++it)
+                  dof_to_chunk.emplace_back(dof_indices[it], chunk);
+            }
+
+          std::sort(dof_to_chunk.begin(), dof_to_chunk.end());
+          dof_to_chunk.erase(std::unique(dof_to_chunk.begin(),
+                                         dof_to_chunk.end()),
+                             dof_to_chunk.end());
+          for (unsigned int i = 0; i < dof_to_chunk.size();)
+            {
+              chunks_of_dof.clear();
+              const unsigned int dof = dof_to_chunk[i].first;
+              for (; i < dof_to_chunk.size() && dof_to_chunk[i].first == dof;
+                   ++i)
+                chunks_of_dof.push_back(dof_to_chunk[i].second);
+              if (chunks_of_dof.size() > 1)
+                for (const unsigned int chunk : chunks_of_dof)
+                  connectivity.add_entries(chunk,
+                                           chunks_of_dof.begin(),
+                                           chunks_of_dof.end(),
+                                           true);
+            }
+        }
+    }
+
+
+
     namespace internal
     {
       // rudimentary version of a vector that keeps entries always ordered
@@ -0,0 +1,285 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_evaluation_autotuning_h
+#define dealii_matrix_free_evaluation_autotuning_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/evaluation_template_factory.h>
+#include <deal.II/matrix_free/fe_evaluation_data.h>
+#include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_kernels.h>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    /**
+     * A cache of the sum-factorization variants selected by
+     * autotune_evaluation_variant(), shared by all MatrixFree objects of a
+     * program. The results can be persisted in a file, with one line per
+     * configuration of the form `<key> <variant>`, where the key encodes the
+     * dimension, polynomial degree, number of 1d quadrature points, number
+     * of components, and the number type with its vectorization width, and
+     * the variant is either `collocation` or `direct`.
+     */
+    class EvaluationAutotuningCache
+    {
+    public:
+      /**
+       * Look up the variant for the given key in the cache, reading the
+       * entries of @p cache_file first if the file has not been read before.
+       * Return whether an entry was found.
+       */
+      bool
+      lookup(const std::string &key,
+             const std::string &cache_file,
+             ElementType       &element_type)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!cache_file.empty() && read_files.insert(cache_file).second)
+          {
+            std::ifstream file(cache_file);
+            std::string   entry_key, variant;
+            while (file >> entry_key >> variant)
+              {
+                if (variant == "collocation")
+                  entries[entry_key] = tensor_symmetric;
+                else if (variant == "direct")
+                  entries[entry_key] = tensor_symmetric_no_collocation;
+              }
+          }
+
+        const auto entry = entries.find(key);
+        if (entry == entries.end())
+          return false;
+        element_type = entry->second;
+        return true;
+      }
+
+      /**
+       * Store the variant for the given key in the cache and, if
+       * @p cache_file is not empty, append it to that file.
+       */
+      void
+      store(const std::string &key,
+            const std::string &cache_file,
+            const ElementType  element_type)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries[key] = element_type;
+        if (!cache_file.empty())
+          {
+            std::ofstream file(cache_file, std::ios::app);
+            AssertThrow(file.good(),
+                        ExcMessage("Could not open the autotuning cache file " +
+                                   cache_file + " for writing."));
+            file << key << ' '
+                 << (element_type == tensor_symmetric ? "collocation" :
+                                                        "direct")
+                 << std::endl;
+          }
+      }
+
+      /**
+       * Return the single object of this class.
+       */
+      static EvaluationAutotuningCache &
+      get()
+      {
+        static EvaluationAutotuningCache cache;
+        return cache;
+      }
+
+    private:
+      std::mutex                         mutex;
+      std::map<std::string, ElementType> entries;
+      std::set<std::string>              read_files;
+    };
+
+
+
+    /**
+     * Return whether autotune_evaluation_variant() has a choice between
+     * several kernels for the given shape info. This is the case for
+     * symmetric elements where the evaluation can either transform to a
+     * collocation basis in the quadrature points or apply the 1d shape
+     * functions directly with the even-odd decomposition, see
+     * use_collocation_evaluation(), and for degrees with precompiled
+     * kernels.
+     */
+    template <int dim, typename VectorizedArrayType, typename Number>
+    bool
+    evaluation_variant_can_be_tuned(const ShapeInfo<Number> &shape_info)
+    {
+      if (shape_info.element_type != tensor_symmetric ||
+          shape_info.data.size() != 1)
+        return false;
+      const unsigned int fe_degree     = shape_info.data[0].fe_degree;
+      const unsigned int n_q_points_1d = shape_info.data[0].n_q_points_1d;
+      return use_collocation_evaluation(fe_degree, n_q_points_1d) &&
+             FEEvaluationFactory<dim, VectorizedArrayType>::
+               fast_evaluation_supported(fe_degree, n_q_points_1d);
+    }
+
+
+
+    /**
+     * Run the evaluation and integration of values and gradients with the
+     * kernel selected by the element type of @p shape_info and return the
+     * time per call.
+     */
+    template <int dim, typename VectorizedArrayType, typename Number>
+    double
+    measure_evaluation_variant(const ShapeInfo<Number> &shape_info,
+                               const unsigned int       n_components)
+    {
+      FEEvaluationData<dim, VectorizedArrayType, false> eval(shape_info);
+      AlignedVector<VectorizedArrayType>                scratch;
+      eval.set_data_pointers(&scratch, n_components);
+
+      const unsigned int n_dofs =
+        n_components * shape_info.dofs_per_component_on_cell;
+      AlignedVector<VectorizedArrayType> dof_values(n_dofs), integrated(n_dofs);
+      for (unsigned int i = 0; i < n_dofs; ++i)
+        dof_values[i] = static_cast<Number>(i % 11) / Number(11.);
+
+      const EvaluationFlags::EvaluationFlags flags =
+        EvaluationFlags::values | EvaluationFlags::gradients;
+
+      // choose the number of repetitions to get a similar amount of work
+      // independent of the size of the cell, and take the minimum over
+      // several runs to reduce the influence of noise
+      const unsigned int n_repetitions =
+        std::max(4U, 200000U / (n_components * shape_info.n_q_points));
+      double best_time = std::numeric_limits<double>::max();
+      for (unsigned int run = 0; run < 5; ++run)
+        {
+          Timer timer;
+          for (unsigned int r = 0; r < n_repetitions; ++r)
+            {
+              FEEvaluationFactory<dim, VectorizedArrayType>::evaluate(
+                n_components, flags, dof_values.data(), eval);
+              FEEvaluationFactory<dim, VectorizedArrayType>::integrate(
+                n_components, flags, integrated.data(), eval, false);
+            }
+          best_time = std::min(best_time, timer.wall_time() / n_repetitions);
+        }
+      return best_time;
+    }
+
+
+
+    /**
+     * Select the fastest sum-factorization kernel for the cell evaluation of
+     * @p shape_info with @p n_components components by micro-benchmarks on
+     * the present hardware and set ShapeInfo::element_type and the element
+     * type of the univariate shape data, which selects the face kernels,
+     * accordingly. For symmetric elements where both variants are
+     * applicable, this is either ElementType::tensor_symmetric, which
+     * transforms to a collocation basis in the quadrature points, or
+     * ElementType::tensor_symmetric_no_collocation, which applies the 1d
+     * shape functions directly with the even-odd decomposition. For other
+     * elements, nothing is done.
+     *
+     * The result is cached for each configuration, so the measurement is
+     * only done once per program run. A configuration is given by the
+     * dimension, the polynomial degree, the number of 1d quadrature points,
+     * the number of components, and the number type with its vectorization
+     * width, which determine the cost of the kernels. Different elements and
+     * quadrature formulas that agree in these parameters, such as FE_Q and
+     * FE_DGQ of the same degree, share the selection. If @p cache_file is not
+     * empty, the cache is additionally read from and appended to that file,
+     * to reuse the selection in subsequent runs. To get the same kernels on
+     * all MPI processes, the selection of the first process in
+     * @p communicator is used, and only that process reads and writes the
+     * cache file; this function must thus be called on all processes of the
+     * communicator.
+     */
+    template <int dim, typename VectorizedArrayType, typename Number>
+    void
+    autotune_evaluation_variant(ShapeInfo<Number>  &shape_info,
+                                const unsigned int  n_components,
+                                const std::string  &cache_file,
+                                const MPI_Comm      communicator)
+    {
+      if (!evaluation_variant_can_be_tuned<dim, VectorizedArrayType>(
+            shape_info))
+        return;
+
+      const std::string key =
+        "dim=" + std::to_string(dim) +
+        ",degree=" + std::to_string(shape_info.data[0].fe_degree) +
+        ",n_q_points_1d=" + std::to_string(shape_info.data[0].n_q_points_1d) +
+        ",n_components=" + std::to_string(n_components) +
+        ",number_bytes=" + std::to_string(sizeof(Number)) +
+        ",lanes=" + std::to_string(VectorizedArrayType::size());
+
+      // only the first process measures and reads/writes the cache file,
+      // the other processes get the selection by a broadcast
+      ElementType selected = tensor_symmetric;
+      bool        measured = false;
+      if (Utilities::MPI::this_mpi_process(communicator) == 0 &&
+          EvaluationAutotuningCache::get().lookup(key,
+                                                  cache_file,
+                                                  selected) == false)
+        {
+          const double time_collocation =
+            measure_evaluation_variant<dim, VectorizedArrayType>(shape_info,
+                                                                 n_components);
+          shape_info.element_type = tensor_symmetric_no_collocation;
+          const double time_direct =
+            measure_evaluation_variant<dim, VectorizedArrayType>(shape_info,
+                                                                 n_components);
+          selected = time_direct < time_collocation ?
+                       tensor_symmetric_no_collocation :
+                       tensor_symmetric;
+          measured = true;
+        }
+
+      selected = static_cast<ElementType>(Utilities::MPI::broadcast(
+        communicator, static_cast<unsigned int>(selected), 0));
+      if (measured)
+        EvaluationAutotuningCache::get().store(key, cache_file, selected);
+      shape_info.element_type = selected;
+      for (auto &univariate_data : shape_info.data)
+        univariate_data.element_type = selected;
+    }
+  } // end of namespace MatrixFreeFunctions
+} // end of namespace internal
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
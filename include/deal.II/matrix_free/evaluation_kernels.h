@@ -22,6 +22,7 @@
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/evaluation_kernels_collapsed.h>
 #include <deal.II/matrix_free/evaluation_kernels_common.h>
 #include <deal.II/matrix_free/fe_evaluation_data.h>
 #include <deal.II/matrix_free/shape_info.h>
@@ -599,6 +600,24 @@ namespace internal
     using Number2 =
       typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
 
+    // use sum factorization in collapsed coordinates if available
+    const auto &collapsed_data = fe_eval.get_shape_info().collapsed_data;
+    if (collapsed_data.is_initialized())
+      {
+        AssertIndexRange(collapsed_data.scratch_size,
+                         fe_eval.get_scratch_data().size() + 1);
+        for (unsigned int c = 0; c < n_components; ++c)
+          CollapsedEvaluator<dim, Number, Number2>::evaluate(
+            collapsed_data,
+            evaluation_flag & EvaluationFlags::values,
+            evaluation_flag & EvaluationFlags::gradients,
+            values_dofs_actual + c * n_dofs,
+            fe_eval.begin_values() + c * n_q_points,
+            fe_eval.begin_gradients() + c * n_q_points * dim,
+            fe_eval.get_scratch_data().begin());
+        return;
+      }
+
     if (evaluation_flag & EvaluationFlags::values)
       {
         const auto *const shape_values = shape_data.front().shape_values.data();
@@ -716,6 +735,25 @@ namespace internal
     using Number2 =
       typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
 
+    // use sum factorization in collapsed coordinates if available
+    const auto &collapsed_data = fe_eval.get_shape_info().collapsed_data;
+    if (collapsed_data.is_initialized())
+      {
+        AssertIndexRange(collapsed_data.scratch_size,
+                         fe_eval.get_scratch_data().size() + 1);
+        for (unsigned int c = 0; c < n_components; ++c)
+          CollapsedEvaluator<dim, Number, Number2>::integrate(
+            collapsed_data,
+            integration_flag & EvaluationFlags::values,
+            integration_flag & EvaluationFlags::gradients,
+            fe_eval.begin_values() + c * n_q_points,
+            fe_eval.begin_gradients() + c * n_q_points * dim,
+            values_dofs_actual + c * n_dofs,
+            add_into_values_array,
+            fe_eval.get_scratch_data().begin());
+        return;
+      }
+
     if (integration_flag & EvaluationFlags::values)
       {
         const auto *const shape_values = shape_data.front().shape_values.data();
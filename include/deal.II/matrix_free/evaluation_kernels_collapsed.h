@@ -0,0 +1,426 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_evaluation_kernels_collapsed_h
+#define dealii_matrix_free_evaluation_kernels_collapsed_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+
+#include <deal.II/matrix_free/collapsed_shape_data.h>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  /**
+   * Evaluation and integration of a scalar element on simplices or wedges
+   * with the factorized representation of the shape functions in
+   * MatrixFreeFunctions::CollapsedShapeData. The quadrature points are
+   * numbered as described there, and the gradients are stored with the
+   * derivative index running fastest, as for the dense evaluation of
+   * MatrixFreeFunctions::tensor_none.
+   */
+  template <int dim, typename Number, typename Number2>
+  struct CollapsedEvaluator
+  {
+    using ShapeData = MatrixFreeFunctions::CollapsedShapeData<Number2>;
+
+    /**
+     * Evaluate the values and/or gradients of one component at the
+     * quadrature points. The array @p scratch must provide
+     * `ShapeData::scratch_size` entries.
+     */
+    static void
+    evaluate(const ShapeData &data,
+             const bool       evaluate_values,
+             const bool       evaluate_gradients,
+             const Number    *values_dofs,
+             Number          *values_quad,
+             Number          *gradients_quad,
+             Number          *scratch);
+
+    /**
+     * Multiply the values and/or gradients of one component at the
+     * quadrature points by the values and/or gradients of the test functions
+     * and sum over the quadrature points. If @p add_into_values_array is
+     * true, the result is added to @p values_dofs, otherwise it overwrites
+     * the content. The array @p scratch must provide
+     * `ShapeData::scratch_size` entries.
+     */
+    static void
+    integrate(const ShapeData &data,
+              const bool       integrate_values,
+              const bool       integrate_gradients,
+              const Number    *values_quad,
+              const Number    *gradients_quad,
+              Number          *values_dofs,
+              const bool       add_into_values_array,
+              Number          *scratch);
+  };
+
+
+
+  template <int dim, typename Number, typename Number2>
+  inline void
+  CollapsedEvaluator<dim, Number, Number2>::evaluate(
+    const ShapeData &data,
+    const bool       evaluate_values,
+    const bool       evaluate_gradients,
+    const Number    *values_dofs,
+    Number          *values_quad,
+    Number          *gradients_quad,
+    Number          *scratch)
+  {
+    Assert(data.is_initialized(), ExcNotInitialized());
+
+    const unsigned int n_levels = data.n_levels;
+    const unsigned int n_modes  = data.n_functions[n_levels - 1];
+    const unsigned int nq0      = data.n_q_points[0];
+    const unsigned int nq1      = data.n_q_points[1];
+    const unsigned int nq2      = n_levels == 3 ? data.n_q_points[2] : 1;
+    const unsigned int n0       = data.n_functions[0];
+    const unsigned int nd0      = data.n_derivatives_first_level;
+    const std::vector<unsigned int> &children0 = data.child_offsets[0];
+
+    const Number2 *v0 = data.shape_values[0].data();
+    const Number2 *d0 = data.shape_derivatives[0].data();
+    const Number2 *v1 = data.shape_values[1].data();
+    const Number2 *d1 = data.shape_derivatives[1].data();
+
+    // transform to the modal basis
+    Number *modal = scratch;
+    if (data.modal_permutation.empty())
+      {
+        const Number2 *transformation = data.nodal_to_modal.data();
+        for (unsigned int m = 0; m < n_modes; ++m, transformation += n_modes)
+          {
+            Number sum = transformation[0] * values_dofs[0];
+            for (unsigned int i = 1; i < n_modes; ++i)
+              sum += transformation[i] * values_dofs[i];
+            modal[m] = sum;
+          }
+      }
+    else
+      for (unsigned int m = 0; m < n_modes; ++m)
+        modal[m] = values_dofs[data.modal_permutation[m]];
+
+    // partial sums over all levels except the first one: 'vv' holds the
+    // values of the later levels, 'dv' the derivative of the second level,
+    // and 'vd' the derivative of the third level (or of the second level if
+    // there are only two levels)
+    Number *partial_vv = modal + n_modes + (dim + 1) * nq0 * nq1 * nq2;
+    Number *partial_dv = nullptr;
+    Number *partial_vd = nullptr;
+    if (n_levels == 2)
+      {
+        partial_vd = partial_vv + n0 * nq1;
+        for (unsigned int i = 0; i < n0; ++i)
+          for (unsigned int q1 = 0; q1 < nq1; ++q1)
+            {
+              Number sum_v = Number(), sum_d = Number();
+              for (unsigned int j = children0[i]; j < children0[i + 1]; ++j)
+                {
+                  sum_v += modal[j] * v1[j * nq1 + q1];
+                  if (evaluate_gradients)
+                    sum_d += modal[j] * d1[j * nq1 + q1];
+                }
+              partial_vv[i * nq1 + q1] = sum_v;
+              partial_vd[i * nq1 + q1] = sum_d;
+            }
+      }
+    else
+      {
+        const unsigned int               n1        = data.n_functions[1];
+        const std::vector<unsigned int> &children1 = data.child_offsets[1];
+        const Number2                   *v2 = data.shape_values[2].data();
+        const Number2                   *d2 = data.shape_derivatives[2].data();
+
+        Number *partial1_v = partial_vv;
+        Number *partial1_d = partial1_v + n1 * nq2;
+        partial_vv         = partial1_d + n1 * nq2;
+        partial_dv         = partial_vv + n0 * nq1 * nq2;
+        partial_vd         = partial_dv + n0 * nq1 * nq2;
+
+        // contract the third level
+        for (unsigned int p = 0; p < n1; ++p)
+          for (unsigned int q2 = 0; q2 < nq2; ++q2)
+            {
+              Number sum_v = Number(), sum_d = Number();
+              for (unsigned int l = children1[p]; l < children1[p + 1]; ++l)
+                {
+                  sum_v += modal[l] * v2[l * nq2 + q2];
+                  if (evaluate_gradients)
+                    sum_d += modal[l] * d2[l * nq2 + q2];
+                }
+              partial1_v[p * nq2 + q2] = sum_v;
+              partial1_d[p * nq2 + q2] = sum_d;
+            }
+
+        // contract the second level
+        for (unsigned int i = 0; i < n0; ++i)
+          for (unsigned int q2 = 0; q2 < nq2; ++q2)
+            for (unsigned int q1 = 0; q1 < nq1; ++q1)
+              {
+                Number sum_vv = Number(), sum_dv = Number(), sum_vd = Number();
+                for (unsigned int p = children0[i]; p < children0[i + 1]; ++p)
+                  {
+                    sum_vv += v1[p * nq1 + q1] * partial1_v[p * nq2 + q2];
+                    if (evaluate_gradients)
+                      {
+                        sum_dv += d1[p * nq1 + q1] * partial1_v[p * nq2 + q2];
+                        sum_vd += v1[p * nq1 + q1] * partial1_d[p * nq2 + q2];
+                      }
+                  }
+                const unsigned int index = (i * nq2 + q2) * nq1 + q1;
+                partial_vv[index]        = sum_vv;
+                partial_dv[index]        = sum_dv;
+                partial_vd[index]        = sum_vd;
+              }
+      }
+
+    // contract the first level and transform the gradients from the
+    // collapsed to the reference coordinates
+    const Number2 *transformation = data.derivative_transformation.data();
+    for (unsigned int q2 = 0, q = 0; q2 < nq2; ++q2)
+      for (unsigned int q1 = 0; q1 < nq1; ++q1)
+        for (unsigned int q0 = 0; q0 < nq0; ++q0, ++q)
+          {
+            Number value = Number();
+            Number collapsed[dim];
+            for (unsigned int e = 0; e < dim; ++e)
+              collapsed[e] = Number();
+            for (unsigned int i = 0; i < n0; ++i)
+              {
+                const unsigned int index = (i * nq2 + q2) * nq1 + q1;
+                const Number2      shape = v0[i * nq0 + q0];
+                value += shape * partial_vv[index];
+                if (evaluate_gradients)
+                  {
+                    for (unsigned int d = 0; d < nd0; ++d)
+                      collapsed[d] +=
+                        d0[(d * n0 + i) * nq0 + q0] * partial_vv[index];
+                    if (n_levels == 3)
+                      collapsed[1] += shape * partial_dv[index];
+                    collapsed[dim - 1] += shape * partial_vd[index];
+                  }
+              }
+            if (evaluate_values)
+              values_quad[q] = value;
+            if (evaluate_gradients)
+              {
+                if (data.derivative_transformation.empty())
+                  for (unsigned int d = 0; d < dim; ++d)
+                    gradients_quad[q * dim + d] = collapsed[d];
+                else
+                  for (unsigned int d = 0; d < dim; ++d)
+                    {
+                      const Number2 *jac = transformation + (q * dim + d) * dim;
+                      Number         sum = jac[0] * collapsed[0];
+                      for (unsigned int e = 1; e < dim; ++e)
+                        sum += jac[e] * collapsed[e];
+                      gradients_quad[q * dim + d] = sum;
+                    }
+              }
+          }
+  }
+
+
+
+  template <int dim, typename Number, typename Number2>
+  inline void
+  CollapsedEvaluator<dim, Number, Number2>::integrate(
+    const ShapeData &data,
+    const bool       integrate_values,
+    const bool       integrate_gradients,
+    const Number    *values_quad,
+    const Number    *gradients_quad,
+    Number          *values_dofs,
+    const bool       add_into_values_array,
+    Number          *scratch)
+  {
+    Assert(data.is_initialized(), ExcNotInitialized());
+
+    const unsigned int n_levels   = data.n_levels;
+    const unsigned int n_modes    = data.n_functions[n_levels - 1];
+    const unsigned int nq0        = data.n_q_points[0];
+    const unsigned int nq1        = data.n_q_points[1];
+    const unsigned int nq2        = n_levels == 3 ? data.n_q_points[2] : 1;
+    const unsigned int n_q_points = nq0 * nq1 * nq2;
+    const unsigned int n0         = data.n_functions[0];
+    const unsigned int nd0        = data.n_derivatives_first_level;
+    const std::vector<unsigned int> &children0 = data.child_offsets[0];
+
+    const Number2 *v0 = data.shape_values[0].data();
+    const Number2 *d0 = data.shape_derivatives[0].data();
+    const Number2 *v1 = data.shape_values[1].data();
+    const Number2 *d1 = data.shape_derivatives[1].data();
+
+    Number *modal = scratch;
+
+    // transform the gradients of the test functions to the collapsed
+    // coordinates, stored with the quadrature point index running fastest
+    Number *collapsed = modal + n_modes;
+    if (integrate_gradients)
+      {
+        const Number2 *transformation = data.derivative_transformation.data();
+        for (unsigned int q = 0; q < n_q_points; ++q)
+          if (data.derivative_transformation.empty())
+            for (unsigned int e = 0; e < dim; ++e)
+              collapsed[e * n_q_points + q] = gradients_quad[q * dim + e];
+          else
+            for (unsigned int e = 0; e < dim; ++e)
+              {
+                const Number2 *jac = transformation + q * dim * dim + e;
+                Number         sum = jac[0] * gradients_quad[q * dim];
+                for (unsigned int d = 1; d < dim; ++d)
+                  sum += jac[d * dim] * gradients_quad[q * dim + d];
+                collapsed[e * n_q_points + q] = sum;
+              }
+      }
+
+    // contract the first level, with the same meaning of the partial sums
+    // as in evaluate()
+    Number *partial_vv = collapsed + dim * n_q_points + n_q_points;
+    Number *partial_dv =
+      n_levels == 3 ? partial_vv + 2 * data.n_functions[1] * nq2 : nullptr;
+    Number *partial_vd = nullptr;
+    if (n_levels == 3)
+      {
+        partial_vv = partial_dv;
+        partial_dv = partial_vv + n0 * nq1 * nq2;
+        partial_vd = partial_dv + n0 * nq1 * nq2;
+      }
+    else
+      partial_vd = partial_vv + n0 * nq1;
+
+    for (unsigned int i = 0; i < n0; ++i)
+      for (unsigned int q2 = 0; q2 < nq2; ++q2)
+        for (unsigned int q1 = 0; q1 < nq1; ++q1)
+          {
+            Number sum_vv = Number(), sum_dv = Number(), sum_vd = Number();
+            const unsigned int offset = (q2 * nq1 + q1) * nq0;
+            for (unsigned int q0 = 0; q0 < nq0; ++q0)
+              {
+                const Number2      shape = v0[i * nq0 + q0];
+                const unsigned int q     = offset + q0;
+                if (integrate_values)
+                  sum_vv += shape * values_quad[q];
+                if (integrate_gradients)
+                  {
+                    for (unsigned int d = 0; d < nd0; ++d)
+                      sum_vv += d0[(d * n0 + i) * nq0 + q0] *
+                                collapsed[d * n_q_points + q];
+                    if (n_levels == 3)
+                      sum_dv += shape * collapsed[n_q_points + q];
+                    sum_vd += shape * collapsed[(dim - 1) * n_q_points + q];
+                  }
+              }
+            const unsigned int index = (i * nq2 + q2) * nq1 + q1;
+            partial_vv[index]        = sum_vv;
+            if (n_levels == 3)
+              partial_dv[index] = sum_dv;
+            partial_vd[index] = sum_vd;
+          }
+
+    if (n_levels == 2)
+      {
+        // contract the second level
+        for (unsigned int i = 0; i < n0; ++i)
+          for (unsigned int j = children0[i]; j < children0[i + 1]; ++j)
+            {
+              Number sum = Number();
+              for (unsigned int q1 = 0; q1 < nq1; ++q1)
+                {
+                  sum += v1[j * nq1 + q1] * partial_vv[i * nq1 + q1];
+                  if (integrate_gradients)
+                    sum += d1[j * nq1 + q1] * partial_vd[i * nq1 + q1];
+                }
+              modal[j] = sum;
+            }
+      }
+    else
+      {
+        const unsigned int               n1        = data.n_functions[1];
+        const std::vector<unsigned int> &children1 = data.child_offsets[1];
+        const Number2                   *v2 = data.shape_values[2].data();
+        const Number2                   *d2 = data.shape_derivatives[2].data();
+
+        Number *partial1_v = collapsed + dim * n_q_points + n_q_points;
+        Number *partial1_d = partial1_v + n1 * nq2;
+
+        // contract the second level
+        for (unsigned int i = 0; i < n0; ++i)
+          for (unsigned int p = children0[i]; p < children0[i + 1]; ++p)
+            for (unsigned int q2 = 0; q2 < nq2; ++q2)
+              {
+                Number sum_v = Number(), sum_d = Number();
+                for (unsigned int q1 = 0; q1 < nq1; ++q1)
+                  {
+                    const unsigned int index = (i * nq2 + q2) * nq1 + q1;
+                    sum_v += v1[p * nq1 + q1] * partial_vv[index];
+                    if (integrate_gradients)
+                      {
+                        sum_v += d1[p * nq1 + q1] * partial_dv[index];
+                        sum_d += v1[p * nq1 + q1] * partial_vd[index];
+                      }
+                  }
+                partial1_v[p * nq2 + q2] = sum_v;
+                partial1_d[p * nq2 + q2] = sum_d;
+              }
+
+        // contract the third level
+        for (unsigned int p = 0; p < n1; ++p)
+          for (unsigned int l = children1[p]; l < children1[p + 1]; ++l)
+            {
+              Number sum = Number();
+              for (unsigned int q2 = 0; q2 < nq2; ++q2)
+                {
+                  sum += v2[l * nq2 + q2] * partial1_v[p * nq2 + q2];
+                  if (integrate_gradients)
+                    sum += d2[l * nq2 + q2] * partial1_d[p * nq2 + q2];
+                }
+              modal[l] = sum;
+            }
+      }
+
+    // transform back from the modal basis
+    if (data.modal_permutation.empty())
+      {
+        const Number2 *transformation = data.nodal_to_modal.data();
+        for (unsigned int i = 0; i < n_modes; ++i)
+          {
+            Number sum = transformation[i] * modal[0];
+            for (unsigned int m = 1; m < n_modes; ++m)
+              sum += transformation[m * n_modes + i] * modal[m];
+            values_dofs[i] = add_into_values_array ? values_dofs[i] + sum : sum;
+          }
+      }
+    else
+      for (unsigned int m = 0; m < n_modes; ++m)
+        {
+          Number &dof = values_dofs[data.modal_permutation[m]];
+          dof         = add_into_values_array ? dof + modal[m] : modal[m];
+        }
+  }
+} // end of namespace internal
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -47,7 +47,9 @@ namespace internal
     // correct results (first two conditions), if it is the most efficient
     // choice in terms of operation counts (third condition) and if we were
     // able to initialize the fields in shape_info.templates.h from the
-    // polynomials (fourth condition).
+    // polynomials (fourth condition). The element type of the shape data
+    // can disable it, e.g., if the direct evaluation was measured to be
+    // faster, see autotune_evaluation_variant().
     using Number2 =
       typename FEEvaluationData<dim, Number, true>::shape_info_number_type;
 
@@ -148,7 +150,9 @@ namespace internal
               {
                 case 3:
                   if (symmetric_evaluate &&
-                      use_collocation_evaluation(fe_degree, n_q_points_1d))
+                      use_collocation_evaluation(fe_degree, n_q_points_1d) &&
+                      data.element_type <=
+                        MatrixFreeFunctions::tensor_symmetric)
                     {
                       eval0.template values<0, true, false>(values_dofs,
                                                             values_quad);
@@ -350,7 +354,9 @@ namespace internal
                   eval0.template values<0, false, false>(scratch_data,
                                                          values_dofs + n_dofs);
                   if (symmetric_evaluate &&
-                      use_collocation_evaluation(fe_degree, n_q_points_1d))
+                      use_collocation_evaluation(fe_degree, n_q_points_1d) &&
+                      data.element_type <=
+                        MatrixFreeFunctions::tensor_symmetric)
                     {
                       EvaluatorTensorProduct<evaluate_evenodd,
                                              dim - 1,
@@ -1665,7 +1671,8 @@ namespace internal
         }
       else if (fe_degree > -1 &&
                subface_index >= GeometryInfo<dim>::max_children_per_cell &&
-               shape_info.element_type <= MatrixFreeFunctions::tensor_symmetric)
+               shape_info.element_type <=
+                 MatrixFreeFunctions::tensor_symmetric_no_collocation)
         FEFaceEvaluationImpl<true,
                              dim,
                              fe_degree,
@@ -2203,7 +2210,8 @@ namespace internal
       else if (fe_degree > -1 &&
                fe_eval.get_subface_index() >=
                  GeometryInfo<dim - 1>::max_children_per_cell &&
-               shape_info.element_type <= MatrixFreeFunctions::tensor_symmetric)
+               shape_info.element_type <=
+                 MatrixFreeFunctions::tensor_symmetric_no_collocation)
         FEFaceEvaluationImpl<
           true,
           dim,
@@ -2535,6 +2535,12 @@ inline FEEvaluationBase<dim,
       this->quadrature_points =
         this->mapped_geometry->get_data_storage().quadrature_points.begin();
     }
+  else
+    {
+      // the geometry data computed within reinit() must not be shared
+      // between copies that might be used in parallel
+      this->mapped_geometry.reset();
+    }
 
   this->set_data_pointers(scratch_data_array, n_components_);
 }
@@ -2613,6 +2619,7 @@ operator=(const FEEvaluationBase<dim,
   else
     {
       scratch_data_array = matrix_free->acquire_scratch_data();
+      this->mapped_geometry.reset();
     }
 
   this->set_data_pointers(scratch_data_array, n_components_);
@@ -6519,8 +6526,27 @@ FEEvaluation<dim,
 
   const unsigned int offsets =
     this->mapping_data->data_index_offsets[cell_index];
-  this->jacobian = &this->mapping_data->jacobians[0][offsets];
-  this->J_value  = &this->mapping_data->JxW_values[offsets];
+  if (this->cell_type == internal::MatrixFreeFunctions::GeometryType::general &&
+      !this->mapping_data->mapping_support_points.empty())
+    {
+      // only the support points of the mapping are stored, so compute the
+      // Jacobians into the storage owned by this class
+      if (this->mapped_geometry == nullptr)
+        this->mapped_geometry =
+          std::make_shared<internal::MatrixFreeFunctions::
+                             MappingDataOnTheFly<dim, VectorizedArrayType>>();
+
+      auto &mapping_storage = this->mapped_geometry->get_data_storage();
+      this->mapping_data->compute_jacobians_from_support_points(
+        offsets, mapping_storage);
+      this->jacobian = mapping_storage.jacobians[0].data();
+      this->J_value  = mapping_storage.JxW_values.data();
+    }
+  else
+    {
+      this->jacobian = &this->mapping_data->jacobians[0][offsets];
+      this->J_value  = &this->mapping_data->JxW_values[offsets];
+    }
   if (!this->mapping_data->jacobian_gradients[0].empty())
     {
       this->jacobian_gradients =
@@ -6580,6 +6606,12 @@ FEEvaluation<dim,
   Assert(this->dof_info != nullptr, ExcNotInitialized());
   Assert(this->mapping_data != nullptr, ExcNotInitialized());
 
+  Assert(this->mapping_data->mapping_support_points.empty(),
+         ExcMessage("The Jacobians on cells with only the support points of "
+                    "the mapping stored cannot be accessed by an array of "
+                    "cell indices. Disable the option MatrixFree::"
+                    "AdditionalData::compute_jacobians_in_reinit."));
+
   this->cell     = numbers::invalid_unsigned_int;
   this->cell_ids = cell_ids;
 
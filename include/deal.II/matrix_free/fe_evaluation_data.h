@@ -1236,9 +1236,10 @@ FEEvaluationData<dim, Number, is_face>::set_data_pointers(
   const unsigned int dofs_per_component = data->dofs_per_component_on_cell;
 
   const unsigned int size_scratch_data =
-    std::max(tensor_dofs_per_component + 1, dofs_per_component) * n_components *
-      4 +
-    2 * n_quadrature_points;
+    std::max(std::max(tensor_dofs_per_component + 1, dofs_per_component) *
+                 n_components * 4 +
+               2 * n_quadrature_points,
+             data->collapsed_data.scratch_size);
   const unsigned int size_data_arrays =
     n_components * dofs_per_component +
     (n_components * ((dim * (dim + 1)) / 2 + 2 * dim + 2) *
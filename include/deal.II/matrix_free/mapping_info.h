@@ -73,7 +73,8 @@ namespace internal
         const UpdateFlags update_flags_boundary_faces,
         const UpdateFlags update_flags_inner_faces,
         const UpdateFlags update_flags_faces_by_cells,
-        const bool        piola_transform);
+        const bool        piola_transform,
+        const bool        compute_jacobians_in_reinit = false);
 
       /**
        * Update the information in the given cells and faces that is the
@@ -139,6 +140,14 @@ namespace internal
        */
       UpdateFlags update_flags_faces_by_cells;
 
+      /**
+       * Whether only the support points of the mapping should be stored on
+       * cells of general type, with the Jacobians computed on the fly in
+       * FEEvaluation::reinit(). See
+       * MatrixFree::AdditionalData::compute_jacobians_in_reinit.
+       */
+      bool compute_jacobians_in_reinit;
+
       /**
        * Stores whether a cell is Cartesian (cell type 0), has constant
        * transform data (Jacobians) (cell type 1), or is general (cell type
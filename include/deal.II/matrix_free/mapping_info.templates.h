@@ -52,8 +52,9 @@ namespace internal
       face_data_by_cells.clear();
       cell_type.clear();
       face_type.clear();
-      mapping_collection = nullptr;
-      mapping            = nullptr;
+      mapping_collection          = nullptr;
+      mapping                     = nullptr;
+      compute_jacobians_in_reinit = false;
     }
 
 
@@ -71,11 +72,13 @@ namespace internal
       const UpdateFlags update_flags_boundary_faces,
       const UpdateFlags update_flags_inner_faces,
       const UpdateFlags update_flags_faces_by_cells,
-      const bool        piola_transform)
+      const bool        piola_transform,
+      const bool        compute_jacobians_in_reinit)
     {
       clear();
-      this->mapping_collection = mapping;
-      this->mapping            = &mapping->operator[](0);
+      this->mapping_collection          = mapping;
+      this->mapping                     = &mapping->operator[](0);
+      this->compute_jacobians_in_reinit = compute_jacobians_in_reinit;
 
       cell_data.resize(quad.size());
       face_data.resize(quad.size());
@@ -1189,6 +1192,11 @@ namespace internal
         for (unsigned int cell = begin_cell; cell < end_cell; ++cell)
           for (unsigned vv = 0; vv < n_lanes; vv += n_lanes_d)
             {
+              // in case only the support points are stored for this cell,
+              // we only need to evaluate the quadrature points
+              const bool store_support_points =
+                cell_type[cell] == general &&
+                !my_data.mapping_support_points.empty();
               if (cell_type[cell] > affine || process_cell[cell])
                 {
                   unsigned int start_indices[n_lanes_d];
@@ -1200,14 +1208,29 @@ namespace internal
                                                 start_indices,
                                                 eval.begin_dof_values());
 
-                  FEEvaluationFactory<dim, VectorizedDouble>::evaluate(
-                    dim,
-                    EvaluationFlags::values | EvaluationFlags::gradients |
-                      (update_flags_cells & update_jacobian_grads ?
-                         EvaluationFlags::hessians :
-                         EvaluationFlags::nothing),
-                    eval.begin_dof_values(),
-                    eval);
+                  if (store_support_points && process_cell[cell])
+                    for (unsigned int i = 0; i < n_mapping_points * dim; ++i)
+                      store_vectorized_array(
+                        eval.begin_dof_values()[i],
+                        vv,
+                        my_data.mapping_support_points
+                          [my_data.data_index_offsets[cell] + i]);
+
+                  if (!store_support_points)
+                    FEEvaluationFactory<dim, VectorizedDouble>::evaluate(
+                      dim,
+                      EvaluationFlags::values | EvaluationFlags::gradients |
+                        (update_flags_cells & update_jacobian_grads ?
+                           EvaluationFlags::hessians :
+                           EvaluationFlags::nothing),
+                      eval.begin_dof_values(),
+                      eval);
+                  else if (update_flags_cells & update_quadrature_points)
+                    FEEvaluationFactory<dim, VectorizedDouble>::evaluate(
+                      dim,
+                      EvaluationFlags::values,
+                      eval.begin_dof_values(),
+                      eval);
                 }
               if (update_flags_cells & update_quadrature_points)
                 {
@@ -1232,7 +1255,7 @@ namespace internal
 
               const unsigned int n_points =
                 cell_type[cell] <= affine ? 1 : n_q_points;
-              if (process_cell[cell])
+              if (process_cell[cell] && !store_support_points)
                 for (unsigned int q = 0; q < n_points; ++q)
                   {
                     const unsigned int idx =
@@ -2793,21 +2816,55 @@ namespace internal
             cell_data[my_q];
 
           // step 4a: set the index offsets, find out how much to allocate,
-          // and allocate the memory
+          // and allocate the memory. In case the Jacobians are computed on
+          // the fly, the index offsets of general cells point into the
+          // array of mapping support points.
           const unsigned int n_q_points = my_data.descriptor[0].n_q_points;
           unsigned int       max_size   = 0;
+
+          const bool store_support_points =
+            this->compute_jacobians_in_reinit &&
+            !(update_flags_cells & update_jacobian_grads) &&
+            Utilities::fixed_power<dim>(
+              my_data.descriptor[0].quadrature_1d.size()) == n_q_points;
+          unsigned int n_support_point_data = 0;
           my_data.data_index_offsets.resize(cell_type.size());
           for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
             {
+              const bool cell_stores_support_points =
+                store_support_points && cell_type[cell] == general;
               if (process_cell[cell] == false)
                 my_data.data_index_offsets[cell] =
                   my_data.data_index_offsets[cell_data_index_vect[cell]];
+              else if (cell_stores_support_points)
+                {
+                  my_data.data_index_offsets[cell] = n_support_point_data;
+                  n_support_point_data += n_mapping_points * dim;
+                }
               else
                 my_data.data_index_offsets[cell] = max_size;
-              max_size =
-                std::max(max_size,
-                         my_data.data_index_offsets[cell] +
-                           (cell_type[cell] <= affine ? 2 : n_q_points));
+              if (!cell_stores_support_points)
+                max_size =
+                  std::max(max_size,
+                           my_data.data_index_offsets[cell] +
+                             (cell_type[cell] <= affine ? 2 : n_q_points));
+            }
+
+          if (n_support_point_data > 0)
+            {
+              my_data.mapping_support_points.resize_fast(n_support_point_data);
+              my_data.n_mapping_points_1d = mapping_degree + 1;
+              const auto &univariate_data = shape_infos[my_q].data[0];
+              my_data.mapping_shape_values.resize(
+                univariate_data.shape_values.size());
+              std::copy(univariate_data.shape_values.begin(),
+                        univariate_data.shape_values.end(),
+                        my_data.mapping_shape_values.begin());
+              my_data.mapping_shape_gradients.resize(
+                univariate_data.shape_gradients.size());
+              std::copy(univariate_data.shape_gradients.begin(),
+                        univariate_data.shape_gradients.end(),
+                        my_data.mapping_shape_gradients.begin());
             }
 
           my_data.JxW_values.resize_fast(max_size);
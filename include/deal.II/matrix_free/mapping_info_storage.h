@@ -306,6 +306,52 @@ namespace internal
        */
       AlignedVector<Point<spacedim, Number>> quadrature_points;
 
+      /**
+       * Stores the support points of the mapping on cells of general type in
+       * case the Jacobians are not stored but computed on the fly, see
+       * MatrixFree::AdditionalData::compute_jacobians_in_reinit. The data of
+       * a cell is stored component by component, with the points in
+       * lexicographic order within each component. If this field is not
+       * empty, @p data_index_offsets points into this array rather than into
+       * @p jacobians and @p JxW_values for cells of general type.
+       */
+      AlignedVector<Number> mapping_support_points;
+
+      /**
+       * The number of mapping support points per coordinate direction, i.e.,
+       * the degree of the mapping plus one.
+       */
+      unsigned int n_mapping_points_1d;
+
+      /**
+       * The values of the one-dimensional Lagrange polynomials through the
+       * mapping support points, evaluated in the one-dimensional quadrature
+       * points, with the polynomials running slowest.
+       */
+      AlignedVector<typename QuadratureDescriptor::ScalarNumber>
+        mapping_shape_values;
+
+      /**
+       * The derivatives of the one-dimensional Lagrange polynomials through
+       * the mapping support points, evaluated in the one-dimensional
+       * quadrature points, stored as @p mapping_shape_values.
+       */
+      AlignedVector<typename QuadratureDescriptor::ScalarNumber>
+        mapping_shape_gradients;
+
+      /**
+       * Compute the inverse and transposed Jacobians as well as the JxW
+       * values on all quadrature points of a cell from the mapping support
+       * points found at position @p offset of the field
+       * @p mapping_support_points by sum factorization. The result is written
+       * into the fields @p jacobians[0] and @p JxW_values of @p target, which
+       * are resized as necessary. The field @p mapping_support_points of
+       * @p target is used as temporary storage.
+       */
+      void
+      compute_jacobians_from_support_points(const unsigned int  offset,
+                                            MappingInfoStorage &target) const;
+
       /**
        * Clears all data fields except the descriptor vector.
        */
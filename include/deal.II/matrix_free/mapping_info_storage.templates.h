@@ -27,6 +27,7 @@
 #include <deal.II/matrix_free/evaluation_template_factory.h>
 #include <deal.II/matrix_free/mapping_info_storage.h>
 #include <deal.II/matrix_free/task_info.h>
+#include <deal.II/matrix_free/tensor_product_kernels.h>
 #include <deal.II/matrix_free/util.h>
 
 DEAL_II_NAMESPACE_OPEN
@@ -113,6 +114,111 @@ namespace internal
         }
       quadrature_point_offsets.clear();
       quadrature_points.clear();
+      mapping_support_points.clear();
+      mapping_shape_values.clear();
+      mapping_shape_gradients.clear();
+    }
+
+
+
+    template <int structdim, int spacedim, typename Number>
+    void
+    MappingInfoStorage<structdim, spacedim, Number>::
+      compute_jacobians_from_support_points(const unsigned int  offset,
+                                            MappingInfoStorage &target) const
+    {
+      if constexpr (structdim == spacedim)
+        {
+          constexpr int dim = structdim;
+          using ScalarNumber = typename QuadratureDescriptor::ScalarNumber;
+
+          const unsigned int n_q_points_1d = descriptor[0].quadrature_1d.size();
+          const unsigned int n_q_points    = descriptor[0].n_q_points;
+          const unsigned int n_points =
+            Utilities::fixed_power<dim>(n_mapping_points_1d);
+          AssertDimension(Utilities::fixed_power<dim>(n_q_points_1d),
+                          n_q_points);
+          AssertIndexRange(offset + dim * n_points,
+                           mapping_support_points.size() + 1);
+
+          if (target.jacobians[0].size() != n_q_points)
+            target.jacobians[0].resize_fast(n_q_points);
+          if (target.JxW_values.size() != n_q_points)
+            target.JxW_values.resize_fast(n_q_points);
+
+          // temporary storage for the derivatives of all components with
+          // respect to all unit coordinates, and two arrays for the
+          // intermediate results of the sum factorization
+          const unsigned int size_tmp = Utilities::fixed_power<dim>(
+            std::max(n_mapping_points_1d, n_q_points_1d));
+          if (target.mapping_support_points.size() !=
+              dim * dim * n_q_points + 2 * size_tmp)
+            target.mapping_support_points.resize_fast(dim * dim * n_q_points +
+                                                      2 * size_tmp);
+          Number *derivatives = target.mapping_support_points.data();
+          Number *tmp0        = derivatives + dim * dim * n_q_points;
+          Number *tmp1        = tmp0 + size_tmp;
+
+          EvaluatorTensorProduct<evaluate_general,
+                                 dim,
+                                 0,
+                                 0,
+                                 Number,
+                                 ScalarNumber>
+            eval(mapping_shape_values.data(),
+                 mapping_shape_gradients.data(),
+                 nullptr,
+                 n_mapping_points_1d,
+                 n_q_points_1d);
+
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              const Number *in =
+                mapping_support_points.data() + offset + d * n_points;
+              Number *out = derivatives + d * dim * n_q_points;
+              if constexpr (dim == 1)
+                eval.template gradients<0, true, false>(in, out);
+              else if constexpr (dim == 2)
+                {
+                  eval.template gradients<0, true, false>(in, tmp0);
+                  eval.template values<1, true, false>(tmp0, out);
+                  eval.template values<0, true, false>(in, tmp0);
+                  eval.template gradients<1, true, false>(tmp0,
+                                                          out + n_q_points);
+                }
+              else
+                {
+                  eval.template gradients<0, true, false>(in, tmp0);
+                  eval.template values<1, true, false>(tmp0, tmp1);
+                  eval.template values<2, true, false>(tmp1, out);
+                  eval.template values<0, true, false>(in, tmp0);
+                  eval.template gradients<1, true, false>(tmp0, tmp1);
+                  eval.template values<2, true, false>(tmp1,
+                                                       out + n_q_points);
+                  eval.template values<1, true, false>(tmp0, tmp1);
+                  eval.template gradients<2, true, false>(tmp1,
+                                                          out + 2 * n_q_points);
+                }
+            }
+
+          const ScalarNumber *weights =
+            descriptor[0].quadrature_weights.data();
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              Tensor<2, dim, Number> jac;
+              for (unsigned int d = 0; d < dim; ++d)
+                for (unsigned int e = 0; e < dim; ++e)
+                  jac[d][e] = derivatives[(d * dim + e) * n_q_points + q];
+              target.JxW_values[q]   = determinant(jac) * weights[q];
+              target.jacobians[0][q] = transpose(invert(jac));
+            }
+        }
+      else
+        {
+          (void)offset;
+          (void)target;
+          DEAL_II_NOT_IMPLEMENTED();
+        }
     }
 
 
@@ -187,7 +293,10 @@ namespace internal
              MemoryConsumption::memory_consumption(normals_times_jacobians[0]) +
              MemoryConsumption::memory_consumption(normals_times_jacobians[1]) +
              MemoryConsumption::memory_consumption(quadrature_point_offsets) +
-             MemoryConsumption::memory_consumption(quadrature_points);
+             MemoryConsumption::memory_consumption(quadrature_points) +
+             MemoryConsumption::memory_consumption(mapping_support_points) +
+             MemoryConsumption::memory_consumption(mapping_shape_values) +
+             MemoryConsumption::memory_consumption(mapping_shape_gradients);
     }
 
 
@@ -225,6 +334,15 @@ namespace internal
               MemoryConsumption::memory_consumption(
                 jacobian_gradients_non_inverse[1]));
         }
+      const std::size_t support_points_size =
+        Utilities::MPI::sum(mapping_support_points.size(),
+                            task_info.communicator);
+      if (support_points_size > 0)
+        {
+          out << "      Memory mapping support points: ";
+          task_info.print_memory_statistics(
+            out, MemoryConsumption::memory_consumption(mapping_support_points));
+        }
       const std::size_t normal_size =
         Utilities::MPI::sum(normal_vectors.size(), task_info.communicator);
       if (normal_size > 0)
@@ -100,6 +100,15 @@ DEAL_II_NAMESPACE_OPEN
  * operations for several cells with one CPU instruction and is one of the
  * main features of this framework.
  *
+ * On simplex and wedge cells, the shape functions are evaluated with dense
+ * products of the matrices of shape function values and gradients in the
+ * quadrature points, unless the quadrature formula has the tensor product
+ * structure of QGaussCollapsedSimplex (simplices) or QGaussWedge (wedges),
+ * for which ShapeInfo sets up sum-factorization kernels in collapsed
+ * coordinates for FE_SimplexP, FE_SimplexDGP, and FE_WedgeP, provided they
+ * need fewer operations. With the common formulas QGaussSimplex and
+ * QWitherdenVincentSimplex, the dense kernels are used.
+ *
  * For details on usage of this class, see the description of FEEvaluation or
  * the
  * @ref matrixfree "matrix-free topic".
@@ -213,7 +222,14 @@ public:
        * Use the traditional coloring algorithm: this is like
        * TasksParallelScheme::partition_color, but only uses one partition.
        */
-      color = internal::MatrixFreeFunctions::TaskInfo::color
+      color = internal::MatrixFreeFunctions::TaskInfo::color,
+      /**
+       * Keep the cell order of the loop without threads and let each thread
+       * work on a contiguous block of cells, with dynamic scheduling only for
+       * the cells at the boundary between the blocks.
+       */
+      contiguous_blocks =
+        internal::MatrixFreeFunctions::TaskInfo::contiguous_blocks
     };
 
     /**
@@ -252,6 +268,9 @@ public:
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
       , store_ghost_cells(false)
       , communicator_sm(MPI_COMM_SELF)
+      , interior_fraction_before_ghosts(0.5)
+      , compute_jacobians_in_reinit(false)
+      , autotune_evaluation_kernels(false)
     {}
 
     /**
@@ -279,6 +298,11 @@ public:
       , allow_ghosted_vectors_in_loops(other.allow_ghosted_vectors_in_loops)
       , store_ghost_cells(other.store_ghost_cells)
       , communicator_sm(other.communicator_sm)
+      , interior_fraction_before_ghosts(other.interior_fraction_before_ghosts)
+      , overlap_statistics_callback(other.overlap_statistics_callback)
+      , compute_jacobians_in_reinit(other.compute_jacobians_in_reinit)
+      , autotune_evaluation_kernels(other.autotune_evaluation_kernels)
+      , autotuning_cache_file(other.autotuning_cache_file)
     {}
 
     /**
@@ -288,7 +312,7 @@ public:
     operator=(const AdditionalData &other) = default;
 
     /**
-     * Set the scheme for task parallelism. There are four options available.
+     * Set the scheme for task parallelism. There are five options available.
      * If set to @p none, the operator application is done in serial without
      * shared memory parallelism. If this class is used together with MPI and
      * MPI is also used for parallelism within the nodes, this flag should be
@@ -315,6 +339,20 @@ public:
      * might degrade parallel performance (bad cache behavior, many
      * synchronization points).
      *
+     * The fourth option @p contiguous_blocks is intended for hybrid runs with
+     * MPI and threads. It keeps the cell order of the loop without threads,
+     * including the overlap of communication and computation, and splits each
+     * of the parts of this loop into contiguous blocks of cells, one per
+     * thread. Each block is statically assigned to the same thread in every
+     * loop, so the vector entries of a block are zeroed (see the argument
+     * `zero_dst_vector` of the loop functions), processed by the operations
+     * before and after the loop, and computed on by the thread owning the
+     * block, which keeps them in the caches and memory of that thread in
+     * subsequent loops. The cells that access vector entries also accessed
+     * by another block are colored and scheduled dynamically among the threads
+     * after the other cells of the part are done. Unlike the other options,
+     * this scheme is also available with the oneAPI version of TBB.
+     *
      * @note Threading support is currently experimental for the case inner
      * face integrals are performed and it is recommended to use MPI
      * parallelism if possible. While the scheme has been verified to work
@@ -541,6 +579,92 @@ public:
      * Shared-memory MPI communicator. Default: MPI_COMM_SELF.
      */
     MPI_Comm communicator_sm;
+
+    /**
+     * With @p overlap_communication_computation enabled, the cells are split
+     * into the cells that access vector entries owned by other processes and
+     * the interior cells that do not. The loops without thread parallelism
+     * (@p tasks_parallel_scheme set to @p none) start the exchange of ghost
+     * values, work on a first set of interior cells while the messages are
+     * in flight, wait for the ghost values and work on the cells that need
+     * them, start the compress operation, and work on the remaining interior
+     * cells while the compress messages are in flight. This variable
+     * controls the fraction of the interior cells that is scheduled before
+     * the cells with ghost data. The default of 0.5 works well for loops
+     * that both read ghost values and add contributions into ghost entries,
+     * such as MatrixFree::cell_loop() for continuous elements. A value of
+     * one is better suited for loops in which the exchange of ghost values
+     * is more expensive than the compress operation, e.g., because the
+     * source vector has more ghost entries than the destination vector, and
+     * a value of zero for the opposite case. The statistics provided through
+     * @p overlap_statistics_callback can help to choose this value.
+     */
+    double interior_fraction_before_ghosts;
+
+    /**
+     * A function that is called at the end of each loop without thread
+     * parallelism with statistics about the number of cell batches worked
+     * on while messages were in flight, the time spent on them, and the time
+     * spent waiting for the ghost value update and the compress operation,
+     * see internal::MatrixFreeFunctions::LoopOverlapStatistics. This can be
+     * used to check whether the communication is hidden behind the
+     * computations. If empty (the default), no statistics are collected and
+     * no timers are called in the loops.
+     */
+    std::function<void(
+      const internal::MatrixFreeFunctions::LoopOverlapStatistics &)>
+      overlap_statistics_callback;
+
+    /**
+     * By default, the inverse Jacobians and the JxW values of the
+     * transformation from the unit to the real cell are stored at every
+     * quadrature point of cells with a general (non-affine) geometry. For
+     * curved high-order meshes, reading this data from memory dominates the
+     * cost of operator evaluation in FEEvaluation. If this flag is set to
+     * @p true, only the support points of the mapping are stored for these
+     * cells, i.e., $(k+1)^d$ points per cell for a mapping of degree $k$
+     * rather than $d^2+1$ numbers per quadrature point, and the Jacobians
+     * are computed in FEEvaluation::reinit() by sum factorization. This
+     * trades memory transfer for arithmetic work.
+     *
+     * This option is only used for a MappingQ (or derived class) without
+     * hp-adaptivity and when the second derivatives of the mapping (update
+     * flag @p update_jacobian_grads, implied by @p update_hessians) are not
+     * requested; otherwise, the data is stored as usual. The data on faces
+     * is always stored. The cells are still only accessible from
+     * FEEvaluation::reinit() with a cell batch index, not with the variant
+     * taking an array of cell indices. The default is @p false.
+     */
+    bool compute_jacobians_in_reinit;
+
+    /**
+     * The sum-factorization kernels used by FEEvaluation are selected by the
+     * type of the element and a static heuristic on the polynomial degree
+     * and number of quadrature points. For symmetric elements such as FE_Q
+     * or FE_DGQ with between $k+1$ and $3k/2+1$ quadrature points per
+     * direction, the evaluation can either transform to a collocation basis
+     * in the quadrature points or apply the 1d shape functions directly with
+     * the even-odd decomposition, and the faster choice depends on the
+     * hardware. If this flag is set to @p true, both variants are
+     * micro-benchmarked on the present hardware during reinit() for each
+     * combination of polynomial degree, number of quadrature points, and
+     * number of components of an FESystem, and the faster variant is used in
+     * all cell and face evaluations. The result is cached for the remainder
+     * of the program, such that the measurement is only done once per
+     * configuration; elements and quadrature formulas that agree in these
+     * parameters share the selection. The selection of the first MPI process
+     * is used on all processes. The default is @p false.
+     */
+    bool autotune_evaluation_kernels;
+
+    /**
+     * If autotune_evaluation_kernels is set, this file is used to persist
+     * the selected kernels between program runs: The selections are read
+     * from this file if it exists, and new selections are appended to it.
+     * Only the first MPI process accesses the file. If empty, which is the
+     * default, the selection is only cached in memory.
+     */
+    std::string autotuning_cache_file;
   };
 
   /**
@@ -3470,9 +3594,10 @@ namespace internal
      * exchange on a subset of DoFs
      */
     template <typename VectorType,
-              std::enable_if_t<has_update_ghost_values_start<VectorType> &&
-                                 !has_exchange_on_subset<VectorType>,
-                               VectorType> * = nullptr>
+              std::enable_if_t<
+                has_update_ghost_values_start<VectorType> &&
+                  !has_exchange_on_subset_for_number<VectorType, Number>,
+                VectorType> * = nullptr>
     void
     update_ghost_values_start(const unsigned int component_in_block_vector,
                               const VectorType  &vec)
@@ -3502,9 +3627,10 @@ namespace internal
      * i.e. LinearAlgebra::distributed::Vector
      */
     template <typename VectorType,
-              std::enable_if_t<has_update_ghost_values_start<VectorType> &&
-                                 has_exchange_on_subset<VectorType>,
-                               VectorType> * = nullptr>
+              std::enable_if_t<
+                has_update_ghost_values_start<VectorType> &&
+                  has_exchange_on_subset_for_number<VectorType, Number>,
+                VectorType> * = nullptr>
     void
     update_ghost_values_start(const unsigned int component_in_block_vector,
                               const VectorType  &vec)
@@ -3578,9 +3704,10 @@ namespace internal
      * exchange on a subset of DoFs
      */
     template <typename VectorType,
-              std::enable_if_t<has_update_ghost_values_start<VectorType> &&
-                                 !has_exchange_on_subset<VectorType>,
-                               VectorType> * = nullptr>
+              std::enable_if_t<
+                has_update_ghost_values_start<VectorType> &&
+                  !has_exchange_on_subset_for_number<VectorType, Number>,
+                VectorType> * = nullptr>
     void
     update_ghost_values_finish(const unsigned int component_in_block_vector,
                                const VectorType  &vec)
@@ -3602,9 +3729,10 @@ namespace internal
      * i.e. LinearAlgebra::distributed::Vector
      */
     template <typename VectorType,
-              std::enable_if_t<has_update_ghost_values_start<VectorType> &&
-                                 has_exchange_on_subset<VectorType>,
-                               VectorType> * = nullptr>
+              std::enable_if_t<
+                has_update_ghost_values_start<VectorType> &&
+                  has_exchange_on_subset_for_number<VectorType, Number>,
+                VectorType> * = nullptr>
     void
     update_ghost_values_finish(const unsigned int component_in_block_vector,
                                const VectorType  &vec)
@@ -3689,9 +3817,10 @@ namespace internal
      * exchange on a subset of DoFs
      */
     template <typename VectorType,
-              std::enable_if_t<has_compress_start<VectorType> &&
-                                 !has_exchange_on_subset<VectorType>,
-                               VectorType> * = nullptr>
+              std::enable_if_t<
+                has_compress_start<VectorType> &&
+                  !has_exchange_on_subset_for_number<VectorType, Number>,
+                VectorType> * = nullptr>
     void
     compress_start(const unsigned int component_in_block_vector,
                    VectorType        &vec)
@@ -3710,9 +3839,10 @@ namespace internal
      * i.e. LinearAlgebra::distributed::Vector
      */
     template <typename VectorType,
-              std::enable_if_t<has_compress_start<VectorType> &&
-                                 has_exchange_on_subset<VectorType>,
-                               VectorType> * = nullptr>
+              std::enable_if_t<
+                has_compress_start<VectorType> &&
+                  has_exchange_on_subset_for_number<VectorType, Number>,
+                VectorType> * = nullptr>
     void
     compress_start(const unsigned int component_in_block_vector,
                    VectorType        &vec)
@@ -3776,9 +3906,10 @@ namespace internal
      * exchange on a subset of DoFs
      */
     template <typename VectorType,
-              std::enable_if_t<has_compress_start<VectorType> &&
-                                 !has_exchange_on_subset<VectorType>,
-                               VectorType> * = nullptr>
+              std::enable_if_t<
+                has_compress_start<VectorType> &&
+                  !has_exchange_on_subset_for_number<VectorType, Number>,
+                VectorType> * = nullptr>
     void
     compress_finish(const unsigned int component_in_block_vector,
                     VectorType        &vec)
@@ -3796,9 +3927,10 @@ namespace internal
      * i.e. LinearAlgebra::distributed::Vector
      */
     template <typename VectorType,
-              std::enable_if_t<has_compress_start<VectorType> &&
-                                 has_exchange_on_subset<VectorType>,
-                               VectorType> * = nullptr>
+              std::enable_if_t<
+                has_compress_start<VectorType> &&
+                  has_exchange_on_subset_for_number<VectorType, Number>,
+                VectorType> * = nullptr>
     void
     compress_finish(const unsigned int component_in_block_vector,
                     VectorType        &vec)
@@ -3865,9 +3997,10 @@ namespace internal
      * exchange on a subset of DoFs
      */
     template <typename VectorType,
-              std::enable_if_t<!has_exchange_on_subset<VectorType> &&
-                                 !is_not_parallel_vector<VectorType>,
-                               VectorType> * = nullptr>
+              std::enable_if_t<
+                !has_exchange_on_subset_for_number<VectorType, Number> &&
+                  !is_not_parallel_vector<VectorType>,
+                VectorType> * = nullptr>
     void
     reset_ghost_values(const VectorType &vec) const
     {
@@ -3885,8 +4018,9 @@ namespace internal
      * LinearAlgebra::distributed::Vector
      */
     template <typename VectorType,
-              std::enable_if_t<has_exchange_on_subset<VectorType>, VectorType>
-                * = nullptr>
+              std::enable_if_t<
+                has_exchange_on_subset_for_number<VectorType, Number>,
+                VectorType> * = nullptr>
     void
     reset_ghost_values(const VectorType &vec) const
     {
@@ -3932,10 +4066,9 @@ namespace internal
     void
     zero_vector_region(const unsigned int range_index, VectorType &vec) const
     {
-      static_assert(std::is_same_v<Number, typename VectorType::value_type>,
-                    "Type mismatch between VectorType and VectorDataExchange");
+      using VectorNumber = typename VectorType::value_type;
       if (range_index == numbers::invalid_unsigned_int)
-        vec = Number();
+        vec = VectorNumber();
       else
         {
           const unsigned int mf_component = find_vector_in_mf(vec, false);
@@ -3956,7 +4089,7 @@ namespace internal
                         0,
                         (dof_info.vector_zero_range_list[id].second -
                          dof_info.vector_zero_range_list[id].first) *
-                          sizeof(Number));
+                          sizeof(VectorNumber));
         }
     }
 
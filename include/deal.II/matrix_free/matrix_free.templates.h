@@ -40,6 +40,7 @@
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 
 #include <deal.II/matrix_free/constraint_info.h>
+#include <deal.II/matrix_free/evaluation_autotuning.h>
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/face_setup_internal.h>
 #include <deal.II/matrix_free/hanging_nodes_internal.h>
@@ -430,6 +431,26 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
             for (unsigned int q_no = 0; q_no < quad[nq].size(); ++q_no)
               shape_info(c, nq, fe_no, q_no)
                 .reinit(quad[nq][q_no], dof_handler[no]->get_fe(fe_no), b);
+
+    // Select the fastest sum-factorization kernels for the given hardware
+    // if requested.
+    if (additional_data.autotune_evaluation_kernels)
+      for (unsigned int no = 0, c = 0; no < dof_handler.size(); ++no)
+        for (unsigned int b = 0;
+             b < dof_handler[no]->get_fe(0).n_base_elements();
+             ++b, ++c)
+          for (unsigned int fe_no = 0;
+               fe_no < dof_handler[no]->get_fe_collection().size();
+               ++fe_no)
+            for (unsigned int nq = 0; nq < n_quad; ++nq)
+              for (unsigned int q_no = 0; q_no < quad[nq].size(); ++q_no)
+                internal::MatrixFreeFunctions::autotune_evaluation_variant<
+                  dim,
+                  VectorizedArrayType>(
+                  shape_info(c, nq, fe_no, q_no),
+                  dof_handler[no]->get_fe(fe_no).element_multiplicity(b),
+                  additional_data.autotuning_cache_file,
+                  dof_handler[0]->get_mpi_communicator());
   }
 
   // Vector of DoFHandler indices of those that are in hp-mode
@@ -461,6 +482,15 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
 
       task_info.allow_ghosted_vectors_in_loops =
         additional_data.allow_ghosted_vectors_in_loops;
+      Assert(additional_data.interior_fraction_before_ghosts >= 0. &&
+               additional_data.interior_fraction_before_ghosts <= 1.,
+             ExcMessage("The fraction of interior cells to be scheduled "
+                        "before the cells with ghost data must be between "
+                        "zero and one."));
+      task_info.interior_fraction_before_ghosts =
+        additional_data.interior_fraction_before_ghosts;
+      task_info.overlap_statistics_callback =
+        additional_data.overlap_statistics_callback;
 
       task_info.communicator    = dof_handler[0]->get_mpi_communicator();
       task_info.communicator_sm = additional_data.communicator_sm;
@@ -493,17 +523,22 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
 
         // initialize the basic multithreading information that needs to be
         // passed to the DoFInfo structure
-#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
-      if (additional_data.tasks_parallel_scheme != AdditionalData::none &&
+      if (additional_data.tasks_parallel_scheme ==
+            AdditionalData::contiguous_blocks &&
           MultithreadInfo::n_threads() > 1)
+        task_info.scheme =
+          internal::MatrixFreeFunctions::TaskInfo::contiguous_blocks;
+#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
+      else if (additional_data.tasks_parallel_scheme != AdditionalData::none &&
+               MultithreadInfo::n_threads() > 1)
         {
           task_info.scheme =
             internal::MatrixFreeFunctions::TaskInfo::TasksParallelScheme(
               static_cast<int>(additional_data.tasks_parallel_scheme));
           task_info.block_size = additional_data.tasks_block_size;
         }
-      else
 #endif
+      else
         task_info.scheme = internal::MatrixFreeFunctions::TaskInfo::none;
 
       // set dof_indices together with constraint_indicator and
@@ -856,7 +891,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         additional_data.mapping_update_flags_boundary_faces,
         additional_data.mapping_update_flags_inner_faces,
         additional_data.mapping_update_flags_faces_by_cells,
-        piola_transform);
+        piola_transform,
+        additional_data.compute_jacobians_in_reinit);
 
       mapping_is_initialized = true;
     }
@@ -1543,6 +1579,8 @@ namespace internal
 
     Assert(
       task_info.scheme == internal::MatrixFreeFunctions::TaskInfo::none ||
+        task_info.scheme ==
+          internal::MatrixFreeFunctions::TaskInfo::contiguous_blocks ||
         cell_vectorization_category.empty(),
       ExcMessage(
         "You explicitly requested re-categorization of cells; however, this "
@@ -1550,7 +1588,9 @@ namespace internal
         "threading in MatrixFree by setting "
         "MatrixFree::Additional_data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none."));
 
-    if (task_info.scheme == internal::MatrixFreeFunctions::TaskInfo::none)
+    if (task_info.scheme == internal::MatrixFreeFunctions::TaskInfo::none ||
+        task_info.scheme ==
+          internal::MatrixFreeFunctions::TaskInfo::contiguous_blocks)
       {
         const bool strict_categories =
           cell_vectorization_categories_strict || hp_functionality_enabled;
@@ -2013,7 +2053,9 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
 
       std::vector<bool> hard_vectorization_boundary(
         task_info.face_partition_data.size(), false);
-      if (task_info.scheme == internal::MatrixFreeFunctions::TaskInfo::none)
+      if (task_info.scheme == internal::MatrixFreeFunctions::TaskInfo::none ||
+          task_info.scheme ==
+            internal::MatrixFreeFunctions::TaskInfo::contiguous_blocks)
         {
           // In case we do an MPI data exchange, we must make sure to first
           // complete all face integrals with results in the ghost range
@@ -2153,6 +2195,23 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
   for (auto &di : dof_info)
     di.compute_vector_zero_access_pattern(task_info, face_info.faces);
 
+  // find the chunks of cells that can be run by the threads independently
+  // of the other threads
+  if (task_info.scheme ==
+      internal::MatrixFreeFunctions::TaskInfo::contiguous_blocks)
+    {
+      const unsigned int n_chunks =
+        task_info.partition_row_index[task_info.partition_row_index.size() -
+                                      2];
+      DynamicSparsityPattern connectivity(n_chunks, n_chunks);
+      for (const auto &di : dof_info)
+        di.make_chunk_connectivity_graph(task_info,
+                                         face_info.faces,
+                                         connectivity);
+      task_info.make_contiguous_thread_blocks(connectivity,
+                                              MultithreadInfo::n_threads());
+    }
+
 #ifdef DEAL_II_WITH_MPI
   {
     // non-buffering mode is only supported if the indices of all cells are
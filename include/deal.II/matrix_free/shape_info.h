@@ -25,6 +25,8 @@
 #include <deal.II/base/table.h>
 #include <deal.II/base/vectorization.h>
 
+#include <deal.II/matrix_free/collapsed_shape_data.h>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -491,6 +493,15 @@ namespace internal
        */
       dealii::Table<2, UnivariateShapeData<Number> *> data_access;
 
+      /**
+       * For scalar elements on simplices and wedges evaluated with a
+       * quadrature formula of suitable tensor structure, a factorized
+       * representation of the shape functions that allows for sum
+       * factorization, see CollapsedShapeData. Not initialized for all other
+       * elements.
+       */
+      CollapsedShapeData<Number> collapsed_data;
+
       /**
        * Stores the number of space dimensions.
        */
@@ -44,6 +44,7 @@
 
 #include <deal.II/lac/householder.h>
 
+#include <deal.II/matrix_free/collapsed_shape_data.templates.h>
 #include <deal.II/matrix_free/shape_info.h>
 #include <deal.II/matrix_free/util.h>
 
@@ -238,6 +239,9 @@ namespace internal
                               const FiniteElement<dim, spacedim> &fe_in,
                               const unsigned int base_element_number)
     {
+      // only set up for simplex and wedge elements below
+      collapsed_data = CollapsedShapeData<Number>();
+
       // ShapeInfo for RT elements. Here, data is of size 2 instead of 1.
       // data[0] is univariate_shape_data in normal direction and
       // data[1] is univariate_shape_data in tangential direction
@@ -377,6 +381,15 @@ namespace internal
                   shape_gradients[i * dim * n_q_points + q * dim + d] = grad[d];
               }
 
+          collapsed_data.reinit(
+            fe.reference_cell(),
+            fe.degree,
+            quad,
+            n_dofs,
+            [&fe](const unsigned int i, const Point<dim> &p) {
+              return fe.shape_value(i, p);
+            });
+
           {
             const auto reference_cell = fe.reference_cell();
 
@@ -1323,6 +1336,7 @@ namespace internal
       std::size_t memory = sizeof(*this);
       for (const auto &univariate_shape_data : data)
         memory += univariate_shape_data.memory_consumption();
+      memory += collapsed_data.memory_consumption();
       return memory;
     }
 
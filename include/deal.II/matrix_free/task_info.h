@@ -25,6 +25,8 @@
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/vectorization.h>
 
+#include <functional>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -98,6 +100,66 @@ namespace internal
 
   namespace MatrixFreeFunctions
   {
+    /**
+     * A struct that collects statistics about the overlap of communication
+     * and computation in one matrix-free loop without thread parallelism.
+     * The cell batches are split into the interior cells that do not need
+     * any ghost data, which are worked on while the ghost values are
+     * exchanged and while the compress operation is in progress, and the
+     * cells that need data from other processes. The times are wall times in
+     * seconds. If the wait times are large compared to the time spent on the
+     * interior cells, the communication could not be hidden behind the
+     * computations.
+     */
+    struct LoopOverlapStatistics
+    {
+      /**
+       * Number of cell batches worked on after starting the ghost value
+       * update and before waiting for its completion.
+       */
+      unsigned int n_cell_batches_during_update_ghosts = 0;
+
+      /**
+       * Number of cell batches that need ghost data, worked on between the
+       * completion of the ghost value update and the start of the compress
+       * operation.
+       */
+      unsigned int n_cell_batches_with_ghosts = 0;
+
+      /**
+       * Number of cell batches worked on after starting the compress
+       * operation and before waiting for its completion.
+       */
+      unsigned int n_cell_batches_during_compress = 0;
+
+      /**
+       * Time spent on the cell batches during the ghost value update.
+       */
+      double compute_time_during_update_ghosts = 0.;
+
+      /**
+       * Time spent on the cell batches that need ghost data.
+       */
+      double compute_time_with_ghosts = 0.;
+
+      /**
+       * Time spent on the cell batches during the compress operation.
+       */
+      double compute_time_during_compress = 0.;
+
+      /**
+       * Time spent waiting for the completion of the ghost value update.
+       */
+      double wait_time_update_ghosts = 0.;
+
+      /**
+       * Time spent waiting for the completion of the compress operation.
+       */
+      double wait_time_compress = 0.;
+    };
+
+
+
     /**
      * A struct that collects all information related to parallelization with
      * threads: The work is subdivided into tasks that can be done
@@ -108,13 +170,15 @@ namespace internal
       // enum for choice of how to build the task graph. Odd add versions with
       // preblocking and even versions with postblocking. partition_partition
       // and partition_color are deprecated but kept for backward
-      // compatibility.
+      // compatibility. contiguous_blocks keeps the cell order of the serial
+      // loop and assigns contiguous blocks of chunks to the threads.
       enum TasksParallelScheme
       {
         none,
         partition_partition,
         partition_color,
-        color
+        color,
+        contiguous_blocks
       };
 
       /**
@@ -398,6 +462,26 @@ namespace internal
                         std::vector<unsigned int>    &partition_size,
                         unsigned int                 &partition) const;
 
+      /**
+       * Sets up the data structures for the scheme contiguous_blocks on top
+       * of the chunks created by create_blocks_serial(): The chunks of each
+       * of the three parts of the serial loop are split into
+       * n_thread_blocks contiguous blocks with a similar number of cell
+       * batches, one for each thread. Chunks that access vector entries also
+       * accessed by a chunk of another thread block are marked as being at
+       * the thread boundary, and colored such that chunks of the same color
+       * can be run concurrently.
+       *
+       * @param connectivity Connectivity between the chunks of cells (within
+       * the same part of the loop) that access the same vector entries, see
+       * DoFInfo::make_chunk_connectivity_graph().
+       *
+       * @param n_threads The number of thread blocks to create.
+       */
+      void
+      make_contiguous_thread_blocks(const DynamicSparsityPattern &connectivity,
+                                    const unsigned int            n_threads);
+
       /**
        * Update fields of task info for task graph set up in
        * make_thread_graph.
@@ -604,6 +688,46 @@ namespace internal
        */
       std::vector<unsigned char> task_at_mpi_boundary;
 
+      /**
+       * Number of contiguous blocks of chunks per part of the loop in the
+       * scheme contiguous_blocks, one per thread.
+       */
+      unsigned int n_thread_blocks;
+
+      /**
+       * The first chunk of each thread block in the scheme
+       * contiguous_blocks, with n_thread_blocks+1 entries for each part of
+       * the loop, i.e., the chunks of thread block t in part p are given by
+       * the range thread_block_partition_data[p * (n_thread_blocks + 1) + t]
+       * to thread_block_partition_data[p * (n_thread_blocks + 1) + t + 1].
+       */
+      std::vector<unsigned int> thread_block_partition_data;
+
+      /**
+       * Stores whether a chunk accesses vector entries that are also
+       * accessed by another thread block in the scheme contiguous_blocks.
+       * The chunks without conflicts are run by the thread owning the block,
+       * the others in a subsequent phase with colors.
+       */
+      std::vector<unsigned char> chunk_at_thread_boundary;
+
+      /**
+       * The chunks at the thread boundary, sorted by the parts of the loop
+       * and by colors within each part.
+       */
+      std::vector<unsigned int> thread_boundary_chunks;
+
+      /**
+       * The first entry in @p thread_boundary_chunks of each color.
+       */
+      std::vector<unsigned int> thread_boundary_color_data;
+
+      /**
+       * The first color within @p thread_boundary_color_data of each part of
+       * the loop.
+       */
+      std::vector<unsigned int> thread_boundary_color_row_index;
+
       /**
        * MPI communicator
        */
@@ -619,6 +743,23 @@ namespace internal
        */
       bool allow_ghosted_vectors_in_loops;
 
+      /**
+       * Fraction of the cell batches without ghost data that are placed
+       * before the cells with ghost data in the loop without thread
+       * parallelism, i.e., that are worked on while the ghost values are
+       * exchanged. The remaining interior cell batches are worked on while
+       * the compress operation is in progress.
+       */
+      double interior_fraction_before_ghosts;
+
+      /**
+       * A function that is called with statistics about the overlap of
+       * communication and computation at the end of each loop without
+       * thread parallelism. If empty, no statistics are collected.
+       */
+      std::function<void(const LoopOverlapStatistics &)>
+        overlap_statistics_callback;
+
       /**
        * Rank of MPI process
        */
@@ -740,6 +740,131 @@ namespace internal
 
 
 
+  /**
+   * Register tile of the matrix-vector kernel with run-time loop bounds that
+   * computes @p n_tile_columns consecutive output entries of @p n_lines
+   * independent lines of a tensor-product array at once. Each matrix entry
+   * loaded from memory is used for all lines and each input entry for all
+   * columns of the tile, which roughly halves the number of loads per
+   * arithmetic operation compared to working on a single line at a time.
+   * The lines start at @p in and @p out and are separated by
+   * @p line_stride_in and @p line_stride_out, respectively.
+   */
+  template <int  n_lines,
+            int  n_tile_columns,
+            bool transpose_matrix,
+            bool add,
+            typename Number,
+            typename Number2>
+  inline void
+  apply_matrix_vector_product_tile(const Number2 *matrix,
+                                   const Number  *in,
+                                   Number        *out,
+                                   const int      mm,
+                                   const int      n_columns,
+                                   const int      stride_in,
+                                   const int      stride_out,
+                                   const int      line_stride_in,
+                                   const int      line_stride_out)
+  {
+    const int stride_matrix_i   = transpose_matrix ? n_columns : 1;
+    const int stride_matrix_col = transpose_matrix ? 1 : n_columns;
+
+    Number res[n_tile_columns][n_lines];
+    for (int c = 0; c < n_tile_columns; ++c)
+      {
+        const Number2 m = matrix[c * stride_matrix_col];
+        for (int l = 0; l < n_lines; ++l)
+          res[c][l] = m * in[l * line_stride_in];
+      }
+    for (int i = 1; i < mm; ++i)
+      {
+        Number x[n_lines];
+        for (int l = 0; l < n_lines; ++l)
+          x[l] = in[l * line_stride_in + i * stride_in];
+        for (int c = 0; c < n_tile_columns; ++c)
+          {
+            const Number2 m =
+              matrix[i * stride_matrix_i + c * stride_matrix_col];
+            for (int l = 0; l < n_lines; ++l)
+              res[c][l] += m * x[l];
+          }
+      }
+    for (int c = 0; c < n_tile_columns; ++c)
+      for (int l = 0; l < n_lines; ++l)
+        if (add)
+          out[l * line_stride_out + c * stride_out] += res[c][l];
+        else
+          out[l * line_stride_out + c * stride_out] = res[c][l];
+  }
+
+
+
+  /**
+   * Matrix-vector kernel with run-time loop bounds for the generic evaluator
+   * that works on @p n_lines lines at once, using register tiles of three
+   * output entries per line. This is used for polynomial degrees without
+   * precompiled templated kernels. The input and output arrays must not
+   * overlap.
+   */
+  template <int  n_lines,
+            bool transpose_matrix,
+            bool add,
+            typename Number,
+            typename Number2>
+  inline void
+  apply_matrix_vector_product_lines(const Number2 *matrix,
+                                    const Number  *in,
+                                    Number        *out,
+                                    const int      n_rows,
+                                    const int      n_columns,
+                                    const int      stride_in,
+                                    const int      stride_out,
+                                    const int      line_stride_in,
+                                    const int      line_stride_out)
+  {
+    const int mm = transpose_matrix ? n_rows : n_columns,
+              nn = transpose_matrix ? n_columns : n_rows;
+    const int stride_matrix_col = transpose_matrix ? 1 : n_columns;
+
+    int col = 0;
+    for (; col + 3 <= nn; col += 3)
+      apply_matrix_vector_product_tile<n_lines, 3, transpose_matrix, add>(
+        matrix + col * stride_matrix_col,
+        in,
+        out + col * stride_out,
+        mm,
+        n_columns,
+        stride_in,
+        stride_out,
+        line_stride_in,
+        line_stride_out);
+    if (nn - col == 2)
+      apply_matrix_vector_product_tile<n_lines, 2, transpose_matrix, add>(
+        matrix + col * stride_matrix_col,
+        in,
+        out + col * stride_out,
+        mm,
+        n_columns,
+        stride_in,
+        stride_out,
+        line_stride_in,
+        line_stride_out);
+    else if (nn - col == 1)
+      apply_matrix_vector_product_tile<n_lines, 1, transpose_matrix, add>(
+        matrix + col * stride_matrix_col,
+        in,
+        out + col * stride_out,
+        mm,
+        n_columns,
+        stride_in,
+        stride_out,
+        line_stride_in,
+        line_stride_out);
+  }
+
+
+
   /**
    * Internal evaluator specialized for "symmetric" finite elements, i.e.,
    * when the shape functions and quadrature points are symmetric about the
@@ -2102,6 +2227,53 @@ namespace internal
                             Utilities::fixed_power<dim - direction - 1>(n_rows);
     Assert(n_rows <= 128, ExcNotImplemented());
 
+    // For the generic variant, work on four lines at once with register
+    // tiles, provided that the input and output arrays do not overlap. In
+    // direction 0, the lines are contiguous and follow each other, whereas
+    // the lines in the other directions are interleaved with stride one.
+    constexpr int n_lines = 4;
+    if constexpr (variant != evaluate_evenodd && one_line == false &&
+                  stride == 1)
+      if (in + n_blocks2 * stride_operation * mm <= out ||
+          out + n_blocks2 * stride_operation * nn <= in)
+        {
+          const int n_lines_per_block = direction == 0 ? n_blocks2 : n_blocks1;
+          const int n_blocks          = direction == 0 ? 1 : n_blocks2;
+          const int line_stride_in    = direction == 0 ? mm : 1;
+          const int line_stride_out   = direction == 0 ? nn : 1;
+          for (int i2 = 0; i2 < n_blocks; ++i2)
+            {
+              int i1 = 0;
+              for (; i1 + n_lines <= n_lines_per_block; i1 += n_lines)
+                apply_matrix_vector_product_lines<n_lines,
+                                                  contract_over_rows,
+                                                  add>(
+                  shape_data,
+                  in + i1 * line_stride_in,
+                  out + i1 * line_stride_out,
+                  n_rows,
+                  n_columns,
+                  stride_operation,
+                  stride_operation,
+                  line_stride_in,
+                  line_stride_out);
+              for (; i1 < n_lines_per_block; ++i1)
+                apply_matrix_vector_product_lines<1, contract_over_rows, add>(
+                  shape_data,
+                  in + i1 * line_stride_in,
+                  out + i1 * line_stride_out,
+                  n_rows,
+                  n_columns,
+                  stride_operation,
+                  stride_operation,
+                  line_stride_in,
+                  line_stride_out);
+              in += stride_operation * mm;
+              out += stride_operation * nn;
+            }
+          return;
+        }
+
     constexpr int stride_in  = !contract_over_rows ? stride : 1;
     constexpr int stride_out = contract_over_rows ? stride : 1;
     for (int i2 = 0; i2 < n_blocks2; ++i2)
@@ -27,6 +27,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <set>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -263,6 +265,69 @@ namespace MatrixFreeTools
 
 
 
+  /**
+   * Compute the diagonal of a linear operator (@p diagonal_global) whose
+   * cell integral is of the form "evaluate values and/or gradients, apply a
+   * linear operation at each quadrature point, integrate", with the
+   * operation at quadrature points given by @p quad_operation. The latter is
+   * called as `quad_operation(phi, q)` for the FEEvaluation object `phi` and
+   * the quadrature point index `q`, and must only combine the values and
+   * gradients at the same quadrature point, e.g., by
+   * `phi.submit_gradient(phi.get_gradient(q), q)` for a Laplacian. The flags
+   * @p evaluation_flags and @p integration_flags are passed to
+   * FEEvaluation::evaluate() and FEEvaluation::integrate(), respectively,
+   * and may only contain EvaluationFlags::values and
+   * EvaluationFlags::gradients.
+   *
+   * In contrast to the variant taking a cell operation above, which applies
+   * the cell operator to all unit vectors of a cell at a cost of
+   * $\mathcal O(k^{2d+1})$ operations per cell for polynomial degree $k$,
+   * this function uses the tensor-product structure of the operator: The
+   * linear operation at the quadrature points is first recovered by
+   * applying @p quad_operation to unit values and gradients at all
+   * quadrature points of a cell batch at once, and the diagonal is then
+   * computed by sum factorization with the squares of the 1d shape
+   * functions, at a cost of $\mathcal O(k^{d+1})$ per cell. Cell batches
+   * with constraints beyond a plain mapping to global indices, e.g. hanging
+   * node constraints, and elements without tensor-product shape functions
+   * fall back to the evaluation with unit vectors.
+   *
+   * The parameters @p dof_handler_index, @p quadrature_index, and @p first_selected_component are
+   * passed to the constructor of the FEEvaluation that is internally set up.
+   * The parameter @p first_vector_component is used to select the right
+   * starting block in a block vector. This function only participates in
+   * overload resolution if @p quad_operation can be called with an
+   * FEEvaluation object and a quadrature point index.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType,
+            typename QuadOperation>
+  std::enable_if_t<std::is_invocable_v<const QuadOperation &,
+                                       FEEvaluation<dim,
+                                                    fe_degree,
+                                                    n_q_points_1d,
+                                                    n_components,
+                                                    Number,
+                                                    VectorizedArrayType> &,
+                                       const unsigned int>>
+  compute_diagonal(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType                                         &diagonal_global,
+    const QuadOperation                                &quad_operation,
+    const EvaluationFlags::EvaluationFlags              evaluation_flags,
+    const EvaluationFlags::EvaluationFlags              integration_flags,
+    const unsigned int dof_handler_index        = 0,
+    const unsigned int quadrature_index         = 0,
+    const unsigned int first_selected_component = 0,
+    const unsigned int first_vector_component   = 0);
+
+
+
   /**
    * Compute the matrix representation of a linear operator (@p matrix), given
    * @p matrix_free and the local cell integral operation @p cell_operation.
@@ -1270,6 +1335,36 @@ namespace MatrixFreeTools
           }
       }
 
+      void
+      submit_local_diagonal(const VectorizedArrayType *local_diagonal)
+      {
+        Assert(has_simple_constraints_, ExcInternalError());
+
+        // with simple constraints, each local unknown is mapped to at most
+        // one global index with weight one, so only the diagonal of the
+        // element matrix enters
+        const unsigned int n_fe_components =
+          phi->get_dof_info().start_components.back();
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          {
+            const unsigned int comp =
+              n_fe_components == 1 ? i / dofs_per_component : 0;
+            const unsigned int i_comp =
+              n_fe_components == 1 ? (i % dofs_per_component) : i;
+            for (unsigned int v = 0; v < n_lanes_filled; ++v)
+              {
+                const auto &c_pool = c_pools[v];
+                for (unsigned int jj = c_pool.inverse_lookup_rows[i_comp];
+                     jj < c_pool.inverse_lookup_rows[i_comp + 1];
+                     ++jj)
+                  diagonals_local_constrained
+                    [v][c_pool.inverse_lookup_origins[jj].first +
+                        comp * c_pool.row_lid_to_gid.size()] +=
+                    local_diagonal[i][v];
+              }
+          }
+      }
+
       template <typename VectorType>
       inline void
       distribute_local_to_global(std::vector<VectorType *> &diagonal_global)
@@ -1334,6 +1429,131 @@ namespace MatrixFreeTools
       bool has_simple_constraints_;
     };
 
+
+
+    /**
+     * Compute the diagonal of a cell operator of the form $B^T D B$ by sum
+     * factorization, where $B$ evaluates the values and reference-cell
+     * derivatives of tensor-product shape functions at the quadrature points
+     * and $D$ is a pointwise operator. For a product shape function
+     * $\varphi_i = \prod_k \varphi_{i_k}(\hat x_k)$, the product of two
+     * derivatives of $\varphi_i$ is again a tensor product, with the 1d
+     * factors $\varphi_{i_k}^2$, $\varphi_{i_k}\varphi_{i_k}'$, or
+     * $(\varphi_{i_k}')^2$. Thus, the diagonal is obtained from the
+     * coefficients of $D$ by the same contractions as in
+     * FEEvaluation::integrate() with the squared 1d shape functions.
+     */
+    template <int dim, typename VectorizedArrayType>
+    class ComputeDiagonalTensorProductHelper
+    {
+    public:
+      using Number = typename VectorizedArrayType::value_type;
+
+      /**
+       * Set up the squared 1d shape functions from the shape values and
+       * gradients of @p n_rows 1d shape functions at @p n_columns quadrature
+       * points, stored in the layout of UnivariateShapeData.
+       */
+      void
+      initialize(const AlignedVector<Number> &shape_values,
+                 const AlignedVector<Number> &shape_gradients,
+                 const unsigned int           n_rows,
+                 const unsigned int           n_columns)
+      {
+        AssertDimension(shape_values.size(), n_rows * n_columns);
+        AssertDimension(shape_gradients.size(), n_rows * n_columns);
+        this->n_rows    = n_rows;
+        this->n_columns = n_columns;
+        for (unsigned int d = 0; d < 3; ++d)
+          squared_shapes[d].resize_fast(n_rows * n_columns);
+        for (unsigned int i = 0; i < n_rows * n_columns; ++i)
+          {
+            squared_shapes[0][i] = shape_values[i] * shape_values[i];
+            squared_shapes[1][i] = shape_values[i] * shape_gradients[i];
+            squared_shapes[2][i] = shape_gradients[i] * shape_gradients[i];
+          }
+        const unsigned int size =
+          Utilities::pow(std::max(n_rows, n_columns), dim);
+        tmp[0].resize_fast(size);
+        tmp[1].resize_fast(size);
+      }
+
+      /**
+       * Add the contribution of the coupling between the derivatives
+       * @p a and @p b of the shape functions with the coefficients
+       * @p coefficients at the quadrature points to the @p diagonal of the
+       * cell operator. The derivative index zero denotes the value of the
+       * shape function, and the index $1+k$ the derivative in reference
+       * direction $k$.
+       */
+      void
+      add_diagonal(const unsigned int         a,
+                   const unsigned int         b,
+                   const VectorizedArrayType *coefficients,
+                   VectorizedArrayType       *diagonal)
+      {
+        AssertIndexRange(a, dim + 1);
+        AssertIndexRange(b, dim + 1);
+        dealii::internal::EvaluatorTensorProduct<
+          dealii::internal::evaluate_general,
+          dim,
+          0,
+          0,
+          VectorizedArrayType,
+          Number>
+          eval(squared_shapes[0],
+               squared_shapes[1],
+               squared_shapes[2],
+               n_rows,
+               n_columns);
+
+        if constexpr (dim == 1)
+          apply_direction<0, true>(eval, a, b, coefficients, diagonal);
+        else if constexpr (dim == 2)
+          {
+            apply_direction<1, false>(eval, a, b, coefficients, tmp[0].data());
+            apply_direction<0, true>(eval, a, b, tmp[0].data(), diagonal);
+          }
+        else if constexpr (dim == 3)
+          {
+            apply_direction<2, false>(eval, a, b, coefficients, tmp[0].data());
+            apply_direction<1, false>(
+              eval, a, b, tmp[0].data(), tmp[1].data());
+            apply_direction<0, true>(eval, a, b, tmp[1].data(), diagonal);
+          }
+        else
+          DEAL_II_NOT_IMPLEMENTED();
+      }
+
+    private:
+      template <int direction, bool add, typename Eval>
+      static void
+      apply_direction(const Eval                &eval,
+                      const unsigned int         a,
+                      const unsigned int         b,
+                      const VectorizedArrayType *in,
+                      VectorizedArrayType       *out)
+      {
+        const unsigned int n_derivatives =
+          (a == direction + 1) + (b == direction + 1);
+        if (n_derivatives == 0)
+          eval.template values<direction, false, add>(in, out);
+        else if (n_derivatives == 1)
+          eval.template gradients<direction, false, add>(in, out);
+        else
+          eval.template hessians<direction, false, add>(in, out);
+      }
+
+      unsigned int n_rows;
+      unsigned int n_columns;
+
+      // squared values, product of values and derivatives, and squared
+      // derivatives of the 1d shape functions
+      std::array<AlignedVector<Number>, 3> squared_shapes;
+
+      AlignedVector<VectorizedArrayType> tmp[2];
+    };
+
     template <bool is_face,
               int  dim,
               typename Number,
@@ -2081,6 +2301,253 @@ namespace MatrixFreeTools
       first_vector_component);
   }
 
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType,
+            typename QuadOperation>
+  std::enable_if_t<std::is_invocable_v<const QuadOperation &,
+                                       FEEvaluation<dim,
+                                                    fe_degree,
+                                                    n_q_points_1d,
+                                                    n_components,
+                                                    Number,
+                                                    VectorizedArrayType> &,
+                                       const unsigned int>>
+  compute_diagonal(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType                                         &diagonal_global,
+    const QuadOperation                                &quad_operation,
+    const EvaluationFlags::EvaluationFlags              evaluation_flags,
+    const EvaluationFlags::EvaluationFlags              integration_flags,
+    const unsigned int                                  dof_handler_index,
+    const unsigned int                                  quadrature_index,
+    const unsigned int first_selected_component,
+    const unsigned int first_vector_component)
+  {
+    Assert(!(evaluation_flags & EvaluationFlags::hessians) &&
+             !(integration_flags & EvaluationFlags::hessians),
+           ExcNotImplemented("Only values and gradients are supported."));
+
+    std::vector<typename dealii::internal::BlockVectorSelector<
+      VectorType,
+      IsBlockVector<VectorType>::value>::BaseVectorType *>
+      diagonal_global_components(n_components);
+
+    for (unsigned int d = 0; d < n_components; ++d)
+      diagonal_global_components[d] = dealii::internal::
+        BlockVectorSelector<VectorType, IsBlockVector<VectorType>::value>::
+          get_vector_component(diagonal_global, d + first_vector_component);
+
+    const auto &dof_info = matrix_free.get_dof_info(dof_handler_index);
+    if (dof_info.start_components.back() == 1)
+      for (unsigned int comp = 0; comp < n_components; ++comp)
+        {
+          Assert(diagonal_global_components[comp] != nullptr,
+                 ExcMessage("The finite element underlying this FEEvaluation "
+                            "object is scalar, but you requested " +
+                            std::to_string(n_components) +
+                            " components via the template argument in "
+                            "FEEvaluation. In that case, you must pass an "
+                            "std::vector<VectorType> or a BlockVector to " +
+                            "read_dof_values and distribute_local_to_global."));
+          dealii::internal::check_vector_compatibility(
+            *diagonal_global_components[comp], matrix_free, dof_info);
+        }
+    else
+      {
+        dealii::internal::check_vector_compatibility(
+          *diagonal_global_components[0], matrix_free, dof_info);
+      }
+
+    using FEEvalType = FEEvaluation<dim,
+                                    fe_degree,
+                                    n_q_points_1d,
+                                    n_components,
+                                    Number,
+                                    VectorizedArrayType>;
+
+    using Helper =
+      internal::ComputeDiagonalHelper<dim, VectorizedArrayType, false>;
+    using TensorProductHelper =
+      internal::ComputeDiagonalTensorProductHelper<dim, VectorizedArrayType>;
+
+    Threads::ThreadLocalStorage<Helper>              scratch_data;
+    Threads::ThreadLocalStorage<TensorProductHelper> scratch_data_tensor;
+    Threads::ThreadLocalStorage<AlignedVector<VectorizedArrayType>>
+      scratch_data_coefficients;
+
+    // derivative indices: zero for values, 1 + d for the gradient in
+    // direction d
+    std::vector<unsigned int> in_derivatives, out_derivatives;
+    for (unsigned int d = 0; d < dim + 1; ++d)
+      {
+        const EvaluationFlags::EvaluationFlags flag =
+          d == 0 ? EvaluationFlags::values : EvaluationFlags::gradients;
+        if (evaluation_flags & flag)
+          in_derivatives.push_back(d);
+        if (integration_flags & flag)
+          out_derivatives.push_back(d);
+      }
+    std::set<std::pair<unsigned int, unsigned int>> derivative_pairs;
+    for (const unsigned int a : out_derivatives)
+      for (const unsigned int b : in_derivatives)
+        derivative_pairs.emplace(std::min(a, b), std::max(a, b));
+
+    const auto cell_operation =
+      [&](const auto &, auto &, const auto &, const auto range) {
+        if (internal::is_fe_nothing<false>(matrix_free,
+                                           range,
+                                           dof_handler_index,
+                                           quadrature_index,
+                                           first_selected_component,
+                                           fe_degree,
+                                           n_q_points_1d))
+          return;
+
+        FEEvalType phi(matrix_free,
+                       range,
+                       dof_handler_index,
+                       quadrature_index,
+                       first_selected_component);
+
+        const auto        &shape_info = phi.get_shape_info();
+        const unsigned int dofs_per_component =
+          shape_info.dofs_per_component_on_cell;
+        const unsigned int n_q_points = phi.n_q_points;
+
+        // the sum-factorization path needs the same 1d shape functions in
+        // all directions
+        const bool is_tensor_product =
+          shape_info.element_type <=
+            dealii::internal::MatrixFreeFunctions::tensor_general &&
+          shape_info.data.size() == 1 &&
+          dofs_per_component ==
+            Utilities::pow(shape_info.data[0].fe_degree + 1, dim) &&
+          n_q_points == Utilities::pow(shape_info.data[0].n_q_points_1d, dim);
+
+        Helper &helper = scratch_data.get();
+        helper.initialize(phi, matrix_free, n_components);
+
+        TensorProductHelper &tensor_helper = scratch_data_tensor.get();
+        if (is_tensor_product)
+          tensor_helper.initialize(shape_info.data[0].shape_values,
+                                   shape_info.data[0].shape_gradients,
+                                   shape_info.data[0].fe_degree + 1,
+                                   shape_info.data[0].n_q_points_1d);
+
+        // coefficients of the pointwise operator for the output derivative
+        // a and the input derivative b, combined for (a,b) and (b,a) due to
+        // the symmetry of the products of shape functions, followed by the
+        // local diagonal
+        AlignedVector<VectorizedArrayType> &coefficients =
+          scratch_data_coefficients.get();
+        coefficients.resize_fast((dim + 1) * (dim + 1) * n_q_points +
+                                 n_components * dofs_per_component);
+        VectorizedArrayType *local_diagonal =
+          coefficients.data() + (dim + 1) * (dim + 1) * n_q_points;
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            phi.reinit(cell);
+            helper.reinit(cell);
+
+            if (is_tensor_product && helper.has_simple_constraints())
+              {
+                for (unsigned int i = 0; i < n_components * dofs_per_component;
+                     ++i)
+                  local_diagonal[i] = VectorizedArrayType();
+
+                for (unsigned int c = 0; c < n_components; ++c)
+                  {
+                    for (unsigned int i = 0;
+                         i < (dim + 1) * (dim + 1) * n_q_points;
+                         ++i)
+                      coefficients[i] = VectorizedArrayType();
+
+                    // recover the pointwise operator by applying it to unit
+                    // input in all quadrature points at once
+                    for (const unsigned int b : in_derivatives)
+                      {
+                        VectorizedArrayType *values    = phi.begin_values();
+                        VectorizedArrayType *gradients = phi.begin_gradients();
+                        if ((evaluation_flags | integration_flags) &
+                            EvaluationFlags::values)
+                          for (unsigned int i = 0;
+                               i < n_components * n_q_points;
+                               ++i)
+                            values[i] = VectorizedArrayType();
+                        if ((evaluation_flags | integration_flags) &
+                            EvaluationFlags::gradients)
+                          for (unsigned int i = 0;
+                               i < n_components * dim * n_q_points;
+                               ++i)
+                            gradients[i] = VectorizedArrayType();
+                        for (unsigned int q = 0; q < n_q_points; ++q)
+                          if (b == 0)
+                            values[c * n_q_points + q] = Number(1.);
+                          else
+                            gradients[(c * n_q_points + q) * dim + b - 1] =
+                              Number(1.);
+
+                        for (unsigned int q = 0; q < n_q_points; ++q)
+                          quad_operation(phi, q);
+
+                        for (const unsigned int a : out_derivatives)
+                          {
+                            VectorizedArrayType *coefficient =
+                              coefficients.data() +
+                              (std::min(a, b) * (dim + 1) + std::max(a, b)) *
+                                n_q_points;
+                            if (a == 0)
+                              for (unsigned int q = 0; q < n_q_points; ++q)
+                                coefficient[q] += values[c * n_q_points + q];
+                            else
+                              for (unsigned int q = 0; q < n_q_points; ++q)
+                                coefficient[q] +=
+                                  gradients[(c * n_q_points + q) * dim + a -
+                                            1];
+                          }
+                      }
+
+                    for (const auto &[a, b] : derivative_pairs)
+                      tensor_helper.add_diagonal(
+                        a,
+                        b,
+                        coefficients.data() + (a * (dim + 1) + b) * n_q_points,
+                        local_diagonal + c * dofs_per_component);
+                  }
+
+                helper.submit_local_diagonal(local_diagonal);
+              }
+            else
+              {
+                for (unsigned int i = 0; i < n_components * dofs_per_component;
+                     ++i)
+                  {
+                    helper.prepare_basis_vector(i);
+                    phi.evaluate(evaluation_flags);
+                    for (unsigned int q = 0; q < n_q_points; ++q)
+                      quad_operation(phi, q);
+                    phi.integrate(integration_flags);
+                    helper.submit();
+                  }
+              }
+
+            helper.distribute_local_to_global(diagonal_global_components);
+          }
+      };
+
+    int dummy = 0;
+    matrix_free.template cell_loop<VectorType, int>(cell_operation,
+                                                    diagonal_global,
+                                                    dummy,
+                                                    false);
+  }
+
   namespace internal
   {
     /**
@@ -146,6 +146,21 @@ namespace internal
 
 
 
+  // type trait for vector T to see if we do the custom data exchange route
+  // with the buffers of MatrixFree<dim, Number>, which requires T to store
+  // numbers of type Number. Vectors of another number type, like the 16-bit
+  // floating point vectors used for storage only, use their own data exchange
+  template <typename T, typename Number>
+  using same_value_type_t =
+    std::enable_if_t<std::is_same_v<typename T::value_type, Number>>;
+
+  template <typename T, typename Number>
+  constexpr bool has_exchange_on_subset_for_number =
+    has_exchange_on_subset<T> &&
+    is_supported_operation<same_value_type_t, T, Number>;
+
+
+
   // a helper type-trait that leverage SFINAE to figure out if type T has
   // T & T::operator=(const T::value_type) const
   template <typename T>
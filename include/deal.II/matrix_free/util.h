@@ -59,6 +59,18 @@ namespace internal
                       dealii::hp::QCollection<dim - 1>(
                         QWitherdenVincentSimplex<dim - 1>(i))};
 
+          for (unsigned int i = 1; i <= 10; ++i)
+            if (quad == QGaussCollapsedSimplex<dim>(i))
+              {
+                if (dim == 2)
+                  return {ReferenceCells::get_simplex<dim>(),
+                          dealii::hp::QCollection<dim - 1>(QGauss<dim - 1>(i))};
+                else
+                  return {ReferenceCells::get_simplex<dim>(),
+                          dealii::hp::QCollection<dim - 1>(
+                            QGaussCollapsedSimplex<dim - 1>(i))};
+              }
+
           for (unsigned int i = 1; i <= 3; ++i)
             {
               const FE_SimplexP<dim> fe(i);
@@ -150,6 +162,17 @@ namespace internal
                           QWitherdenVincentSimplex<dim - 1>(i)};
               }
 
+          for (unsigned int i = 1; i <= 10; ++i)
+            if (quad == QGaussCollapsedSimplex<dim>(i))
+              {
+                if (dim == 2)
+                  return {QGauss<dim - 1>(i), // line!
+                          Quadrature<dim - 1>()};
+                else
+                  return {Quadrature<dim - 1>(),
+                          QGaussCollapsedSimplex<dim - 1>(i)};
+              }
+
           for (unsigned int i = 1; i <= 3; ++i)
             {
               const FE_SimplexP<dim> fe(i);
@@ -291,6 +291,33 @@ public:
    */
   virtual void
   apply(const unsigned int level, VectorType &u, const VectorType &rhs) const;
+
+  /**
+   * Apply the smoother like apply() and additionally compute the residual
+   * $r = b - A u$ of the result @p u for the right hand side @p rhs with the
+   * matrix on the given level, storing it in @p residual. A smoother that
+   * applies the level matrix anyway can compute the residual within its
+   * last matrix-vector product, which saves a sweep through the vectors
+   * compared to a separate residual computation.
+   *
+   * If enabled with Multigrid::set_residual_from_smoother(), the Multigrid
+   * class calls this function for the pre-smoothing in the V-cycle instead
+   * of apply() followed by its own residual computation if
+   * supports_apply_and_compute_residual() returns true and no edge matrices
+   * are set. The default implementation throws an exception.
+   */
+  virtual void
+  apply_and_compute_residual(const unsigned int level,
+                             VectorType        &u,
+                             const VectorType  &rhs,
+                             VectorType        &residual) const;
+
+  /**
+   * Return whether apply_and_compute_residual() is implemented for the given
+   * level. The default implementation returns false.
+   */
+  virtual bool
+  supports_apply_and_compute_residual(const unsigned int level) const;
 };
 
 /** @} */
@@ -34,6 +34,29 @@ MGSmootherBase<VectorType>::apply(const unsigned int level,
 
 
 
+template <typename VectorType>
+void
+MGSmootherBase<VectorType>::apply_and_compute_residual(
+  const unsigned int /*level*/,
+  VectorType & /*u*/,
+  const VectorType & /*rhs*/,
+  VectorType & /*residual*/) const
+{
+  AssertThrow(false, ExcNotImplemented());
+}
+
+
+
+template <typename VectorType>
+bool
+MGSmootherBase<VectorType>::supports_apply_and_compute_residual(
+  const unsigned int /*level*/) const
+{
+  return false;
+}
+
+
+
 template <typename VectorType>
 void
 MGTransferBase<VectorType>::prolongate_and_add(const unsigned int to_level,
@@ -0,0 +1,466 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_coarse_subcommunicator_h
+#define dealii_mg_coarse_subcommunicator_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <deal.II/multigrid/mg_base.h>
+
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * Coarse grid solver that runs an iterative solver only on the processes
+ * that own degrees of freedom on the coarse level.
+ *
+ * If the coarse level of a global-coarsening multigrid method has been
+ * agglomerated onto a few processes, e.g., with
+ * RepartitioningPolicyTools::AgglomerationPolicy, the global reductions of an
+ * iterative solver such as SolverCG still involve all processes of the
+ * communicator, and the cost of the coarse solve is dominated by the latency
+ * of these reductions. This class creates a sub-communicator of the
+ * processes that own degrees of freedom in initialize() and runs the solver
+ * with vectors living on that sub-communicator, so that the other processes
+ * skip the coarse solve entirely and return a zero vector.
+ *
+ * The matrix and the preconditioner are applied to vectors with the
+ * partitioner passed to initialize() by copying the locally owned data, so
+ * existing operators, e.g., matrix-free operators set up on the coarse
+ * level, can be used unchanged. Their vmult() functions must only
+ * communicate point-to-point with the processes that own degrees of freedom
+ * and must not perform collective communication on the full communicator,
+ * which is the case for the operators based on MatrixFree::cell_loop() as
+ * long as the processes without degrees of freedom do not have ghost
+ * entries.
+ *
+ * If the solver throws SolverControl::NoConvergence, the failure is
+ * communicated to all processes of the communicator of the coarse level
+ * with a single reduction, and the exception is thrown on all processes,
+ * so that the processes not participating in the coarse solve do not
+ * continue and wait for the others in the next collective operation.
+ */
+template <typename Number,
+          typename SolverType,
+          typename MatrixType,
+          typename PreconditionerType>
+class MGCoarseGridSubcommunicatorSolver
+  : public MGCoarseGridBase<LinearAlgebra::distributed::Vector<Number>>
+{
+public:
+  /**
+   * The type of the vectors on the coarse level.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * Default constructor.
+   */
+  MGCoarseGridSubcommunicatorSolver();
+
+  /**
+   * Constructor, calls initialize() with the given arguments.
+   */
+  MGCoarseGridSubcommunicatorSolver(
+    SolverType                                               &solver,
+    const MatrixType                                         &matrix,
+    const PreconditionerType                                 &preconditioner,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner);
+
+  /**
+   * Copy constructor. Deleted because this class owns the sub-communicator,
+   * which would otherwise be freed twice.
+   */
+  MGCoarseGridSubcommunicatorSolver(
+    const MGCoarseGridSubcommunicatorSolver &) = delete;
+
+  /**
+   * Destructor. Frees the sub-communicator.
+   */
+  ~MGCoarseGridSubcommunicatorSolver() override;
+
+  /**
+   * Copy assignment. Deleted for the same reason as the copy constructor.
+   */
+  MGCoarseGridSubcommunicatorSolver &
+  operator=(const MGCoarseGridSubcommunicatorSolver &) = delete;
+
+  /**
+   * Initialize with new data. Only references to the solver, the matrix,
+   * and the preconditioner are stored, so their lifetime needs to exceed
+   * the usage in this class. The solver must work on vectors of type
+   * VectorType, and the @p partitioner describes the layout of the vectors
+   * on the coarse level, which must be the one expected by the matrix and
+   * the preconditioner.
+   *
+   * This function creates the sub-communicator and must be called on all
+   * processes of the communicator of @p partitioner.
+   */
+  void
+  initialize(
+    SolverType                                               &solver,
+    const MatrixType                                         &matrix,
+    const PreconditionerType                                 &preconditioner,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner);
+
+  /**
+   * Clear all pointers and free the sub-communicator.
+   */
+  void
+  clear();
+
+  /**
+   * Return whether this process participates in the coarse solve, i.e.,
+   * whether it owns degrees of freedom on the coarse level.
+   */
+  bool
+  is_active() const;
+
+  /**
+   * Return the communicator of the processes that participate in the coarse
+   * solve, or MPI_COMM_NULL on the other processes.
+   */
+  MPI_Comm
+  get_subcommunicator() const;
+
+  /**
+   * Implementation of the abstract function. Solves the coarse problem on
+   * the processes of the sub-communicator, and sets @p dst to zero on the
+   * other processes. If the solver does not converge,
+   * SolverControl::NoConvergence is thrown on all processes.
+   */
+  virtual void
+  operator()(const unsigned int level,
+             VectorType        &dst,
+             const VectorType  &src) const override;
+
+private:
+  /**
+   * Apply the operator @p op given for vectors with the layout of the
+   * coarse level to vectors on the sub-communicator.
+   */
+  template <typename OperatorType>
+  class SubcommunicatorOperator
+  {
+  public:
+    SubcommunicatorOperator(const OperatorType &op,
+                            VectorType         &src_coarse,
+                            VectorType         &dst_coarse)
+      : op(op)
+      , src_coarse(src_coarse)
+      , dst_coarse(dst_coarse)
+    {}
+
+    void
+    vmult(VectorType &dst, const VectorType &src) const
+    {
+      src_coarse.copy_locally_owned_data_from(src);
+      op.vmult(dst_coarse, src_coarse);
+      dst.copy_locally_owned_data_from(dst_coarse);
+    }
+
+  private:
+    const OperatorType &op;
+    VectorType         &src_coarse;
+    VectorType         &dst_coarse;
+  };
+
+  /**
+   * Reference to the solver.
+   */
+  ObserverPointer<SolverType> solver;
+
+  /**
+   * Reference to the matrix.
+   */
+  ObserverPointer<const MatrixType> matrix;
+
+  /**
+   * Reference to the preconditioner.
+   */
+  ObserverPointer<const PreconditionerType> preconditioner;
+
+  /**
+   * The communicator of the coarse level, used to communicate a failure of
+   * the solver to all processes.
+   */
+  MPI_Comm communicator;
+
+  /**
+   * The communicator of the processes that own degrees of freedom, or
+   * MPI_COMM_NULL on the other processes.
+   */
+  MPI_Comm subcommunicator;
+
+  /**
+   * The partitioner of the vectors on the sub-communicator, with the same
+   * locally owned range as the one of the coarse level.
+   */
+  std::shared_ptr<const Utilities::MPI::Partitioner> sub_partitioner;
+
+  /**
+   * Vectors on the sub-communicator passed to the solver.
+   */
+  mutable VectorType sub_src, sub_dst;
+
+  /**
+   * Vectors with the layout of the coarse level, used to apply the matrix
+   * and the preconditioner.
+   */
+  mutable VectorType src_coarse, dst_coarse;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+/* ------------------------- Inline functions ------------------------- */
+
+template <typename Number,
+          typename SolverType,
+          typename MatrixType,
+          typename PreconditionerType>
+MGCoarseGridSubcommunicatorSolver<Number,
+                                  SolverType,
+                                  MatrixType,
+                                  PreconditionerType>::
+  MGCoarseGridSubcommunicatorSolver()
+  : communicator(MPI_COMM_NULL)
+  , subcommunicator(MPI_COMM_NULL)
+{}
+
+
+
+template <typename Number,
+          typename SolverType,
+          typename MatrixType,
+          typename PreconditionerType>
+MGCoarseGridSubcommunicatorSolver<Number,
+                                  SolverType,
+                                  MatrixType,
+                                  PreconditionerType>::
+  MGCoarseGridSubcommunicatorSolver(
+    SolverType                                               &solver,
+    const MatrixType                                         &matrix,
+    const PreconditionerType                                 &preconditioner,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+  : communicator(MPI_COMM_NULL)
+  , subcommunicator(MPI_COMM_NULL)
+{
+  initialize(solver, matrix, preconditioner, partitioner);
+}
+
+
+
+template <typename Number,
+          typename SolverType,
+          typename MatrixType,
+          typename PreconditionerType>
+MGCoarseGridSubcommunicatorSolver<Number,
+                                  SolverType,
+                                  MatrixType,
+                                  PreconditionerType>::
+  ~MGCoarseGridSubcommunicatorSolver()
+{
+  clear();
+}
+
+
+
+template <typename Number,
+          typename SolverType,
+          typename MatrixType,
+          typename PreconditionerType>
+void
+MGCoarseGridSubcommunicatorSolver<Number,
+                                  SolverType,
+                                  MatrixType,
+                                  PreconditionerType>::
+  initialize(
+    SolverType                                               &solver_,
+    const MatrixType                                         &matrix_,
+    const PreconditionerType                                 &preconditioner_,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+{
+  clear();
+
+  solver         = &solver_;
+  matrix         = &matrix_;
+  preconditioner = &preconditioner_;
+  communicator   = partitioner->get_mpi_communicator();
+
+  const bool is_active = partitioner->locally_owned_size() > 0;
+  Assert(is_active || partitioner->n_ghost_indices() == 0,
+         ExcMessage("Processes without locally owned degrees of freedom "
+                    "must not have ghost entries on the coarse level."));
+
+#ifdef DEAL_II_WITH_MPI
+  const int ierr =
+    MPI_Comm_split(communicator,
+                   is_active ? 0 : MPI_UNDEFINED,
+                   Utilities::MPI::this_mpi_process(communicator),
+                   &subcommunicator);
+  AssertThrowMPI(ierr);
+#else
+  subcommunicator = communicator;
+#endif
+
+  if (is_active)
+    {
+      sub_partitioner = std::make_shared<Utilities::MPI::Partitioner>(
+        partitioner->locally_owned_range(), subcommunicator);
+      sub_src.reinit(sub_partitioner);
+      sub_dst.reinit(sub_partitioner);
+      src_coarse.reinit(partitioner);
+      dst_coarse.reinit(partitioner);
+    }
+}
+
+
+
+template <typename Number,
+          typename SolverType,
+          typename MatrixType,
+          typename PreconditionerType>
+void
+MGCoarseGridSubcommunicatorSolver<Number,
+                                  SolverType,
+                                  MatrixType,
+                                  PreconditionerType>::clear()
+{
+  solver         = nullptr;
+  matrix         = nullptr;
+  preconditioner = nullptr;
+  communicator   = MPI_COMM_NULL;
+
+  sub_src.reinit(0);
+  sub_dst.reinit(0);
+  src_coarse.reinit(0);
+  dst_coarse.reinit(0);
+  sub_partitioner.reset();
+
+#ifdef DEAL_II_WITH_MPI
+  if (subcommunicator != MPI_COMM_NULL)
+    Utilities::MPI::free_communicator(subcommunicator);
+#endif
+  subcommunicator = MPI_COMM_NULL;
+}
+
+
+
+template <typename Number,
+          typename SolverType,
+          typename MatrixType,
+          typename PreconditionerType>
+bool
+MGCoarseGridSubcommunicatorSolver<Number,
+                                  SolverType,
+                                  MatrixType,
+                                  PreconditionerType>::is_active() const
+{
+  return sub_partitioner != nullptr;
+}
+
+
+
+template <typename Number,
+          typename SolverType,
+          typename MatrixType,
+          typename PreconditionerType>
+MPI_Comm
+MGCoarseGridSubcommunicatorSolver<Number,
+                                  SolverType,
+                                  MatrixType,
+                                  PreconditionerType>::get_subcommunicator()
+  const
+{
+  return subcommunicator;
+}
+
+
+
+template <typename Number,
+          typename SolverType,
+          typename MatrixType,
+          typename PreconditionerType>
+void
+MGCoarseGridSubcommunicatorSolver<Number,
+                                  SolverType,
+                                  MatrixType,
+                                  PreconditionerType>::
+operator()(const unsigned int /*level*/,
+           VectorType       &dst,
+           const VectorType &src) const
+{
+  Assert(solver != nullptr, ExcNotInitialized());
+  Assert(matrix != nullptr, ExcNotInitialized());
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+
+  // the last step and the last residual of a failed solve, or -1 if the
+  // solver converged
+  double failure[2] = {-1., -1.};
+
+  if (is_active())
+    {
+      AssertDimension(src.locally_owned_size(), sub_src.locally_owned_size());
+
+      const SubcommunicatorOperator<MatrixType> sub_matrix(*matrix,
+                                                           src_coarse,
+                                                           dst_coarse);
+      const SubcommunicatorOperator<PreconditionerType> sub_preconditioner(
+        *preconditioner, src_coarse, dst_coarse);
+
+      sub_src.copy_locally_owned_data_from(src);
+      sub_dst = Number();
+      try
+        {
+          solver->solve(sub_matrix, sub_dst, sub_src, sub_preconditioner);
+        }
+      catch (const SolverControl::NoConvergence &exc)
+        {
+          failure[0] = exc.last_step;
+          failure[1] = exc.last_residual;
+        }
+      dst.copy_locally_owned_data_from(sub_dst);
+    }
+  else
+    dst = Number();
+
+  // the other processes do not see the exception of the solver, so
+  // communicate the failure to all processes before throwing
+  Utilities::MPI::max(failure, communicator, failure);
+  AssertThrow(failure[0] < 0.,
+              SolverControl::NoConvergence(
+                static_cast<unsigned int>(failure[0]), failure[1]));
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
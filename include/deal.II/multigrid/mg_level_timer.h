@@ -0,0 +1,210 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_level_timer_h
+#define dealii_mg_level_timer_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/multigrid/multigrid.h>
+
+#include <boost/signals2/connection.hpp>
+
+#include <array>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * A class that collects the wall times spent in the operations of a
+ * Multigrid object, separately for each level. It connects to the signals
+ * of the Multigrid object, see mg::Signals, so the times are accumulated
+ * over all cycles run while the connection is active.
+ *
+ * This is useful to identify the levels that do not scale, e.g., the coarse
+ * levels of a global-coarsening multigrid method in parallel computations,
+ * which are dominated by the latency of the communication and might be
+ * agglomerated onto fewer processes with
+ * RepartitioningPolicyTools::AgglomerationPolicy.
+ *
+ * The object must not be destroyed while the Multigrid object is used, or
+ * disconnect() must be called before.
+ */
+class MGLevelTimer
+{
+public:
+  /**
+   * The operations of the multigrid cycle that are timed. The restriction
+   * is recorded on the finer of the two levels involved, the prolongation
+   * on the level the result is added to, as reported by mg::Signals. If the
+   * pre-smoother computes the residual, see
+   * Multigrid::set_residual_from_smoother(), the residual time is also
+   * contained in the pre-smoothing time, and only counted once in the total
+   * time per level.
+   */
+  enum class Operation : unsigned int
+  {
+    pre_smoothing,
+    residual,
+    restriction,
+    coarse_solve,
+    prolongation,
+    post_smoothing
+  };
+
+  /**
+   * The number of entries of the Operation enum.
+   */
+  static constexpr unsigned int n_operations = 6;
+
+  /**
+   * Default constructor.
+   */
+  MGLevelTimer() = default;
+
+  /**
+   * Constructor, connects to the signals of @p mg.
+   */
+  template <typename VectorType>
+  MGLevelTimer(Multigrid<VectorType> &mg);
+
+  /**
+   * Destructor. Disconnects from the signals.
+   */
+  ~MGLevelTimer();
+
+  /**
+   * Connect to the signals of @p mg. A timer can be connected to several
+   * Multigrid objects, in which case the times are added up.
+   */
+  template <typename VectorType>
+  void
+  connect(Multigrid<VectorType> &mg);
+
+  /**
+   * Disconnect from all signals.
+   */
+  void
+  disconnect();
+
+  /**
+   * Set all collected times to zero.
+   */
+  void
+  reset();
+
+  /**
+   * Start (@p before is true) or stop (@p before is false) the time
+   * measurement of the given operation on the given level. This function is
+   * called by the signals of the Multigrid object, possibly concurrently
+   * for different levels in the additive cycle.
+   */
+  void
+  signal(const Operation    operation,
+         const bool         before,
+         const unsigned int level);
+
+  /**
+   * Return the accumulated wall time of the given operation on the given
+   * level on this process.
+   */
+  double
+  get_wall_time(const unsigned int level, const Operation operation) const;
+
+  /**
+   * Print the minimum, average, and maximum over the processes of @p comm of
+   * the accumulated wall time of each operation on each level, skipping
+   * operations that were not run, together with the total time per level.
+   * This function must be called on all processes of @p comm, and the
+   * output is only written on the first process.
+   */
+  void
+  print_wall_time_statistics(const MPI_Comm comm,
+                             std::ostream  &out = std::cout) const;
+
+private:
+  /**
+   * The timers, indexed by the level and the operation.
+   */
+  std::vector<std::array<Timer, n_operations>> timers;
+
+  /**
+   * The accumulated wall time per level of the residual computations that
+   * were run within the pre-smoothing, which is subtracted from the total
+   * time of the level.
+   */
+  std::vector<double> nested_wall_times;
+
+  /**
+   * A mutex to guard the access to the timers.
+   */
+  std::mutex mutex;
+
+  /**
+   * The connections to the signals.
+   */
+  std::vector<boost::signals2::connection> connections;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+/* ------------------------- Inline functions ------------------------- */
+
+template <typename VectorType>
+MGLevelTimer::MGLevelTimer(Multigrid<VectorType> &mg)
+{
+  connect(mg);
+}
+
+
+
+template <typename VectorType>
+void
+MGLevelTimer::connect(Multigrid<VectorType> &mg)
+{
+  const auto slot = [this](const Operation operation) {
+    return [this, operation](const bool before, const unsigned int level) {
+      signal(operation, before, level);
+    };
+  };
+
+  connections.push_back(
+    mg.connect_pre_smoother_step(slot(Operation::pre_smoothing)));
+  connections.push_back(mg.connect_residual_step(slot(Operation::residual)));
+  connections.push_back(mg.connect_restriction(slot(Operation::restriction)));
+  connections.push_back(
+    mg.connect_coarse_solve(slot(Operation::coarse_solve)));
+  connections.push_back(
+    mg.connect_prolongation(slot(Operation::prolongation)));
+  connections.push_back(
+    mg.connect_post_smoother_step(slot(Operation::post_smoothing)));
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
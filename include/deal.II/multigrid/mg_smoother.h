@@ -21,6 +21,7 @@
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/mg_level_object.h>
 #include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/template_constraints.h>
 
 #include <deal.II/lac/linear_operator.h>
 #include <deal.II/lac/vector_memory.h>
@@ -562,6 +563,28 @@ public:
         VectorType        &u,
         const VectorType  &rhs) const override;
 
+  /**
+   * The apply variant of smoothing that additionally computes the residual
+   * of the result. This is implemented for a single non-transposed
+   * smoothing step with a @p PreconditionerType that provides a function
+   * <tt>vmult_and_compute_residual(u, residual, rhs)</tt>, such as
+   * PreconditionChebyshev, which computes the residual with the level matrix
+   * passed to its initialize() function.
+   */
+  virtual void
+  apply_and_compute_residual(const unsigned int level,
+                             VectorType        &u,
+                             const VectorType  &rhs,
+                             VectorType        &residual) const override;
+
+  /**
+   * Return whether apply_and_compute_residual() can be used on the given
+   * level, see there for the conditions.
+   */
+  virtual bool
+  supports_apply_and_compute_residual(
+    const unsigned int level) const override;
+
   /**
    * Object containing relaxation methods.
    */
@@ -588,6 +611,30 @@ private:
 
 #ifndef DOXYGEN
 
+namespace internal
+{
+  namespace MGSmootherImplementation
+  {
+    // a helper type-trait that leverage SFINAE to figure out if
+    // PreconditionerType has ...
+    // PreconditionerType::vmult_and_compute_residual(VectorType &,
+    // VectorType &, const VectorType &) const
+    template <typename PreconditionerType, typename VectorType>
+    using vmult_and_compute_residual_t =
+      decltype(std::declval<const PreconditionerType>()
+                 .vmult_and_compute_residual(
+                   std::declval<VectorType &>(),
+                   std::declval<VectorType &>(),
+                   std::declval<const VectorType &>()));
+
+    template <typename PreconditionerType, typename VectorType>
+    constexpr bool has_vmult_and_compute_residual =
+      is_supported_operation<vmult_and_compute_residual_t,
+                             PreconditionerType,
+                             VectorType>;
+  } // namespace MGSmootherImplementation
+} // namespace internal
+
 template <typename VectorType>
 inline void
 MGSmootherIdentity<VectorType>::smooth(const unsigned int,
@@ -1301,6 +1348,67 @@ MGSmootherPrecondition<MatrixType, PreconditionerType, VectorType>::apply(
 
 
 
+template <typename MatrixType, typename PreconditionerType, typename VectorType>
+inline void
+MGSmootherPrecondition<MatrixType, PreconditionerType, VectorType>::
+  apply_and_compute_residual(const unsigned int level,
+                             VectorType        &u,
+                             const VectorType  &rhs,
+                             VectorType        &residual) const
+{
+  Assert(supports_apply_and_compute_residual(level), ExcNotImplemented());
+
+  if constexpr (internal::MGSmootherImplementation::
+                  has_vmult_and_compute_residual<PreconditionerType,
+                                                 VectorType>)
+    {
+      if (this->debug > 0)
+        deallog << 'S' << level << ' ';
+      if (this->debug > 2)
+        deallog << ' ' << rhs.l2_norm() << ' ';
+      if (this->debug > 0)
+        deallog << 'N';
+      smoothers[level].vmult_and_compute_residual(u, residual, rhs);
+      if (this->debug > 1)
+        deallog << ' ' << u.l2_norm() << ' ';
+      if (this->debug > 0)
+        deallog << std::endl;
+    }
+  else
+    {
+      (void)level;
+      (void)u;
+      (void)rhs;
+      (void)residual;
+    }
+}
+
+
+
+template <typename MatrixType, typename PreconditionerType, typename VectorType>
+inline bool
+MGSmootherPrecondition<MatrixType, PreconditionerType, VectorType>::
+  supports_apply_and_compute_residual(const unsigned int level) const
+{
+  if constexpr (internal::MGSmootherImplementation::
+                  has_vmult_and_compute_residual<PreconditionerType,
+                                                 VectorType>)
+    {
+      unsigned int steps2 = this->steps;
+      if (this->variable)
+        steps2 *= (1 << (matrices.max_level() - level));
+
+      return steps2 == 1 && this->transpose == false;
+    }
+  else
+    {
+      (void)level;
+      return false;
+    }
+}
+
+
+
 template <typename MatrixType, typename PreconditionerType, typename VectorType>
 inline std::size_t
 MGSmootherPrecondition<MatrixType, PreconditionerType, VectorType>::
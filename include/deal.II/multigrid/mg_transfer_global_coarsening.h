@@ -134,6 +134,17 @@ namespace MGTransferGlobalCoarseningTools
     const RepartitioningPolicyTools::Base<dim, spacedim> &policy,
     const bool repartition_fine_triangulation = false);
 
+  /**
+   * Release the prolongation and restriction matrices of the element pairs
+   * that MGTwoLevelTransfer::reinit_polynomial_transfer() and
+   * MGTwoLevelTransfer::reinit_geometric_transfer() keep in memory to reuse
+   * them for later setups with the same elements, e.g., after each adaptive
+   * refinement step. Transfer operators that are already set up are not
+   * affected; later setups compute the matrices anew.
+   */
+  void
+  clear_transfer_matrix_cache();
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
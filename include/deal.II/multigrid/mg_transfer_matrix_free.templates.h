@@ -47,6 +47,10 @@
 #include <boost/algorithm/string/join.hpp>
 
 #include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -1455,6 +1459,91 @@ namespace internal
 
 
 
+  /**
+   * A cache for the prolongation and restriction matrices of the transfer
+   * schemes. These matrices only depend on the finite elements involved,
+   * but computing them, e.g., by FETools::get_projection_matrix() for the
+   * polynomial transfer, is expensive for higher degrees. The data is kept
+   * until clear() is called, such that it is computed only once for each
+   * pair of elements even if the transfer operators are set up anew after
+   * every adaptive refinement step. Users release the data via
+   * MGTransferGlobalCoarseningTools::clear_transfer_matrix_cache().
+   *
+   * The key consists of the names of the coarse and the fine element,
+   * which uniquely identify the elements, and an integer to distinguish the
+   * different kinds of transfer matrices set up for the same elements.
+   */
+  class TransferMatrixCache
+  {
+  public:
+    using Key = std::tuple<std::string, std::string, unsigned int>;
+
+    /**
+     * Copy the matrices stored for @p key into @p prolongation_matrix and
+     * @p restriction_matrix and return true, or return false if there is no
+     * entry for @p key.
+     */
+    static bool
+    get(const Key             &key,
+        AlignedVector<double> &prolongation_matrix,
+        AlignedVector<double> &restriction_matrix)
+    {
+      TransferMatrixCache &cache = instance();
+
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      const auto                  entry = cache.matrices.find(key);
+      if (entry == cache.matrices.end())
+        return false;
+
+      prolongation_matrix = entry->second.first;
+      restriction_matrix  = entry->second.second;
+      return true;
+    }
+
+    /**
+     * Store copies of the given matrices for @p key.
+     */
+    static void
+    store(const Key                   &key,
+          const AlignedVector<double> &prolongation_matrix,
+          const AlignedVector<double> &restriction_matrix)
+    {
+      TransferMatrixCache &cache = instance();
+
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      cache.matrices.emplace(key,
+                             std::make_pair(prolongation_matrix,
+                                            restriction_matrix));
+    }
+
+    /**
+     * Release all stored matrices.
+     */
+    static void
+    clear()
+    {
+      TransferMatrixCache &cache = instance();
+
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      cache.matrices.clear();
+    }
+
+  private:
+    static TransferMatrixCache &
+    instance()
+    {
+      static TransferMatrixCache cache;
+      return cache;
+    }
+
+    std::mutex mutex;
+
+    std::map<Key, std::pair<AlignedVector<double>, AlignedVector<double>>>
+      matrices;
+  };
+
+
+
   class MGTwoLevelTransferImplementation
   {
     /**
@@ -2024,6 +2113,23 @@ namespace internal
              transfer_scheme_index < transfer.schemes.size();
              ++transfer_scheme_index)
           {
+            // the matrices only depend on the element, the layout selected
+            // by is_feq, and the refinement case of the scheme
+            const TransferMatrixCache::Key key(fe_fine.get_name(),
+                                               fe_fine.get_name(),
+                                               2 * transfer_scheme_index +
+                                                 (is_feq ? 1 : 0));
+            if (TransferMatrixCache::get(
+                  key,
+                  transfer.schemes[transfer_scheme_index].prolongation_matrix,
+                  transfer.schemes[transfer_scheme_index].restriction_matrix))
+              continue;
+
+            // the restriction matrix is accumulated below, so start from
+            // empty matrices if this object has been set up before
+            transfer.schemes[transfer_scheme_index].prolongation_matrix.clear();
+            transfer.schemes[transfer_scheme_index].restriction_matrix.clear();
+
             if (has_tp_structure)
               {
                 const auto fe = create_1D_fe(fe_fine.base_element(0));
@@ -2144,6 +2250,11 @@ namespace internal
                     }
                 }
               }
+
+            TransferMatrixCache::store(
+              key,
+              transfer.schemes[transfer_scheme_index].prolongation_matrix,
+              transfer.schemes[transfer_scheme_index].restriction_matrix);
           }
       }
 
@@ -2174,6 +2285,18 @@ namespace internal
       Assert(fe_fine.reference_cell() == fe_coarse.reference_cell(),
              ExcNotImplemented());
 
+      // the keys of the geometric transfer use integers larger than one
+      const TransferMatrixCache::Key key(fe_coarse.get_name(),
+                                         fe_fine.get_name(),
+                                         1);
+      if (TransferMatrixCache::get(key,
+                                   scheme.prolongation_matrix,
+                                   scheme.restriction_matrix))
+        return;
+
+      scheme.prolongation_matrix.clear();
+      scheme.restriction_matrix.clear();
+
       if (has_tp_structure && (fe_coarse != fe_fine) &&
           (fe_coarse.n_dofs_per_cell() != 0 && fe_fine.n_dofs_per_cell() != 0))
         {
@@ -2261,6 +2384,10 @@ namespace internal
             for (unsigned int j = 0; j < matrix.n(); ++j, ++k)
               scheme.restriction_matrix[k] = matrix(i, j);
         }
+
+      TransferMatrixCache::store(key,
+                                 scheme.prolongation_matrix,
+                                 scheme.restriction_matrix);
     }
 
 
@@ -131,6 +131,11 @@ namespace mg
      * This signal is triggered before (@p before is true) and after (@p before
      * is false) the computation of the residual vector on @p level, including
      * the result of edge_out and edge_down.
+     *
+     * If the pre-smoother computes the residual itself in the V-cycle, see
+     * Multigrid::set_residual_from_smoother(), this signal is triggered
+     * around the combined smoothing and residual computation, nested within
+     * the pre_smoother_step.
      */
     boost::signals2::signal<void(const bool before, const unsigned int level)>
       residual_step;
@@ -153,7 +158,8 @@ namespace mg
  * The function which starts a multigrid cycle on the finest level is cycle().
  * Depending on the cycle type chosen with the constructor (see enum Cycle),
  * this function triggers one of the cycles level_v_step() or level_step(),
- * where the latter one can do different types of cycles.
+ * where the latter one can do different types of cycles, or the additive
+ * method additive_step().
  *
  * Using this class, it is expected that the right hand side has been
  * converted from a vector living on the locally finest level to a multilevel
@@ -175,7 +181,24 @@ public:
     /// The W-cycle
     w_cycle,
     /// The F-cycle
-    f_cycle
+    f_cycle,
+    /**
+     * The additive multigrid method, also known as BPX preconditioner. The
+     * defect is restricted to all levels first, then the level corrections
+     * are computed independently of each other by the pre-smoother, or the
+     * coarse grid solver on the coarsest level, and finally the corrections
+     * are prolongated and summed up. No residual is computed and the
+     * post-smoother is not used. Since the level corrections do not depend
+     * on each other, they are run concurrently as tasks if several threads
+     * are available and MPI has not been initialized, see additive_step().
+     *
+     * The additive method is usually less effective than the V-cycle, but
+     * it avoids the sequential dependency between the levels, which leaves
+     * most of the hardware idle while the coarse levels are treated. With a
+     * symmetric smoother, it is a symmetric preconditioner suitable for
+     * SolverCG. Edge matrices are not supported.
+     */
+    additive_cycle
   };
 
   using vector_type       = VectorType;
@@ -309,6 +332,21 @@ public:
    */
   void set_cycle(Cycle);
 
+  /**
+   * Let the pre-smoother compute the residual after the pre-smoothing in
+   * the V-cycle within its last matrix-vector product, see
+   * MGSmootherBase::apply_and_compute_residual(), on all levels where the
+   * smoother supports it and no edge matrices are set. This saves a
+   * matrix-vector product and a sweep through the vectors per level.
+   *
+   * The smoother computes the residual with its own matrix, e.g., the one
+   * passed to PreconditionChebyshev::initialize(), rather than with the
+   * level matrix given to the constructor of this class. Only enable this
+   * option if both represent the same operator. The default is false.
+   */
+  void
+  set_residual_from_smoother(const bool flag);
+
   /**
    * Connect a function to mg::Signals::pre_smoother_step.
    */
@@ -383,11 +421,33 @@ private:
   void
   level_step(const unsigned int level, Cycle cycle);
 
+  /**
+   * The additive multigrid method on all levels between #minlevel and
+   * #maxlevel, see Cycle::additive_cycle. The corrections on the levels are
+   * computed as concurrent tasks if MultithreadInfo::n_threads() is larger
+   * than one and MPI has not been initialized. In MPI programs, they are
+   * computed one after the other on each process, because MPI is not
+   * initialized to support concurrent calls from several threads and the
+   * messages of the levels could not be distinguished; the processes still
+   * do not synchronize between the level corrections, so processes that do
+   * not own degrees of freedom on the coarse levels do not wait for them.
+   * The signals for the level corrections are triggered from within the
+   * tasks.
+   */
+  void
+  additive_step();
+
   /**
    * Cycle type performed by the method cycle().
    */
   Cycle cycle_type;
 
+  /**
+   * Whether the pre-smoother computes the residual in the V-cycle, see
+   * set_residual_from_smoother().
+   */
+  bool residual_from_smoother;
+
   /**
    * Level for coarse grid solution.
    */
@@ -417,7 +477,8 @@ private:
   MGLevelObject<VectorType> t;
 
   /**
-   * Auxiliary vector for W- and F-cycles. Left uninitialized in V-cycle.
+   * Auxiliary vector for W- and F-cycles. Left uninitialized in V-cycle and
+   * additive cycle.
    */
   MGLevelObject<VectorType> defect2;
 
@@ -667,6 +728,7 @@ Multigrid<VectorType>::Multigrid(const MGMatrixBase<VectorType>     &matrix,
                                  const unsigned int                max_level,
                                  Cycle                             cycle)
   : cycle_type(cycle)
+  , residual_from_smoother(false)
   , matrix(&matrix, typeid(*this).name())
   , coarse(&coarse, typeid(*this).name())
   , transfer(&transfer, typeid(*this).name())
@@ -18,6 +18,10 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/thread_management.h>
+
 #include <deal.II/multigrid/multigrid.h>
 
 #include <boost/signals2.hpp>
@@ -74,6 +78,15 @@ Multigrid<VectorType>::set_cycle(typename Multigrid<VectorType>::Cycle c)
 
 
 
+template <typename VectorType>
+void
+Multigrid<VectorType>::set_residual_from_smoother(const bool flag)
+{
+  residual_from_smoother = flag;
+}
+
+
+
 template <typename VectorType>
 void
 Multigrid<VectorType>::set_edge_matrices(
@@ -121,28 +134,45 @@ Multigrid<VectorType>::level_v_step(const unsigned int level)
       return;
     }
 
-  // smoothing of the residual
-  this->signals.pre_smoother_step(true, level);
-  pre_smooth->apply(level, solution[level], defect[level]);
-  this->signals.pre_smoother_step(false, level);
-
-  // compute residual on level, which includes the (CG) edge matrix
-  this->signals.residual_step(true, level);
-  matrix->vmult(level, t[level], solution[level]);
-  if (edge_out != nullptr)
+  if (residual_from_smoother && edge_out == nullptr && edge_down == nullptr &&
+      pre_smooth->supports_apply_and_compute_residual(level))
     {
-      edge_out->vmult_add(level, t[level], solution[level]);
+      // smoothing of the residual, with the residual on the level computed
+      // by the smoother within its last matrix-vector product
+      this->signals.pre_smoother_step(true, level);
+      this->signals.residual_step(true, level);
+      pre_smooth->apply_and_compute_residual(level,
+                                             solution[level],
+                                             defect[level],
+                                             t[level]);
+      this->signals.residual_step(false, level);
+      this->signals.pre_smoother_step(false, level);
     }
-  t[level].sadd(-1.0, 1.0, defect[level]);
-
-  // Get the defect on the next coarser level as part of the (DG) edge matrix
-  // and then the main part by the restriction of the transfer
-  if (edge_down != nullptr)
+  else
     {
-      edge_down->vmult(level, t[level - 1], solution[level]);
-      defect[level - 1] -= t[level - 1];
+      // smoothing of the residual
+      this->signals.pre_smoother_step(true, level);
+      pre_smooth->apply(level, solution[level], defect[level]);
+      this->signals.pre_smoother_step(false, level);
+
+      // compute residual on level, which includes the (CG) edge matrix
+      this->signals.residual_step(true, level);
+      matrix->vmult(level, t[level], solution[level]);
+      if (edge_out != nullptr)
+        {
+          edge_out->vmult_add(level, t[level], solution[level]);
+        }
+      t[level].sadd(-1.0, 1.0, defect[level]);
+
+      // Get the defect on the next coarser level as part of the (DG) edge
+      // matrix and then the main part by the restriction of the transfer
+      if (edge_down != nullptr)
+        {
+          edge_down->vmult(level, t[level - 1], solution[level]);
+          defect[level - 1] -= t[level - 1];
+        }
+      this->signals.residual_step(false, level);
     }
-  this->signals.residual_step(false, level);
 
   this->signals.restriction(true, level);
   transfer->restrict_and_add(level, defect[level - 1], t[level]);
@@ -265,6 +295,64 @@ Multigrid<VectorType>::level_step(const unsigned int level, Cycle cycle)
 
 
 
+template <typename VectorType>
+void
+Multigrid<VectorType>::additive_step()
+{
+  Assert(edge_out == nullptr && edge_in == nullptr && edge_down == nullptr &&
+           edge_up == nullptr,
+         ExcMessage("The additive cycle does not support edge matrices."));
+
+  // restrict the defect to all levels, adding to the contributions of the
+  // initial copy_to_mg
+  for (unsigned int level = maxlevel; level > minlevel; --level)
+    {
+      this->signals.restriction(true, level);
+      transfer->restrict_and_add(level, defect[level - 1], defect[level]);
+      this->signals.restriction(false, level);
+    }
+
+  // compute the corrections on all levels, which are independent of each
+  // other
+  const auto level_correction = [this](const unsigned int level) {
+    if (level == minlevel)
+      {
+        this->signals.coarse_solve(true, level);
+        (*coarse)(level, solution[level], defect[level]);
+        this->signals.coarse_solve(false, level);
+      }
+    else
+      {
+        this->signals.pre_smoother_step(true, level);
+        pre_smooth->apply(level, solution[level], defect[level]);
+        this->signals.pre_smoother_step(false, level);
+      }
+  };
+
+  if (MultithreadInfo::n_threads() > 1 &&
+      Utilities::MPI::job_supports_mpi() == false)
+    {
+      Threads::TaskGroup<void> tasks;
+      for (unsigned int level = minlevel; level <= maxlevel; ++level)
+        tasks += Threads::new_task(
+          [&level_correction, level]() { level_correction(level); });
+      tasks.join_all();
+    }
+  else
+    for (unsigned int level = minlevel; level <= maxlevel; ++level)
+      level_correction(level);
+
+  // sum up the prolongated corrections from the coarsest to the finest level
+  for (unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+      this->signals.prolongation(true, level);
+      transfer->prolongate_and_add(level, solution[level], solution[level - 1]);
+      this->signals.prolongation(false, level);
+    }
+}
+
+
+
 template <typename VectorType>
 void
 Multigrid<VectorType>::cycle()
@@ -276,7 +364,8 @@ Multigrid<VectorType>::cycle()
       solution.resize(minlevel, maxlevel);
       t.resize(minlevel, maxlevel);
     }
-  if (cycle_type != v_cycle &&
+  const bool use_defect2 = cycle_type == w_cycle || cycle_type == f_cycle;
+  if (use_defect2 &&
       (defect2.min_level() != minlevel || defect2.max_level() != maxlevel))
     defect2.resize(minlevel, maxlevel);
 
@@ -287,12 +376,14 @@ Multigrid<VectorType>::cycle()
       // method of the smoother -> do not force them to be zeroed out here
       solution[level].reinit(defect[level], level > minlevel);
       t[level].reinit(defect[level], level > minlevel);
-      if (cycle_type != v_cycle)
+      if (use_defect2)
         defect2[level].reinit(defect[level]);
     }
 
   if (cycle_type == v_cycle)
     level_v_step(maxlevel);
+  else if (cycle_type == additive_cycle)
+    additive_step();
   else
     level_step(maxlevel, cycle_type);
 }
@@ -561,4 +561,48 @@ namespace Utilities
 // explicit instantiations from .templates.h file
 #include "base/partitioner.inst"
 
+// the 16-bit floating point types are transferred as raw bytes like all other
+// types and are only used as storage type of vectors
+#if defined(DEAL_II_WITH_MPI) && !defined(DOXYGEN)
+#  define INSTANTIATE_STORAGE_TYPE(S)                                          \
+    template void                                                              \
+    Utilities::MPI::Partitioner::export_to_ghosted_array_start<                \
+      S,                                                                       \
+      MemorySpace::Host>(const unsigned int,                                   \
+                         const ArrayView<const S, MemorySpace::Host> &,        \
+                         const ArrayView<S, MemorySpace::Host> &,              \
+                         const ArrayView<S, MemorySpace::Host> &,              \
+                         std::vector<MPI_Request> &) const;                    \
+    template void                                                              \
+    Utilities::MPI::Partitioner::export_to_ghosted_array_finish<               \
+      S,                                                                       \
+      MemorySpace::Host>(const ArrayView<S, MemorySpace::Host> &,              \
+                         std::vector<MPI_Request> &) const;                    \
+    template void                                                              \
+    Utilities::MPI::Partitioner::import_from_ghosted_array_start<              \
+      S,                                                                       \
+      MemorySpace::Host>(const VectorOperation::values,                        \
+                         const unsigned int,                                   \
+                         const ArrayView<S, MemorySpace::Host> &,              \
+                         const ArrayView<S, MemorySpace::Host> &,              \
+                         std::vector<MPI_Request> &) const;                    \
+    template void                                                              \
+    Utilities::MPI::Partitioner::import_from_ghosted_array_finish<             \
+      S,                                                                       \
+      MemorySpace::Host>(const VectorOperation::values,                        \
+                         const ArrayView<const S, MemorySpace::Host> &,        \
+                         const ArrayView<S, MemorySpace::Host> &,              \
+                         const ArrayView<S, MemorySpace::Host> &,              \
+                         std::vector<MPI_Request> &) const
+
+#  ifdef DEAL_II_HAVE_FP16
+INSTANTIATE_STORAGE_TYPE(_Float16);
+#  endif
+#  ifdef DEAL_II_HAVE_BF16
+INSTANTIATE_STORAGE_TYPE(__bf16);
+#  endif
+
+#  undef INSTANTIATE_STORAGE_TYPE
+#endif
+
 DEAL_II_NAMESPACE_CLOSE
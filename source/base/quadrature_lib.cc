@@ -2347,6 +2347,43 @@ QIteratedSimplex<dim>::QIteratedSimplex(const Quadrature<dim> &base_quad,
 
 
 
+template <int dim>
+QGaussCollapsedSimplex<dim>::QGaussCollapsedSimplex(
+  const unsigned int n_points_1D)
+  : QSimplex<dim>(Quadrature<dim>())
+{
+  Assert(1 <= dim && dim <= 3, ExcNotImplemented());
+  if (dim == 1)
+    {
+      Quadrature<dim>::operator=(QGauss<dim>(n_points_1D));
+      return;
+    }
+
+  const QGauss<dim> base(n_points_1D);
+  this->quadrature_points.resize(base.size());
+  this->weights.resize(base.size());
+  for (unsigned int q = 0; q < base.size(); ++q)
+    {
+      // map from the collapsed coordinates, starting with the last
+      // coordinate that is not collapsed; the determinant of the Jacobian
+      // is the product of the scaling factors of the coordinates
+      const Point<dim> &xi     = base.point(q);
+      double            factor = 1.;
+      double            weight = base.weight(q);
+      Point<dim>        point;
+      for (int d = dim - 1; d >= 0; --d)
+        {
+          point[d] = xi[d] * factor;
+          weight *= factor;
+          factor *= 1. - xi[d];
+        }
+      this->quadrature_points[q] = point;
+      this->weights[q]           = weight;
+    }
+}
+
+
+
 template <int dim>
 QGaussWedge<dim>::QGaussWedge(const unsigned int n_points)
   : Quadrature<dim>()
@@ -2485,6 +2522,10 @@ template class QWitherdenVincentSimplex<1>;
 template class QWitherdenVincentSimplex<2>;
 template class QWitherdenVincentSimplex<3>;
 
+template class QGaussCollapsedSimplex<1>;
+template class QGaussCollapsedSimplex<2>;
+template class QGaussCollapsedSimplex<3>;
+
 #ifndef DOXYGEN
 template Quadrature<1>
 QSimplex<1>::compute_affine_transformation(
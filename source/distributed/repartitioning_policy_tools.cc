@@ -243,6 +243,84 @@ namespace RepartitioningPolicyTools
 
 
 
+  template <int dim, int spacedim>
+  AgglomerationPolicy<dim, spacedim>::AgglomerationPolicy(
+    const unsigned int n_min_cells_per_process,
+    const bool         spread_over_processes)
+    : n_min_cells_per_process(n_min_cells_per_process)
+    , spread_over_processes(spread_over_processes)
+  {
+    Assert(n_min_cells_per_process > 0,
+           ExcMessage("The minimal number of cells must be positive."));
+  }
+
+
+
+  template <int dim, int spacedim>
+  LinearAlgebra::distributed::Vector<double>
+  AgglomerationPolicy<dim, spacedim>::partition(
+    const Triangulation<dim, spacedim> &tria_in) const
+  {
+    const auto tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria_in);
+
+    Assert(tria, ExcNotImplemented());
+
+    // step 1) check if the processes that own cells have enough cells on
+    // average
+
+    const auto comm = tria_in.get_mpi_communicator();
+
+    const unsigned int n_processes = Utilities::MPI::n_mpi_processes(comm);
+    const unsigned int n_active_processes = Utilities::MPI::sum(
+      tria->n_locally_owned_active_cells() > 0 ? 1U : 0U, comm);
+
+    const types::global_cell_index n_global_active_cells =
+      tria_in.n_global_active_cells();
+
+    if (n_global_active_cells >=
+        static_cast<types::global_cell_index>(n_min_cells_per_process) *
+          n_active_processes)
+      return {}; // the current partition is fine
+
+    // step 2) agglomerate the cells onto fewer processes, so that each of
+    // them gets at least the specified number of cells; the number of
+    // partitions is smaller than the number of active processes here
+
+    const unsigned int n_partitions = std::max<unsigned int>(
+      1, n_global_active_cells / n_min_cells_per_process);
+    const unsigned int stride =
+      spread_over_processes ? n_processes / n_partitions : 1;
+
+    LinearAlgebra::distributed::Vector<double> partition(
+      tria->global_active_cell_index_partitioner().lock());
+
+    // distribute the cells in the order of their global active cell index,
+    // with the first processes getting one additional cell if the number of
+    // cells is not divisible by the number of partitions
+    const types::global_cell_index min_cells =
+      n_global_active_cells / n_partitions;
+    const types::global_cell_index n_partitions_with_additional_cell =
+      n_global_active_cells - min_cells * n_partitions;
+
+    for (const auto i : partition.locally_owned_elements())
+      {
+        const types::global_cell_index index =
+          (i < (min_cells + 1) * n_partitions_with_additional_cell) ?
+            (i / (min_cells + 1)) :
+            ((i - n_partitions_with_additional_cell) / min_cells);
+
+        AssertIndexRange(index, n_partitions);
+
+        partition[i] = index * stride;
+      }
+
+    return partition;
+  }
+
+
+
   template <int dim, int spacedim>
   CellWeightPolicy<dim, spacedim>::CellWeightPolicy(
     const std::function<
@@ -44,6 +44,55 @@ namespace LinearAlgebra
 
 #  undef TEMPL_COPY_CONSTRUCTOR
 
+    // Vectors with 16-bit floating point types are only meant for storage,
+    // e.g., on the levels of a mixed-precision multigrid method, and are
+    // instantiated together with the conversions from and to the single and
+    // double precision vectors that do the actual work.
+#  if defined(DEAL_II_HAVE_FP16) || defined(DEAL_II_HAVE_BF16)
+#    define TEMPL_CONVERSIONS(S1, S2)                                        \
+      template Vector<S1, ::dealii::MemorySpace::Host>                       \
+        &Vector<S1, ::dealii::MemorySpace::Host>::operator=                  \
+        <S2>(const Vector<S2, ::dealii::MemorySpace::Host> &);               \
+      template void Vector<S1, ::dealii::MemorySpace::Host>::reinit<S2>(     \
+        const Vector<S2, ::dealii::MemorySpace::Host> &, const bool);        \
+      template Vector<S1, ::dealii::MemorySpace::Host>::accumulation_type    \
+      Vector<S1, ::dealii::MemorySpace::Host>::inner_product_local<S2>(      \
+        const Vector<S2, ::dealii::MemorySpace::Host> &) const;              \
+      template void                                                          \
+      Vector<S1, ::dealii::MemorySpace::Host>::copy_locally_owned_data_from< \
+        S2>(const Vector<S2, ::dealii::MemorySpace::Host> &)
+
+#    define TEMPL_STORAGE_VECTOR(S)                                         \
+      template class Vector<S, ::dealii::MemorySpace::Host>;                \
+      template void                                                         \
+      Vector<S, ::dealii::MemorySpace::Host>::import_elements<              \
+        ::dealii::MemorySpace::Host>(                                       \
+        const Vector<S, ::dealii::MemorySpace::Host> &,                     \
+        VectorOperation::values);                                           \
+      template void Vector<S, ::dealii::MemorySpace::Host>::reinit<S>(      \
+        const Vector<S, ::dealii::MemorySpace::Host> &, const bool);        \
+      template Vector<S, ::dealii::MemorySpace::Host>::accumulation_type    \
+      Vector<S, ::dealii::MemorySpace::Host>::inner_product_local<S>(       \
+        const Vector<S, ::dealii::MemorySpace::Host> &) const;              \
+      template void                                                         \
+      Vector<S, ::dealii::MemorySpace::Host>::copy_locally_owned_data_from< \
+        S>(const Vector<S, ::dealii::MemorySpace::Host> &);                 \
+      TEMPL_CONVERSIONS(S, float);                                          \
+      TEMPL_CONVERSIONS(S, double);                                         \
+      TEMPL_CONVERSIONS(float, S);                                          \
+      TEMPL_CONVERSIONS(double, S)
+
+#    ifdef DEAL_II_HAVE_FP16
+    TEMPL_STORAGE_VECTOR(_Float16);
+#    endif
+#    ifdef DEAL_II_HAVE_BF16
+    TEMPL_STORAGE_VECTOR(__bf16);
+#    endif
+
+#    undef TEMPL_STORAGE_VECTOR
+#    undef TEMPL_CONVERSIONS
+#  endif
+
     template class Vector<float, ::dealii::MemorySpace::Default>;
     template class Vector<double, ::dealii::MemorySpace::Default>;
 
@@ -0,0 +1,723 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/precondition_amg.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace PreconditionAMGImplementation
+  {
+    using size_type = types::global_dof_index;
+
+    /**
+     * The entries of a sparse matrix as a list of column indices and values
+     * per row, with sorted column indices.
+     */
+    using RowEntries = std::vector<std::vector<std::pair<size_type, double>>>;
+
+    /**
+     * The minimal number of rows that is worked on by a single thread.
+     */
+    constexpr unsigned int grain_size = 512;
+
+    /**
+     * The number of rows of the blocks that are aggregated independently of
+     * each other.
+     */
+    constexpr size_type aggregation_block_size = 32768;
+
+
+
+    /**
+     * Return the strong off-diagonal connections of each row together with
+     * their strength $|a_{ij}|/\sqrt{|a_{ii}a_{jj}|}$, and whether the rows
+     * have nonzero off-diagonal entries at all. The latter is stored as
+     * characters rather than a std::vector<bool> as it is written by
+     * several threads.
+     */
+    std::pair<RowEntries, std::vector<unsigned char>>
+    compute_strong_connections(const SparseMatrix<double> &matrix,
+                               const double                threshold)
+    {
+      const size_type     n = matrix.m();
+      std::vector<double> diagonal(n);
+      parallel::apply_to_subranges(
+        size_type(0),
+        n,
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            diagonal[i] = std::abs(matrix.diag_element(i));
+        },
+        grain_size);
+
+      RowEntries                 strong(n);
+      std::vector<unsigned char> has_off_diagonal(n);
+      parallel::apply_to_subranges(
+        size_type(0),
+        n,
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            {
+              bool off_diagonal = false;
+              for (auto entry = matrix.begin(i); entry != matrix.end(i);
+                   ++entry)
+                {
+                  const size_type j = entry->column();
+                  if (j == i || entry->value() == 0.)
+                    continue;
+                  off_diagonal           = true;
+                  const double magnitude = std::abs(entry->value());
+                  const double scaling   = std::sqrt(diagonal[i] * diagonal[j]);
+                  if (magnitude > threshold * scaling)
+                    strong[i].emplace_back(j,
+                                           scaling > 0. ? magnitude / scaling :
+                                                          magnitude);
+                }
+              std::sort(strong[i].begin(), strong[i].end());
+              has_off_diagonal[i] = off_diagonal;
+            }
+        },
+        grain_size);
+
+      return {std::move(strong), std::move(has_off_diagonal)};
+    }
+
+
+
+    /**
+     * Aggregate the rows in the range [begin, end) with the three phases of
+     * the algorithm by Vaněk et al., only considering the connections
+     * within the range. The aggregates are numbered starting from zero
+     * within the range. Return the number of aggregates.
+     */
+    unsigned int
+    aggregate_block(const RowEntries                 &strong,
+                    const std::vector<unsigned char> &has_off_diagonal,
+                    const size_type                   begin,
+                    const size_type                   end,
+                    std::vector<unsigned int>        &aggregate)
+    {
+      const unsigned int unassigned   = numbers::invalid_unsigned_int;
+      unsigned int       n_aggregates = 0;
+
+      const auto in_block = [&](const size_type j) {
+        return j >= begin && j < end;
+      };
+
+      // phase 1: form aggregates of the rows whose strong neighbors are all
+      // unassigned, together with these neighbors
+      for (size_type i = begin; i < end; ++i)
+        {
+          if (aggregate[i] != unassigned || !has_off_diagonal[i])
+            continue;
+          bool neighbors_free = true;
+          for (const auto &[j, strength] : strong[i])
+            if (in_block(j) && aggregate[j] != unassigned)
+              {
+                neighbors_free = false;
+                break;
+              }
+          if (!neighbors_free)
+            continue;
+          aggregate[i] = n_aggregates;
+          for (const auto &[j, strength] : strong[i])
+            if (in_block(j))
+              aggregate[j] = n_aggregates;
+          ++n_aggregates;
+        }
+
+      // phase 2: add the remaining rows to the aggregate of phase 1 they are
+      // most strongly connected to
+      const std::vector<unsigned int> aggregate_phase_1(aggregate.begin() +
+                                                          begin,
+                                                        aggregate.begin() +
+                                                          end);
+      for (size_type i = begin; i < end; ++i)
+        {
+          if (aggregate[i] != unassigned || !has_off_diagonal[i])
+            continue;
+          double strongest = 0.;
+          for (const auto &[j, strength] : strong[i])
+            if (in_block(j) && aggregate_phase_1[j - begin] != unassigned &&
+                strength > strongest)
+              {
+                strongest    = strength;
+                aggregate[i] = aggregate_phase_1[j - begin];
+              }
+        }
+
+      // phase 3: form aggregates of the rows that are still left, together
+      // with their unassigned strong neighbors
+      for (size_type i = begin; i < end; ++i)
+        {
+          if (aggregate[i] != unassigned || !has_off_diagonal[i])
+            continue;
+          aggregate[i] = n_aggregates;
+          for (const auto &[j, strength] : strong[i])
+            if (in_block(j) && aggregate[j] == unassigned)
+              aggregate[j] = n_aggregates;
+          ++n_aggregates;
+        }
+
+      return n_aggregates;
+    }
+
+
+
+    /**
+     * Compute the aggregate of each row, or numbers::invalid_unsigned_int
+     * for rows that are not aggregated. Return the number of aggregates.
+     */
+    unsigned int
+    compute_aggregates(const RowEntries                 &strong,
+                       const std::vector<unsigned char> &has_off_diagonal,
+                       std::vector<unsigned int>        &aggregate)
+    {
+      const size_type n = strong.size();
+      aggregate.assign(n, numbers::invalid_unsigned_int);
+
+      const size_type n_blocks =
+        (n + aggregation_block_size - 1) / aggregation_block_size;
+      std::vector<unsigned int> n_aggregates(n_blocks + 1);
+      parallel::apply_to_subranges(
+        size_type(0),
+        n_blocks,
+        [&](const size_type begin, const size_type end) {
+          for (size_type b = begin; b < end; ++b)
+            n_aggregates[b + 1] =
+              aggregate_block(strong,
+                              has_off_diagonal,
+                              b * aggregation_block_size,
+                              std::min(n, (b + 1) * aggregation_block_size),
+                              aggregate);
+        },
+        1);
+
+      // convert the numbers within the blocks to global ones
+      for (size_type b = 0; b < n_blocks; ++b)
+        n_aggregates[b + 1] += n_aggregates[b];
+      parallel::apply_to_subranges(
+        size_type(0),
+        n,
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            if (aggregate[i] != numbers::invalid_unsigned_int)
+              aggregate[i] += n_aggregates[i / aggregation_block_size];
+        },
+        grain_size);
+
+      return n_aggregates.back();
+    }
+
+
+
+    /**
+     * Return the Gershgorin bound on the largest eigenvalue of $D^{-1}A$,
+     * but at least one.
+     */
+    double
+    compute_eigenvalue_bound(const SparseMatrix<double> &matrix)
+    {
+      std::vector<double> row_bounds(matrix.m());
+      parallel::apply_to_subranges(
+        size_type(0),
+        matrix.m(),
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            {
+              const double diagonal = std::abs(matrix.diag_element(i));
+              if (diagonal == 0.)
+                continue;
+              double sum = 0.;
+              for (auto entry = matrix.begin(i); entry != matrix.end(i);
+                   ++entry)
+                sum += std::abs(entry->value());
+              row_bounds[i] = sum / diagonal;
+            }
+        },
+        grain_size);
+      return std::accumulate(row_bounds.begin(),
+                             row_bounds.end(),
+                             1.,
+                             [](const double a, const double b) {
+                               return std::max(a, b);
+                             });
+    }
+
+
+
+    /**
+     * Compute the smoothed prolongator $P = (I - \omega/\lambda D^{-1} A)
+     * P_0$ with the tentative prolongator $P_0$ defined by the aggregates.
+     */
+    RowEntries
+    compute_prolongator(const SparseMatrix<double>      &matrix,
+                        const std::vector<unsigned int> &aggregate,
+                        const unsigned int               n_aggregates,
+                        const double                     damping)
+    {
+      const size_type n = matrix.m();
+
+      // the tentative prolongator interpolates the normalized constant
+      // vector on each aggregate
+      std::vector<double> aggregate_size(n_aggregates);
+      for (size_type i = 0; i < n; ++i)
+        if (aggregate[i] != numbers::invalid_unsigned_int)
+          aggregate_size[aggregate[i]] += 1.;
+      std::vector<double> tentative(n);
+      for (size_type i = 0; i < n; ++i)
+        if (aggregate[i] != numbers::invalid_unsigned_int)
+          tentative[i] = 1. / std::sqrt(aggregate_size[aggregate[i]]);
+
+      const double max_eigenvalue = compute_eigenvalue_bound(matrix);
+
+      RowEntries prolongator(n);
+      parallel::apply_to_subranges(
+        size_type(0),
+        n,
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            {
+              std::vector<std::pair<size_type, double>> &row = prolongator[i];
+              if (aggregate[i] != numbers::invalid_unsigned_int)
+                row.emplace_back(aggregate[i], tentative[i]);
+
+              const double diagonal = matrix.diag_element(i);
+              if (damping != 0. && diagonal != 0.)
+                {
+                  const double factor = damping / (max_eigenvalue * diagonal);
+                  for (auto entry = matrix.begin(i); entry != matrix.end(i);
+                       ++entry)
+                    {
+                      const size_type k = entry->column();
+                      if (aggregate[k] != numbers::invalid_unsigned_int)
+                        row.emplace_back(aggregate[k],
+                                         -factor * entry->value() *
+                                           tentative[k]);
+                    }
+                }
+
+              // merge the entries with the same column
+              std::sort(row.begin(), row.end());
+              unsigned int n_unique = 0;
+              for (unsigned int e = 0; e < row.size(); ++e)
+                if (n_unique > 0 && row[n_unique - 1].first == row[e].first)
+                  row[n_unique - 1].second += row[e].second;
+                else
+                  row[n_unique++] = row[e];
+              row.resize(n_unique);
+            }
+        },
+        grain_size);
+
+      return prolongator;
+    }
+
+
+
+    /**
+     * Compute the entries of the product of two sparse matrices, in
+     * parallel over the rows of the result.
+     */
+    RowEntries
+    multiply(const SparseMatrix<double> &a, const SparseMatrix<double> &b)
+    {
+      AssertDimension(a.n(), b.m());
+      RowEntries result(a.m());
+      parallel::apply_to_subranges(
+        size_type(0),
+        a.m(),
+        [&](const size_type begin, const size_type end) {
+          // accumulate the rows in a dense array, keeping track of the
+          // columns that were touched
+          std::vector<double>    values(b.n(), 0.);
+          std::vector<bool>      touched(b.n(), false);
+          std::vector<size_type> columns;
+          for (size_type i = begin; i < end; ++i)
+            {
+              columns.clear();
+              for (auto entry_a = a.begin(i); entry_a != a.end(i); ++entry_a)
+                {
+                  const size_type k = entry_a->column();
+                  for (auto entry_b = b.begin(k); entry_b != b.end(k);
+                       ++entry_b)
+                    {
+                      const size_type j = entry_b->column();
+                      if (!touched[j])
+                        {
+                          touched[j] = true;
+                          columns.push_back(j);
+                        }
+                      values[j] += entry_a->value() * entry_b->value();
+                    }
+                }
+              std::sort(columns.begin(), columns.end());
+              result[i].reserve(columns.size());
+              for (const size_type j : columns)
+                {
+                  result[i].emplace_back(j, values[j]);
+                  values[j]  = 0.;
+                  touched[j] = false;
+                }
+            }
+        },
+        grain_size / 8);
+      return result;
+    }
+
+
+
+    /**
+     * Fill a sparsity pattern and a matrix with @p n_columns columns from
+     * the given entries.
+     */
+    void
+    build_matrix(const RowEntries     &entries,
+                 const size_type       n_columns,
+                 SparsityPattern      &sparsity,
+                 SparseMatrix<double> &matrix)
+    {
+      const size_type           n_rows = entries.size();
+      std::vector<unsigned int> row_lengths(n_rows);
+      for (size_type i = 0; i < n_rows; ++i)
+        row_lengths[i] = entries[i].size() + 1;
+      sparsity.reinit(n_rows, n_columns, row_lengths);
+
+      std::vector<size_type> columns;
+      for (size_type i = 0; i < n_rows; ++i)
+        {
+          columns.clear();
+          for (const auto &[j, value] : entries[i])
+            columns.push_back(j);
+          sparsity.add_entries(i, columns.begin(), columns.end(), true);
+        }
+      sparsity.compress();
+
+      matrix.reinit(sparsity);
+      parallel::apply_to_subranges(
+        size_type(0),
+        n_rows,
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            for (const auto &[j, value] : entries[i])
+              matrix.set(i, j, value);
+        },
+        grain_size);
+    }
+
+
+
+    /**
+     * Return the entries of the transpose of the given matrix.
+     */
+    RowEntries
+    transpose(const SparseMatrix<double> &matrix)
+    {
+      RowEntries result(matrix.n());
+      for (size_type i = 0; i < matrix.m(); ++i)
+        for (auto entry = matrix.begin(i); entry != matrix.end(i); ++entry)
+          result[entry->column()].emplace_back(i, entry->value());
+      return result;
+    }
+  } // namespace PreconditionAMGImplementation
+} // namespace internal
+
+
+
+PreconditionAMG::AdditionalData::AdditionalData(
+  const double       strong_connection_threshold,
+  const double       prolongator_damping,
+  const unsigned int max_levels,
+  const unsigned int coarse_size,
+  const SmootherType smoother_type,
+  const unsigned int smoother_sweeps,
+  const double       smoothing_range,
+  const double       jacobi_relaxation)
+  : strong_connection_threshold(strong_connection_threshold)
+  , prolongator_damping(prolongator_damping)
+  , max_levels(max_levels)
+  , coarse_size(coarse_size)
+  , smoother_type(smoother_type)
+  , smoother_sweeps(smoother_sweeps)
+  , smoothing_range(smoothing_range)
+  , jacobi_relaxation(jacobi_relaxation)
+{}
+
+
+
+PreconditionAMG::~PreconditionAMG()
+{
+  clear();
+}
+
+
+
+void
+PreconditionAMG::initialize(const SparseMatrix<double> &matrix,
+                            const AdditionalData       &additional_data)
+{
+  using namespace internal::PreconditionAMGImplementation;
+
+  AssertDimension(matrix.m(), matrix.n());
+  Assert(additional_data.max_levels > 0,
+         ExcMessage("At least one level is needed."));
+
+  clear();
+  this->additional_data = additional_data;
+
+  levels.push_back(std::make_unique<Level>());
+  levels.back()->matrix = &matrix;
+
+  // build the hierarchy from the finest to the coarsest level
+  while (levels.size() < additional_data.max_levels &&
+         levels.back()->matrix->m() > additional_data.coarse_size)
+    {
+      Level                      &fine        = *levels.back();
+      const SparseMatrix<double> &fine_matrix = *fine.matrix;
+
+      const auto [strong, has_off_diagonal] =
+        compute_strong_connections(fine_matrix,
+                                   additional_data.strong_connection_threshold);
+      std::vector<unsigned int> aggregate;
+      const unsigned int        n_aggregates =
+        compute_aggregates(strong, has_off_diagonal, aggregate);
+
+      // stop if the aggregation does not reduce the size noticeably
+      if (n_aggregates == 0 || n_aggregates > 0.8 * fine_matrix.m())
+        break;
+
+      build_matrix(compute_prolongator(fine_matrix,
+                                       aggregate,
+                                       n_aggregates,
+                                       additional_data.prolongator_damping),
+                   n_aggregates,
+                   fine.sparsity_prolongation,
+                   fine.prolongation);
+      build_matrix(transpose(fine.prolongation),
+                   fine_matrix.m(),
+                   fine.sparsity_restriction,
+                   fine.restriction);
+
+      // Galerkin triple product A_c = P^T (A P)
+      SparsityPattern      sparsity_ap;
+      SparseMatrix<double> ap;
+      build_matrix(multiply(fine_matrix, fine.prolongation),
+                   n_aggregates,
+                   sparsity_ap,
+                   ap);
+
+      levels.push_back(std::make_unique<Level>());
+      Level &coarse = *levels.back();
+      build_matrix(multiply(fine.restriction, ap),
+                   n_aggregates,
+                   coarse.sparsity,
+                   coarse.owned_matrix);
+      coarse.matrix = &coarse.owned_matrix;
+
+      fine.residual.reinit(fine_matrix.m());
+      fine.coarse_rhs.reinit(n_aggregates);
+      fine.coarse_solution.reinit(n_aggregates);
+    }
+
+  // the coarsest level is solved directly unless the coarsening stopped far
+  // above the requested size, in which case the cost of a dense inverse
+  // would dominate the setup and the smoother is used on that level as well
+  const bool coarse_direct =
+    levels.back()->matrix->m() <=
+    static_cast<size_type>(coarse_size_factor) * additional_data.coarse_size;
+  const unsigned int n_smoothed_levels =
+    coarse_direct ? levels.size() - 1 : levels.size();
+
+  // set up the smoothers on all levels except the coarsest one if that one
+  // is solved directly
+  for (unsigned int l = 0; l < n_smoothed_levels; ++l)
+    {
+      Level &level = *levels[l];
+      if (additional_data.smoother_type == SmootherType::chebyshev)
+        {
+          using ChebyshevType =
+            PreconditionChebyshev<SparseMatrix<double>, Vector<double>>;
+          ChebyshevType::AdditionalData data;
+          data.degree          = additional_data.smoother_sweeps;
+          data.smoothing_range = additional_data.smoothing_range;
+          // use the Gershgorin bound as the largest eigenvalue rather than
+          // an estimate by an iterative method, which might underestimate
+          // it on the coarser levels and make the V-cycle indefinite
+          data.eig_cg_n_iterations = 0;
+          data.max_eigenvalue      = compute_eigenvalue_bound(*level.matrix);
+          data.preconditioner =
+            std::make_shared<DiagonalMatrix<Vector<double>>>();
+          Vector<double> &inverse_diagonal =
+            data.preconditioner->get_vector();
+          inverse_diagonal.reinit(level.matrix->m());
+          for (size_type i = 0; i < level.matrix->m(); ++i)
+            {
+              const double diagonal = level.matrix->diag_element(i);
+              inverse_diagonal(i)   = diagonal != 0. ? 1. / diagonal : 1.;
+            }
+          level.chebyshev.initialize(*level.matrix, data);
+        }
+      else
+        level.jacobi.initialize(
+          *level.matrix,
+          PreconditionJacobi<SparseMatrix<double>>::AdditionalData(
+            additional_data.jacobi_relaxation,
+            additional_data.smoother_sweeps));
+    }
+
+  // invert the matrix on the coarsest level
+  if (coarse_direct)
+    {
+      coarse_inverse.copy_from(*levels.back()->matrix);
+      coarse_inverse.gauss_jordan();
+    }
+}
+
+
+
+void
+PreconditionAMG::clear()
+{
+  coarse_inverse.reinit(0, 0);
+  levels.clear();
+}
+
+
+
+void
+PreconditionAMG::vmult(Vector<double> &dst, const Vector<double> &src) const
+{
+  Assert(!levels.empty(), ExcNotInitialized());
+  v_cycle(0, dst, src);
+}
+
+
+
+void
+PreconditionAMG::Tvmult(Vector<double> &dst, const Vector<double> &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+unsigned int
+PreconditionAMG::n_levels() const
+{
+  return levels.size();
+}
+
+
+
+PreconditionAMG::size_type
+PreconditionAMG::m(const unsigned int level) const
+{
+  AssertIndexRange(level, levels.size());
+  return levels[level]->matrix->m();
+}
+
+
+
+double
+PreconditionAMG::operator_complexity() const
+{
+  Assert(!levels.empty(), ExcNotInitialized());
+  double n_nonzeros = 0;
+  for (const auto &level : levels)
+    n_nonzeros += level->matrix->n_nonzero_elements();
+  return n_nonzeros / levels[0]->matrix->n_nonzero_elements();
+}
+
+
+
+std::size_t
+PreconditionAMG::memory_consumption() const
+{
+  std::size_t memory = MemoryConsumption::memory_consumption(coarse_inverse);
+  for (const auto &level : levels)
+    memory += level->sparsity.memory_consumption() +
+              level->sparsity_prolongation.memory_consumption() +
+              level->sparsity_restriction.memory_consumption() +
+              level->owned_matrix.memory_consumption() +
+              level->prolongation.memory_consumption() +
+              level->restriction.memory_consumption() +
+              level->residual.memory_consumption() +
+              level->coarse_rhs.memory_consumption() +
+              level->coarse_solution.memory_consumption();
+  return memory;
+}
+
+
+
+void
+PreconditionAMG::v_cycle(const unsigned int    level,
+                         Vector<double>       &solution,
+                         const Vector<double> &rhs) const
+{
+  if (level + 1 == levels.size())
+    {
+      if (coarse_inverse.m() == levels[level]->matrix->m())
+        coarse_inverse.vmult(solution, rhs);
+      else
+        smooth(level, solution, rhs, true);
+      return;
+    }
+
+  const Level &data = *levels[level];
+  smooth(level, solution, rhs, true);
+  data.matrix->residual(data.residual, solution, rhs);
+  data.restriction.vmult(data.coarse_rhs, data.residual);
+  v_cycle(level + 1, data.coarse_solution, data.coarse_rhs);
+  data.prolongation.vmult_add(solution, data.coarse_solution);
+  smooth(level, solution, rhs, false);
+}
+
+
+
+void
+PreconditionAMG::smooth(const unsigned int    level,
+                        Vector<double>       &solution,
+                        const Vector<double> &rhs,
+                        const bool            zero_initial_guess) const
+{
+  const Level &data = *levels[level];
+  if (additional_data.smoother_type == SmootherType::chebyshev)
+    {
+      if (zero_initial_guess)
+        data.chebyshev.vmult(solution, rhs);
+      else
+        data.chebyshev.step(solution, rhs);
+    }
+  else
+    {
+      if (zero_initial_guess)
+        data.jacobi.vmult(solution, rhs);
+      else
+        data.jacobi.step(solution, rhs);
+    }
+}
+
+DEAL_II_NAMESPACE_CLOSE
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <set>
 
 #ifdef DEAL_II_WITH_MPI
@@ -516,6 +517,89 @@ namespace SparsityTools
   }
 
 
+
+  std::vector<std::vector<SparsityPattern::size_type>>
+  make_greedy_coloring(const SparsityPattern &sparsity_pattern)
+  {
+    using size_type = SparsityPattern::size_type;
+
+    Assert(sparsity_pattern.n_rows() == sparsity_pattern.n_cols(),
+           ExcNotQuadratic());
+    Assert(sparsity_pattern.is_compressed(),
+           SparsityPattern::ExcNotCompressed());
+
+    const size_type n_rows = sparsity_pattern.n_rows();
+
+    // the pattern need not be symmetric, so we also need to know which rows
+    // refer to a given row. collect this information in a compressed
+    // row-storage format of the transposed pattern. we only need the entries
+    // (i,j) with i<j since the greedy algorithm below only looks at rows that
+    // have already been colored
+    std::vector<std::size_t> transpose_rowstart(n_rows + 1, 0);
+    for (size_type row = 0; row < n_rows; ++row)
+      for (auto it = sparsity_pattern.begin(row);
+           it != sparsity_pattern.end(row);
+           ++it)
+        if (it->column() > row)
+          ++transpose_rowstart[it->column() + 1];
+    std::partial_sum(transpose_rowstart.begin(),
+                     transpose_rowstart.end(),
+                     transpose_rowstart.begin());
+
+    std::vector<size_type>   transpose_colnums(transpose_rowstart.back());
+    std::vector<std::size_t> next_entry(transpose_rowstart.begin(),
+                                        transpose_rowstart.end() - 1);
+    for (size_type row = 0; row < n_rows; ++row)
+      for (auto it = sparsity_pattern.begin(row);
+           it != sparsity_pattern.end(row);
+           ++it)
+        if (it->column() > row)
+          transpose_colnums[next_entry[it->column()]++] = row;
+
+    // greedy coloring: for each row, mark the colors of the already colored
+    // neighbors with the index of the current row, and pick the first color
+    // not marked
+    const unsigned int invalid_color = numbers::invalid_unsigned_int;
+
+    std::vector<unsigned int>           row_color(n_rows, invalid_color);
+    std::vector<size_type>              color_used_by;
+    std::vector<std::vector<size_type>> colored_rows;
+
+    const auto mark_color = [&](const size_type neighbor,
+                                const size_type row) {
+      if (neighbor != row && row_color[neighbor] != invalid_color)
+        color_used_by[row_color[neighbor]] = row;
+    };
+
+    for (size_type row = 0; row < n_rows; ++row)
+      {
+        for (auto it = sparsity_pattern.begin(row);
+             it != sparsity_pattern.end(row);
+             ++it)
+          mark_color(it->column(), row);
+        for (std::size_t j = transpose_rowstart[row];
+             j < transpose_rowstart[row + 1];
+             ++j)
+          mark_color(transpose_colnums[j], row);
+
+        unsigned int color = 0;
+        while (color < color_used_by.size() && color_used_by[color] == row)
+          ++color;
+
+        if (color == color_used_by.size())
+          {
+            color_used_by.push_back(numbers::invalid_size_type);
+            colored_rows.emplace_back();
+          }
+
+        row_color[row] = color;
+        colored_rows[color].push_back(row);
+      }
+
+    return colored_rows;
+  }
+
+
   namespace internal
   {
     /**
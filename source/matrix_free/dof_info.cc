@@ -1661,6 +1661,32 @@ namespace internal
       const TaskInfo &,
       const std::vector<FaceToCellTopology<16>> &);
 
+    template void
+    DoFInfo::make_chunk_connectivity_graph<1>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<1>> &,
+      DynamicSparsityPattern &) const;
+    template void
+    DoFInfo::make_chunk_connectivity_graph<2>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<2>> &,
+      DynamicSparsityPattern &) const;
+    template void
+    DoFInfo::make_chunk_connectivity_graph<4>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<4>> &,
+      DynamicSparsityPattern &) const;
+    template void
+    DoFInfo::make_chunk_connectivity_graph<8>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<8>> &,
+      DynamicSparsityPattern &) const;
+    template void
+    DoFInfo::make_chunk_connectivity_graph<16>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<16>> &,
+      DynamicSparsityPattern &) const;
+
     template void
     DoFInfo::print_memory_consumption<std::ostream>(std::ostream &,
                                                     const TaskInfo &) const;
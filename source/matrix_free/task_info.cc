@@ -29,12 +29,15 @@
 #ifdef DEAL_II_WITH_TBB
 #  include <tbb/blocked_range.h>
 #  include <tbb/parallel_for.h>
+#  include <tbb/partitioner.h>
 #  include <tbb/task.h>
 #  ifndef DEAL_II_TBB_WITH_ONEAPI
 #    include <tbb/task_scheduler_init.h>
 #  endif
 #endif
 
+#include <chrono>
+#include <cmath>
 #include <iostream>
 #include <set>
 
@@ -352,18 +355,140 @@ namespace internal
       // If we use thread parallelism, we do not currently support to schedule
       // pieces of updates within the loop, so this index will collect all
       // calls in that case and work like a single complete loop over all
-      // cells
-      if (scheme != none)
+      // cells. The scheme contiguous_blocks works on the chunks of the serial
+      // loop and thus supports the pieces of updates.
+      const bool use_subrange_updates =
+        scheme == none || scheme == contiguous_blocks;
+      if (!use_subrange_updates)
         funct.cell_loop_pre_range(numbers::invalid_unsigned_int);
       else
         funct.cell_loop_pre_range(
           partition_row_index[partition_row_index.size() - 2]);
 
+      // when requested, measure the time spent in the parts of the serial
+      // loop and while waiting for the communication
+      const bool collect_statistics =
+        scheme == none && static_cast<bool>(overlap_statistics_callback);
+      LoopOverlapStatistics statistics;
+      const auto measure_time = [&](double &time, const auto &operation) {
+        if (collect_statistics)
+          {
+            const auto start = std::chrono::steady_clock::now();
+            operation();
+            time += std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+          }
+        else
+          operation();
+      };
+
       funct.vector_update_ghosts_start();
 
-#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
+      // threaded loop over contiguous blocks of chunks, going through the
+      // three parts of the serial loop with the MPI transfer in between
+      if (scheme == contiguous_blocks)
+        {
+          // run an operation on each thread block. The static partitioner
+          // assigns the blocks to the same threads in every call, such that
+          // the vector entries of a block are zeroed, computed on, and
+          // post-processed by the thread owning it
+          const auto run_on_thread_blocks = [&](const auto &operation) {
+#ifdef DEAL_II_WITH_TBB
+            tbb::parallel_for(
+              tbb::blocked_range<unsigned int>(0, n_thread_blocks, 1),
+              [&](const tbb::blocked_range<unsigned int> &range) {
+                for (unsigned int t = range.begin(); t < range.end(); ++t)
+                  operation(t);
+              },
+              tbb::static_partitioner());
+#else
+            for (unsigned int t = 0; t < n_thread_blocks; ++t)
+              operation(t);
+#endif
+          };
 
-      if (scheme != none)
+          const auto run_chunk = [&](const unsigned int i) {
+            AssertIndexRange(i + 1, cell_partition_data.size());
+            if (cell_partition_data[i + 1] > cell_partition_data[i])
+              funct.cell(i);
+
+            if (face_partition_data.empty() == false)
+              {
+                if (face_partition_data[i + 1] > face_partition_data[i])
+                  funct.face(i);
+                if (boundary_partition_data[i + 1] >
+                    boundary_partition_data[i])
+                  funct.boundary(i);
+              }
+          };
+
+          const unsigned int n_parts = partition_row_index.size() - 2;
+          AssertDimension(thread_block_partition_data.size(),
+                          n_parts * (n_thread_blocks + 1));
+
+          // the operation after the loop of the last chunk also processes
+          // the constrained entries, so it must run after all other chunks
+          const unsigned int last_chunk = partition_row_index[n_parts] - 1;
+
+          for (unsigned int part = 0; part < n_parts; ++part)
+            {
+              if (part == 1)
+                funct.vector_update_ghosts_finish();
+
+              const unsigned int *blocks =
+                thread_block_partition_data.data() +
+                part * (n_thread_blocks + 1);
+
+              // the ranges of the vectors first touched within this part are
+              // disjoint between the chunks, so all threads can work on them
+              // before the cell work of the part starts
+              run_on_thread_blocks([&](const unsigned int t) {
+                for (unsigned int i = blocks[t]; i < blocks[t + 1]; ++i)
+                  {
+                    funct.cell_loop_pre_range(i);
+                    funct.zero_dst_vector_range(i);
+                  }
+              });
+
+              // chunks that only access vector entries of their own thread
+              // block
+              run_on_thread_blocks([&](const unsigned int t) {
+                for (unsigned int i = blocks[t]; i < blocks[t + 1]; ++i)
+                  if (chunk_at_thread_boundary[i] == 0)
+                    run_chunk(i);
+              });
+
+              // chunks at the boundary between the thread blocks, one color
+              // after the other, which are distributed dynamically among the
+              // threads
+              for (unsigned int color = thread_boundary_color_row_index[part];
+                   color < thread_boundary_color_row_index[part + 1];
+                   ++color)
+                parallel::apply_to_subranges(
+                  thread_boundary_color_data[color],
+                  thread_boundary_color_data[color + 1],
+                  [&](const unsigned int begin, const unsigned int end) {
+                    for (unsigned int j = begin; j < end; ++j)
+                      run_chunk(thread_boundary_chunks[j]);
+                  },
+                  1);
+
+              run_on_thread_blocks([&](const unsigned int t) {
+                for (unsigned int i = blocks[t]; i < blocks[t + 1]; ++i)
+                  if (i != last_chunk)
+                    funct.cell_loop_post_range(i);
+              });
+              if (last_chunk >= partition_row_index[part] &&
+                  last_chunk < partition_row_index[part + 1])
+                funct.cell_loop_post_range(last_chunk);
+
+              if (part == 1)
+                funct.vector_compress_start();
+            }
+        }
+#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
+      else if (scheme != none)
         {
           funct.zero_dst_vector_range(numbers::invalid_unsigned_int);
           if (scheme == partition_partition && evens > 0)
@@ -600,8 +725,8 @@ namespace internal
                 }
             }
         }
-      else
 #endif
+      else
         // serial loop, go through up to three times and do the MPI transfer at
         // the beginning/end of the second part
         {
@@ -609,38 +734,56 @@ namespace internal
                ++part)
             {
               if (part == 1)
-                funct.vector_update_ghosts_finish();
-
-              for (unsigned int i = partition_row_index[part];
-                   i < partition_row_index[part + 1];
-                   ++i)
-                {
-                  funct.cell_loop_pre_range(i);
-                  funct.zero_dst_vector_range(i);
-                  AssertIndexRange(i + 1, cell_partition_data.size());
-                  if (cell_partition_data[i + 1] > cell_partition_data[i])
-                    {
-                      funct.cell(i);
-                    }
+                measure_time(statistics.wait_time_update_ghosts, [&]() {
+                  funct.vector_update_ghosts_finish();
+                });
+
+              unsigned int &n_cell_batches =
+                part == 0 ? statistics.n_cell_batches_during_update_ghosts :
+                part == 1 ? statistics.n_cell_batches_with_ghosts :
+                            statistics.n_cell_batches_during_compress;
+              double &compute_time =
+                part == 0 ? statistics.compute_time_during_update_ghosts :
+                part == 1 ? statistics.compute_time_with_ghosts :
+                            statistics.compute_time_during_compress;
+              measure_time(compute_time, [&]() {
+                for (unsigned int i = partition_row_index[part];
+                     i < partition_row_index[part + 1];
+                     ++i)
+                  {
+                    funct.cell_loop_pre_range(i);
+                    funct.zero_dst_vector_range(i);
+                    AssertIndexRange(i + 1, cell_partition_data.size());
+                    if (cell_partition_data[i + 1] > cell_partition_data[i])
+                      {
+                        funct.cell(i);
+                        n_cell_batches +=
+                          cell_partition_data[i + 1] - cell_partition_data[i];
+                      }
 
-                  if (face_partition_data.empty() == false)
-                    {
-                      if (face_partition_data[i + 1] > face_partition_data[i])
-                        funct.face(i);
-                      if (boundary_partition_data[i + 1] >
-                          boundary_partition_data[i])
-                        funct.boundary(i);
-                    }
-                  funct.cell_loop_post_range(i);
-                }
+                    if (face_partition_data.empty() == false)
+                      {
+                        if (face_partition_data[i + 1] >
+                            face_partition_data[i])
+                          funct.face(i);
+                        if (boundary_partition_data[i + 1] >
+                            boundary_partition_data[i])
+                          funct.boundary(i);
+                      }
+                    funct.cell_loop_post_range(i);
+                  }
+              });
 
               if (part == 1)
                 funct.vector_compress_start();
             }
         }
-      funct.vector_compress_finish();
+      measure_time(statistics.wait_time_compress,
+                   [&]() { funct.vector_compress_finish(); });
+      if (collect_statistics)
+        overlap_statistics_callback(statistics);
 
-      if (scheme != none)
+      if (!use_subrange_updates)
         funct.cell_loop_post_range(numbers::invalid_unsigned_int);
       else
         funct.cell_loop_post_range(
@@ -681,6 +824,16 @@ namespace internal
       communicator = MPI_COMM_SELF;
       my_pid       = 0;
       n_procs      = 1;
+
+      n_thread_blocks = 0;
+      thread_block_partition_data.clear();
+      chunk_at_thread_boundary.clear();
+      thread_boundary_chunks.clear();
+      thread_boundary_color_data.clear();
+      thread_boundary_color_row_index.clear();
+
+      interior_fraction_before_ghosts = 0.5;
+      overlap_statistics_callback     = nullptr;
     }
 
 
@@ -713,7 +866,13 @@ namespace internal
         MemoryConsumption::memory_consumption(partition_evens) +
         MemoryConsumption::memory_consumption(partition_odds) +
         MemoryConsumption::memory_consumption(partition_n_blocked_workers) +
-        MemoryConsumption::memory_consumption(partition_n_workers));
+        MemoryConsumption::memory_consumption(partition_n_workers) +
+        MemoryConsumption::memory_consumption(thread_block_partition_data) +
+        MemoryConsumption::memory_consumption(chunk_at_thread_boundary) +
+        MemoryConsumption::memory_consumption(thread_boundary_chunks) +
+        MemoryConsumption::memory_consumption(thread_boundary_color_data) +
+        MemoryConsumption::memory_consumption(
+          thread_boundary_color_row_index));
     }
 
 
@@ -1001,7 +1160,8 @@ namespace internal
       else
         {
           partition_row_index.resize(5);
-          const unsigned int comm_begin = batch_order.size() / 2;
+          const unsigned int comm_begin = static_cast<unsigned int>(
+            std::round(interior_fraction_before_ghosts * batch_order.size()));
           batch_order.insert(batch_order.begin() + comm_begin,
                              batch_order_comm.begin(),
                              batch_order_comm.end());
@@ -1079,8 +1239,18 @@ namespace internal
       unsigned int counter = 0;
       for (unsigned int block = 0; block < blocks.size() - 1; ++block)
         {
-          const unsigned int grain_size =
+          unsigned int grain_size =
             std::max((2048U / dofs_per_cell) / 8 * 4, 2U);
+
+          // when the chunks are distributed among threads in contiguous
+          // blocks, make sure there are several chunks per thread to find
+          // chunks without conflicts to other threads
+          if (scheme == contiguous_blocks)
+            grain_size = std::max(
+              std::min(grain_size,
+                       (blocks[block + 1] - blocks[block]) /
+                         (4 * MultithreadInfo::n_threads())),
+              1U);
           for (unsigned int k = blocks[block]; k < blocks[block + 1];
                k += grain_size)
             cell_partition_data.push_back(
@@ -2325,6 +2495,109 @@ namespace internal
     }
 
 
+    void
+    TaskInfo::make_contiguous_thread_blocks(
+      const DynamicSparsityPattern &connectivity,
+      const unsigned int            n_threads)
+    {
+      Assert(n_threads > 0, ExcInternalError());
+      const unsigned int n_parts  = partition_row_index.size() - 2;
+      const unsigned int n_chunks = partition_row_index[n_parts];
+      AssertDimension(connectivity.n_rows(), n_chunks);
+
+      // split the chunks of each part into blocks with a similar number of
+      // cell batches
+      n_thread_blocks = n_threads;
+      thread_block_partition_data.clear();
+      thread_block_partition_data.reserve(n_parts * (n_threads + 1));
+      std::vector<unsigned int> chunk_thread_block(n_chunks);
+      for (unsigned int part = 0; part < n_parts; ++part)
+        {
+          const unsigned int first_chunk = partition_row_index[part];
+          const unsigned int end_chunk   = partition_row_index[part + 1];
+          const unsigned int first_batch = cell_partition_data[first_chunk];
+          const std::size_t  n_batches =
+            cell_partition_data[end_chunk] - first_batch;
+          unsigned int chunk = first_chunk;
+          for (unsigned int t = 0; t < n_threads; ++t)
+            {
+              const std::size_t block_start =
+                first_batch + n_batches * t / n_threads;
+              while (chunk < end_chunk &&
+                     cell_partition_data[chunk] < block_start)
+                ++chunk;
+              thread_block_partition_data.push_back(chunk);
+            }
+          thread_block_partition_data.push_back(end_chunk);
+
+          const unsigned int *blocks =
+            thread_block_partition_data.data() + part * (n_threads + 1);
+          for (unsigned int t = 0; t < n_threads; ++t)
+            for (unsigned int i = blocks[t]; i < blocks[t + 1]; ++i)
+              chunk_thread_block[i] = t;
+        }
+
+      // identify the chunks with conflicts to other thread blocks
+      chunk_at_thread_boundary.clear();
+      chunk_at_thread_boundary.resize(n_chunks, 0);
+      for (unsigned int i = 0; i < n_chunks; ++i)
+        for (DynamicSparsityPattern::iterator it = connectivity.begin(i);
+             it != connectivity.end(i);
+             ++it)
+          if (chunk_thread_block[it->column()] != chunk_thread_block[i])
+            chunk_at_thread_boundary[i] = 1;
+
+      // color the chunks at the thread boundaries within each part with a
+      // greedy algorithm and sort them by colors
+      thread_boundary_chunks.clear();
+      thread_boundary_color_data.clear();
+      thread_boundary_color_data.push_back(0);
+      thread_boundary_color_row_index.clear();
+      thread_boundary_color_row_index.push_back(0);
+      std::vector<unsigned int> chunk_color(n_chunks,
+                                            numbers::invalid_unsigned_int);
+      std::vector<bool>         color_is_used;
+      for (unsigned int part = 0; part < n_parts; ++part)
+        {
+          unsigned int n_colors = 0;
+          for (unsigned int i = partition_row_index[part];
+               i < partition_row_index[part + 1];
+               ++i)
+            if (chunk_at_thread_boundary[i] != 0)
+              {
+                color_is_used.clear();
+                color_is_used.resize(n_colors + 1, false);
+                for (DynamicSparsityPattern::iterator it =
+                       connectivity.begin(i);
+                     it != connectivity.end(i);
+                     ++it)
+                  if (it->column() != i && chunk_color[it->column()] !=
+                                             numbers::invalid_unsigned_int)
+                    color_is_used[chunk_color[it->column()]] = true;
+                unsigned int color = 0;
+                while (color_is_used[color])
+                  ++color;
+                chunk_color[i] = color;
+                n_colors       = std::max(n_colors, color + 1);
+              }
+
+          for (unsigned int color = 0; color < n_colors; ++color)
+            {
+              for (unsigned int i = partition_row_index[part];
+                   i < partition_row_index[part + 1];
+                   ++i)
+                if (chunk_color[i] == color)
+                  thread_boundary_chunks.push_back(i);
+              thread_boundary_color_data.push_back(
+                thread_boundary_chunks.size());
+            }
+          thread_boundary_color_row_index.push_back(
+            thread_boundary_color_data.size() - 1);
+        }
+    }
+
+
+
     void
     TaskInfo::update_task_info(const unsigned int partition)
     {
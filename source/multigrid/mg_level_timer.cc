@@ -0,0 +1,146 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/multigrid/mg_level_timer.h>
+
+#include <algorithm>
+#include <iomanip>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+MGLevelTimer::~MGLevelTimer()
+{
+  disconnect();
+}
+
+
+
+void
+MGLevelTimer::disconnect()
+{
+  for (boost::signals2::connection &connection : connections)
+    connection.disconnect();
+  connections.clear();
+}
+
+
+
+void
+MGLevelTimer::reset()
+{
+  for (std::array<Timer, n_operations> &level_timers : timers)
+    for (Timer &timer : level_timers)
+      timer.reset();
+  std::fill(nested_wall_times.begin(), nested_wall_times.end(), 0.);
+}
+
+
+
+void
+MGLevelTimer::signal(const Operation    operation,
+                     const bool         before,
+                     const unsigned int level)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (level >= timers.size())
+    {
+      const unsigned int old_size = timers.size();
+      timers.resize(level + 1);
+      for (unsigned int l = old_size; l < timers.size(); ++l)
+        for (Timer &timer : timers[l])
+          timer.reset();
+      nested_wall_times.resize(level + 1, 0.);
+    }
+
+  Timer &timer = timers[level][static_cast<unsigned int>(operation)];
+  if (before)
+    timer.start();
+  else
+    {
+      timer.stop();
+      if (operation == Operation::residual &&
+          timers[level][static_cast<unsigned int>(Operation::pre_smoothing)]
+            .is_running())
+        nested_wall_times[level] += timer.last_wall_time();
+    }
+}
+
+
+
+double
+MGLevelTimer::get_wall_time(const unsigned int level,
+                            const Operation    operation) const
+{
+  if (level >= timers.size())
+    return 0.;
+  return timers[level][static_cast<unsigned int>(operation)].wall_time();
+}
+
+
+
+void
+MGLevelTimer::print_wall_time_statistics(const MPI_Comm comm,
+                                         std::ostream  &out) const
+{
+  static const std::array<const char *, n_operations> names = {
+    {"pre-smoothing",
+     "residual",
+     "restriction",
+     "coarse solve",
+     "prolongation",
+     "post-smoothing"}};
+
+  const bool print = Utilities::MPI::this_mpi_process(comm) == 0;
+
+  const unsigned int n_levels =
+    Utilities::MPI::max(static_cast<unsigned int>(timers.size()), comm);
+
+  if (print)
+    out << std::left << std::setw(8) << "level" << std::setw(16)
+        << "operation" << std::right << std::setw(12) << "min [s]"
+        << std::setw(12) << "avg [s]" << std::setw(12) << "max [s]"
+        << std::endl;
+
+  for (unsigned int level = 0; level < n_levels; ++level)
+    {
+      std::vector<double> times(n_operations + 1);
+      for (unsigned int op = 0; op < n_operations; ++op)
+        {
+          times[op] = get_wall_time(level, static_cast<Operation>(op));
+          times[n_operations] += times[op];
+        }
+      if (level < nested_wall_times.size())
+        times[n_operations] -= nested_wall_times[level];
+
+      const std::vector<Utilities::MPI::MinMaxAvg> statistics =
+        Utilities::MPI::min_max_avg(times, comm);
+
+      if (print && statistics[n_operations].max > 0.)
+        for (unsigned int op = 0; op <= n_operations; ++op)
+          if (statistics[op].max > 0.)
+            out << std::left << std::setw(8) << level << std::setw(16)
+                << (op < n_operations ? names[op] : "total")
+                << std::right << std::scientific << std::setprecision(3)
+                << std::setw(12) << statistics[op].min << std::setw(12)
+                << statistics[op].avg << std::setw(12) << statistics[op].max
+                << std::defaultfloat << std::endl;
+    }
+}
+
+
+DEAL_II_NAMESPACE_CLOSE
@@ -12,10 +12,21 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
 #include <deal.II/multigrid/mg_transfer_matrix_free.templates.h>
 
 DEAL_II_NAMESPACE_OPEN
 
+namespace MGTransferGlobalCoarseningTools
+{
+  void
+  clear_transfer_matrix_cache()
+  {
+    internal::TransferMatrixCache::clear();
+  }
+} // namespace MGTransferGlobalCoarseningTools
+
+
 #include "multigrid/mg_transfer_matrix_free.inst"
 
 DEAL_II_NAMESPACE_CLOSE
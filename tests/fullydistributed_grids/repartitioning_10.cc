@@ -0,0 +1,75 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test RepartitioningPolicyTools::AgglomerationPolicy in
+// MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence,
+// with the remaining processes packed at the beginning of the communicator
+// and spread over it.
+
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/distributed/repartitioning_policy_tools.h>
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const Triangulation<dim>                        &tria,
+     const RepartitioningPolicyTools::Base<dim, dim> &policy,
+     const std::string                               &label)
+{
+  const auto trias =
+    MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
+      tria, policy);
+
+  deallog.push(label);
+  for (unsigned int l = 0; l < trias.size(); ++l)
+    {
+      unsigned int n_locally_owned_cells = 0;
+      for (const auto &cell : trias[l]->active_cell_iterators())
+        if (cell->is_locally_owned())
+          ++n_locally_owned_cells;
+      deallog << "level " << l << ": " << n_locally_owned_cells << " of "
+              << trias[l]->n_global_active_cells() << " cells" << std::endl;
+    }
+  deallog.pop();
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  const unsigned int dim = 2;
+
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  test(tria, RepartitioningPolicyTools::AgglomerationPolicy<dim>(8), "packed");
+  test(tria,
+       RepartitioningPolicyTools::AgglomerationPolicy<dim>(8, true),
+       "spread");
+}
@@ -0,0 +1,154 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the functions in BatchedDenseKernels on VectorizedArray against
+// FullMatrix for symmetric positive definite matrices that differ between
+// the lanes
+
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/batched_dense_kernels.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <typename Number>
+void
+test(const unsigned int n)
+{
+  using VectorizedArrayType     = VectorizedArray<Number>;
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  std::vector<FullMatrix<Number>> matrices(n_lanes, FullMatrix<Number>(n, n));
+  Table<2, VectorizedArrayType>   matrix(n, n);
+  std::vector<VectorizedArrayType> rhs(n);
+  for (unsigned int v = 0; v < n_lanes; ++v)
+    {
+      // a random symmetric matrix with a dominant diagonal
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j <= i; ++j)
+          {
+            const Number entry = random_value<Number>() - Number(0.5);
+            matrices[v](i, j)  = entry;
+            matrices[v](j, i)  = entry;
+          }
+      for (unsigned int i = 0; i < n; ++i)
+        matrices[v](i, i) += Number(n);
+
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          for (unsigned int j = 0; j < n; ++j)
+            matrix(i, j)[v] = matrices[v](i, j);
+          rhs[i][v] = random_value<Number>();
+        }
+    }
+
+  // reference solutions and products per lane
+  std::vector<Vector<Number>> solutions(n_lanes, Vector<Number>(n));
+  std::vector<Vector<Number>> products(n_lanes, Vector<Number>(n));
+  for (unsigned int v = 0; v < n_lanes; ++v)
+    {
+      Vector<Number> b(n);
+      for (unsigned int i = 0; i < n; ++i)
+        b(i) = rhs[i][v];
+      matrices[v].vmult(products[v], b);
+      FullMatrix<Number> inverse(matrices[v]);
+      inverse.gauss_jordan();
+      inverse.vmult(solutions[v], b);
+    }
+
+  const auto max_error = [&](const std::vector<VectorizedArrayType> &result,
+                             const std::vector<Vector<Number>> &reference) {
+    Number error = 0.;
+    for (unsigned int v = 0; v < n_lanes; ++v)
+      for (unsigned int i = 0; i < n; ++i)
+        error = std::max(error, std::abs(result[i][v] - reference[v](i)) /
+                                  reference[v].linfty_norm());
+    return error;
+  };
+  const Number tolerance = 100. * n * std::numeric_limits<Number>::epsilon();
+  const auto   check     = [&](const std::string                      &name,
+                         const std::vector<VectorizedArrayType> &result,
+                         const std::vector<Vector<Number>>      &reference) {
+    deallog << name << " correct: "
+            << (max_error(result, reference) < tolerance ? "yes" : "no")
+            << std::endl;
+  };
+
+  std::vector<VectorizedArrayType> result(n);
+
+  BatchedDenseKernels::vmult(matrix,
+                             make_array_view(result),
+                             make_array_view(std::as_const(rhs)));
+  check("vmult", result, products);
+
+  BatchedDenseKernels::Tvmult(matrix,
+                              make_array_view(result),
+                              make_array_view(std::as_const(rhs)));
+  check("Tvmult", result, products);
+
+  for (auto &entry : result)
+    entry = Number();
+  BatchedDenseKernels::vmult_add(matrix,
+                                 make_array_view(result),
+                                 make_array_view(std::as_const(rhs)));
+  BatchedDenseKernels::vmult_add(matrix,
+                                 make_array_view(result),
+                                 make_array_view(std::as_const(rhs)));
+  for (auto &entry : result)
+    entry *= Number(0.5);
+  check("vmult_add", result, products);
+
+  Table<2, VectorizedArrayType> lu(matrix);
+  BatchedDenseKernels::lu_factorize(lu);
+  result = rhs;
+  BatchedDenseKernels::lu_solve(lu, make_array_view(result));
+  check("LU solve", result, solutions);
+
+  Table<2, VectorizedArrayType> cholesky(matrix);
+  BatchedDenseKernels::cholesky_factorize(cholesky);
+  result = rhs;
+  BatchedDenseKernels::cholesky_solve(cholesky, make_array_view(result));
+  check("Cholesky solve", result, solutions);
+
+  Table<2, VectorizedArrayType> inverse(matrix);
+  BatchedDenseKernels::invert(inverse);
+  BatchedDenseKernels::vmult(inverse,
+                             make_array_view(result),
+                             make_array_view(std::as_const(rhs)));
+  check("inverse", result, solutions);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (const unsigned int n : {1, 4, 9, 27})
+    {
+      deallog.push("n=" + std::to_string(n));
+      deallog.push("double");
+      test<double>(n);
+      deallog.pop();
+      deallog.push("float");
+      test<float>(n);
+      deallog.pop();
+      deallog.pop();
+    }
+}
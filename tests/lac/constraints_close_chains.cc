@@ -0,0 +1,139 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// test that AffineConstraints::close() resolves long chains of constraints
+// that are added in arbitrary order, merges the entries that appear on
+// several paths through the graph of constraints, and detects cycles also
+// when they are not reached from the first constraint.
+
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include "../tests.h"
+
+
+
+void
+test_chain()
+{
+  // a chain x_i = x_{i-1}/2 + 1 for i=1,...,1000, added in an order that
+  // is neither increasing nor decreasing, and a constraint that refers to
+  // two subsequent lines of the chain
+  const unsigned int        n = 1000;
+  AffineConstraints<double> constraints;
+  for (unsigned int k = 0; k < n; ++k)
+    {
+      const unsigned int i = 1 + (k * 367) % n;
+      constraints.add_line(i);
+      constraints.add_entry(i, i - 1, 0.5);
+      constraints.set_inhomogeneity(i, 1.);
+    }
+  constraints.add_line(n + 10);
+  constraints.add_entry(n + 10, 10, 0.5);
+  constraints.add_entry(n + 10, 11, 0.5);
+  constraints.close();
+
+  // all lines must only refer to x_0 with the correct weight and
+  // inhomogeneity
+  double max_error = 0.;
+  for (unsigned int i = 1; i <= n; ++i)
+    {
+      const auto &entries = *constraints.get_constraint_entries(i);
+      AssertDimension(entries.size(), 1);
+      AssertDimension(entries[0].first, 0);
+      max_error =
+        std::max(max_error, std::abs(entries[0].second - std::pow(0.5, i)));
+      max_error =
+        std::max(max_error,
+                 std::abs(constraints.get_inhomogeneity(i) -
+                          (2. - 2. * std::pow(0.5, i))));
+    }
+  deallog << "Error of chain: " << (max_error < 1e-12 ? "zero" : "nonzero")
+          << std::endl;
+
+  const auto &entries = *constraints.get_constraint_entries(n + 10);
+  deallog << "Entries of line " << n + 10 << ": " << entries.size()
+          << ", weight " << entries[0].second / std::pow(0.5, 10)
+          << ", inhomogeneity " << constraints.get_inhomogeneity(n + 10)
+          << std::endl;
+}
+
+
+
+void
+test_diamond()
+{
+  // the graph 10 -> {11, 12} -> 13 -> 14, where 13 is reached on two paths
+  AffineConstraints<double> constraints;
+  constraints.add_line(13);
+  constraints.add_entry(13, 14, 2.);
+  constraints.add_line(10);
+  constraints.add_entry(10, 11, 0.5);
+  constraints.add_entry(10, 12, 0.5);
+  constraints.add_entry(10, 15, 1.);
+  constraints.add_line(11);
+  constraints.add_entry(11, 13, 1.);
+  constraints.add_line(12);
+  constraints.add_entry(12, 13, 1.);
+  constraints.add_entry(12, 16, 3.);
+  constraints.set_inhomogeneity(12, 4.);
+  constraints.close();
+
+  constraints.print(deallog.get_file_stream());
+}
+
+
+
+void
+test_cycle()
+{
+  // a cycle 3 -> 5 -> 4 -> 3 that is reached from line 2, and line 1 that
+  // refers to line 2
+  AffineConstraints<double> constraints;
+  constraints.add_line(1);
+  constraints.add_entry(1, 2, 1.);
+  constraints.add_line(2);
+  constraints.add_entry(2, 3, 1.);
+  constraints.add_entry(2, 0, 1.);
+  constraints.add_line(3);
+  constraints.add_entry(3, 5, 1.);
+  constraints.add_line(4);
+  constraints.add_entry(4, 3, 1.);
+  constraints.add_line(5);
+  constraints.add_entry(5, 4, 1.);
+
+  try
+    {
+      constraints.close();
+    }
+  catch (ExceptionBase &e)
+    {
+      deallog << e.get_exc_name() << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deal_II_exceptions::disable_abort_on_exception();
+
+  test_chain();
+  test_diamond();
+  test_cycle();
+}
@@ -0,0 +1,82 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// same as gmres_reorthogonalize_05 but with the classical Gram-Schmidt
+// method, whose reorthogonalization step must only subtract the projection
+// coefficients of the second pass. Check that the solution satisfies the
+// tolerance not only in the residual estimate of GMRES, but also in the
+// true residual.
+
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+
+template <typename number>
+void
+test()
+{
+  const unsigned int n = 200;
+  Vector<number>     rhs(n), sol(n);
+  rhs = 1.;
+
+  // only add diagonal entries
+  SparsityPattern sp(n, n);
+  sp.compress();
+  SparseMatrix<number> matrix(sp);
+
+  for (unsigned int i = 0; i < n; ++i)
+    matrix.diag_element(i) = (i + 1);
+
+  const double  tolerance = 1e3 * std::numeric_limits<number>::epsilon();
+  SolverControl control(1000, tolerance);
+  typename SolverGMRES<Vector<number>>::AdditionalData data;
+  data.max_basis_size             = 200;
+  data.force_re_orthogonalization = true;
+  data.orthogonalization_strategy =
+    LinearAlgebra::OrthogonalizationStrategy::classical_gram_schmidt;
+
+  SolverGMRES<Vector<number>> solver(control, data);
+  auto print_re_orthogonalization = [](int accumulated_iterations) {
+    deallog.get_file_stream() << "Re-orthogonalization enabled at step "
+                              << accumulated_iterations << std::endl;
+  };
+  solver.connect_re_orthogonalization_slot(print_re_orthogonalization);
+  solver.solve(matrix, sol, rhs, PreconditionIdentity());
+
+  Vector<number> residual(n);
+  matrix.residual(residual, sol, rhs);
+  deallog << "True residual "
+          << (residual.l2_norm() < 10. * tolerance ? "below" : "above")
+          << " tolerance" << std::endl;
+}
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(3);
+
+  deallog.push("double");
+  test<double>();
+  deallog.pop();
+  deallog.push("float");
+  test<float>();
+  deallog.pop();
+}
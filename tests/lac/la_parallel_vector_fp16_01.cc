@@ -0,0 +1,118 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check LinearAlgebra::distributed::Vector with the 16-bit floating point
+// type _Float16 as storage type: conversion from and to single and double
+// precision vectors, and reductions that are accumulated in single precision
+// and thus neither overflow nor lose accuracy for long vectors.
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  using HalfVector = LinearAlgebra::distributed::Vector<_Float16>;
+
+  const unsigned int n = 100000;
+
+  LinearAlgebra::distributed::Vector<double> v_double(n);
+  for (unsigned int i = 0; i < n; ++i)
+    v_double(i) = std::sin(0.001 * i);
+
+  // conversion with the relative accuracy of half precision
+  HalfVector v;
+  v.reinit(v_double, true);
+  v.copy_locally_owned_data_from(v_double);
+  LinearAlgebra::distributed::Vector<float> v_float;
+  v_float.reinit(v, true);
+  v_float.copy_locally_owned_data_from(v);
+  double max_error = 0;
+  for (unsigned int i = 0; i < n; ++i)
+    max_error = std::max(max_error,
+                         std::abs(v_float(i) - v_double(i)) /
+                           std::max(std::abs(v_double(i)), 1e-3));
+  deallog << "Conversion error "
+          << (max_error <= 1. / 2048 ? "within" : "beyond")
+          << " half precision" << std::endl;
+
+  HalfVector w;
+  w = v_float;
+  w -= v;
+  deallog << "Difference after assignment: " << w.linfty_norm() << std::endl;
+
+  // a sum of all ones would overflow at 65504 if accumulated in half
+  // precision, and the sum of the small entries of the inner product would
+  // stagnate
+  HalfVector ones(n);
+  ones = _Float16(1.f);
+  deallog << "Mean value: " << static_cast<float>(ones.mean_value())
+          << std::endl;
+  deallog << "l1 norm: " << ones.l1_norm() << std::endl;
+  deallog << "l2 norm: " << ones.l2_norm() << std::endl;
+  HalfVector sixteenth(n);
+  sixteenth = _Float16(0.0625f);
+  deallog << "Inner product: " << static_cast<float>(ones * sixteenth)
+          << std::endl;
+
+  // inner products of rounded numbers are computed with single precision
+  // accuracy
+  const double reference = v_float * v_float;
+  deallog << "Inner product error "
+          << (std::abs(static_cast<float>(v * v) - reference) <
+                  1e-3 * reference ?
+                "within" :
+                "beyond")
+          << " half precision" << std::endl;
+  deallog << "Norm error "
+          << (std::abs(v.l2_norm() - v_float.l2_norm()) <
+                  1e-5 * v_float.l2_norm() ?
+                "within" :
+                "beyond")
+          << " single precision" << std::endl;
+
+  w = _Float16(0.f);
+  const float  add_and_dot = w.add_and_dot(_Float16(2.f), ones, v);
+  const double add_and_dot_reference = 2. * v_float.mean_value() * n;
+  deallog << "add_and_dot error "
+          << (std::abs(add_and_dot - add_and_dot_reference) <
+                  1e-3 * add_and_dot_reference ?
+                "within" :
+                "beyond")
+          << " half precision" << std::endl;
+  deallog << "Entries after add_and_dot: " << w.linfty_norm() << std::endl;
+
+  // results beyond the largest number representable in half precision are
+  // returned in single precision
+  HalfVector twos(n);
+  twos = _Float16(2.f);
+  deallog << "Inner product beyond half range: " << ones * twos << std::endl;
+  w = _Float16(0.f);
+  deallog << "add_and_dot beyond half range: "
+          << w.add_and_dot(_Float16(1.f), ones, twos) << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  test();
+}
@@ -0,0 +1,91 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the smoothed-aggregation algebraic multigrid PreconditionAMG as a
+// preconditioner for the conjugate gradient method on the five-point
+// Laplacian with both smoothers. The number of iterations should stay
+// bounded as the mesh is refined. When the maximal number of levels stops
+// the coarsening far above the coarse size, the smoother is applied on the
+// coarsest level instead of a dense inverse.
+
+#include <deal.II/lac/precondition_amg.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+void
+test(const unsigned int                  size,
+     const PreconditionAMG::SmootherType smoother,
+     const unsigned int                  max_levels = 20)
+{
+  const unsigned int dim = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+
+  PreconditionAMG::AdditionalData data;
+  data.smoother_type = smoother;
+  data.max_levels    = max_levels;
+  PreconditionAMG amg;
+  amg.initialize(A, data);
+
+  deallog << "Size " << size << " Unknowns " << dim << " levels "
+          << amg.n_levels() << ":";
+  for (unsigned int level = 0; level < amg.n_levels(); ++level)
+    deallog << ' ' << amg.m(level);
+  deallog << std::endl;
+
+  Vector<double> f(dim);
+  Vector<double> u(dim);
+  f = 1.;
+
+  SolverControl            control(1000, 1e-8 * f.l2_norm());
+  SolverCG<Vector<double>> solver(control);
+  solver.solve(A, u, f, amg);
+
+  deallog << (smoother == PreconditionAMG::SmootherType::chebyshev ?
+                "Chebyshev" :
+                "Jacobi")
+          << " smoother: converged in " << control.last_step() << " steps"
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog.depth_file(1);
+
+  for (const auto smoother : {PreconditionAMG::SmootherType::chebyshev,
+                              PreconditionAMG::SmootherType::jacobi})
+    for (unsigned int size = 16; size <= 128; size *= 2)
+      test(size, smoother);
+
+  // two levels with 2720 unknowns on the coarser one, where the smoother
+  // replaces the dense inverse
+  test(128, PreconditionAMG::SmootherType::chebyshev, 2);
+}
@@ -0,0 +1,183 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test the multicolored variants of the SOR and SSOR methods of SparseMatrix
+// and their use in PreconditionSOR and PreconditionSSOR: The coloring must
+// not contain coupled rows of the same color, multicolored SOR must coincide
+// with PSOR applied in the ordering of the colors, and multicolored SSOR must
+// be symmetric and usable within CG.
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_tools.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+void
+test(const unsigned int size, const bool nonsymmetric)
+{
+  const unsigned int dim = (size - 1) * (size - 1);
+
+  deallog << "Size " << size << " Unknowns " << dim
+          << (nonsymmetric ? " nonsymmetric" : "") << std::endl;
+
+  // for the nonsymmetric case, add couplings to the second next row that are
+  // not present in the transpose
+  FDMatrix               testproblem(size, size);
+  DynamicSparsityPattern dsp(dim, dim);
+  testproblem.nine_point_structure(dsp);
+  if (nonsymmetric)
+    for (unsigned int row = 0; row + 2 < dim; ++row)
+      dsp.add(row, row + 2);
+  SparsityPattern structure;
+  structure.copy_from(dsp);
+  SparseMatrix<double> A(structure);
+  testproblem.nine_point(A);
+  if (nonsymmetric)
+    for (unsigned int row = 0; row + 2 < dim; ++row)
+      A.add(row, row + 2, -0.5);
+
+  const std::vector<std::vector<types::global_dof_index>> colored_rows =
+    SparsityTools::make_greedy_coloring(structure);
+  deallog << "Number of colors: " << colored_rows.size() << std::endl;
+
+  // check that all rows are colored exactly once and that no two rows of the
+  // same color are coupled
+  std::vector<unsigned int> row_color(dim, numbers::invalid_unsigned_int);
+  for (unsigned int c = 0; c < colored_rows.size(); ++c)
+    for (const auto row : colored_rows[c])
+      {
+        AssertThrow(row_color[row] == numbers::invalid_unsigned_int,
+                    ExcInternalError());
+        row_color[row] = c;
+      }
+  for (unsigned int row = 0; row < dim; ++row)
+    for (auto it = structure.begin(row); it != structure.end(row); ++it)
+      if (it->column() != row)
+        AssertThrow(row_color[row] != row_color[it->column()],
+                    ExcInternalError());
+
+  // compare with permuted SOR in the ordering given by the colors
+  std::vector<types::global_dof_index> permutation, inverse_permutation(dim);
+  for (const auto &rows : colored_rows)
+    permutation.insert(permutation.end(), rows.begin(), rows.end());
+  for (unsigned int i = 0; i < dim; ++i)
+    inverse_permutation[permutation[i]] = i;
+
+  Vector<double> src(dim), dst(dim), reference(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    src(i) = random_value<double>();
+
+  A.precondition_SOR(dst, src, 1.2, colored_rows);
+  reference = src;
+  A.PSOR(reference, permutation, inverse_permutation, 1.2);
+  reference -= dst;
+  deallog << "SOR diff:  " << reference.l2_norm() << std::endl;
+
+  A.precondition_TSOR(dst, src, 1.2, colored_rows);
+  reference = src;
+  A.TPSOR(reference, permutation, inverse_permutation, 1.2);
+  reference -= dst;
+  deallog << "TSOR diff: " << reference.l2_norm() << std::endl;
+
+  // SSOR is a symmetric operator for symmetric matrices
+  if (!nonsymmetric)
+    {
+      Vector<double> src2(dim), dst2(dim);
+      for (unsigned int i = 0; i < dim; ++i)
+        src2(i) = random_value<double>();
+      A.precondition_SSOR(dst, src, 1.2, colored_rows);
+      A.precondition_SSOR(dst2, src2, 1.2, colored_rows);
+      deallog << "SSOR symmetry: "
+              << std::abs(dst * src2 - dst2 * src) / std::abs(dst * src2)
+              << std::endl;
+    }
+
+  Vector<double> f(dim), u(dim);
+  f = 1.;
+
+  PreconditionSOR<>::AdditionalData sor_data(1.2);
+  sor_data.use_multicoloring = true;
+  PreconditionSOR<> sor;
+  sor.initialize(A, sor_data);
+
+  PreconditionSSOR<>::AdditionalData ssor_data(1.2);
+  ssor_data.use_multicoloring = true;
+  PreconditionSSOR<> ssor;
+  ssor.initialize(A, ssor_data);
+
+  SolverControl control(200, 1e-8);
+  if (nonsymmetric)
+    {
+      SolverGMRES<Vector<double>> solver(control);
+      u = 0.;
+      check_solver_within_range(solver.solve(A, u, f, sor),
+                                control.last_step(),
+                                1,
+                                200);
+      u = 0.;
+      check_solver_within_range(solver.solve(A, u, f, ssor),
+                                control.last_step(),
+                                1,
+                                200);
+    }
+  else
+    {
+      SolverCG<Vector<double>> solver(control);
+      u = 0.;
+      check_solver_within_range(solver.solve(A, u, f, ssor),
+                                control.last_step(),
+                                1,
+                                200);
+    }
+
+  // multiple relaxation steps go through SOR_step and SSOR_step
+  sor_data.n_iterations  = 3;
+  ssor_data.n_iterations = 3;
+  sor.initialize(A, sor_data);
+  ssor.initialize(A, ssor_data);
+
+  Vector<double> residual(dim);
+  sor.vmult(u, f);
+  A.residual(residual, u, f);
+  deallog << "Residual after 3 SOR steps:  " << residual.l2_norm()
+          << std::endl;
+  ssor.vmult(u, f);
+  A.residual(residual, u, f);
+  deallog << "Residual after 3 SSOR steps: " << residual.l2_norm()
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(4);
+
+  test(8, false);
+  test(8, true);
+  test(33, false);
+  test(33, true);
+}
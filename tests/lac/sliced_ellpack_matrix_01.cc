@@ -0,0 +1,140 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the matrix-vector products of SlicedEllpackMatrix against the ones of
+// SparseMatrix, for a finite difference matrix and for a rectangular matrix
+// with rows of very different length, including empty rows.
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sliced_ellpack_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename number>
+void
+check(const SparseMatrix<number> &A, const unsigned int sorting_scope)
+{
+  SlicedEllpackMatrix<number> B(A, sorting_scope);
+  AssertDimension(B.m(), A.m());
+  AssertDimension(B.n(), A.n());
+  AssertDimension(B.n_nonzero_elements(), A.n_nonzero_elements());
+  AssertThrow(B.n_stored_elements() >= B.n_nonzero_elements(),
+              ExcInternalError());
+
+  Vector<number> src(A.n()), dst(A.m()), ref(A.m());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<number>();
+
+  const number tolerance = 100 * std::numeric_limits<number>::epsilon();
+
+  A.vmult(ref, src);
+  B.vmult(dst, src);
+  dst -= ref;
+  deallog << "vmult:      "
+          << (dst.linfty_norm() <= tolerance * ref.linfty_norm() ? "OK" :
+                                                                   "Error")
+          << std::endl;
+
+  dst = 1.;
+  ref = 1.;
+  A.vmult_add(ref, src);
+  B.vmult_add(dst, src);
+  dst -= ref;
+  deallog << "vmult_add:  "
+          << (dst.linfty_norm() <= tolerance * ref.linfty_norm() ? "OK" :
+                                                                   "Error")
+          << std::endl;
+
+  Vector<number> tsrc(A.m()), tdst(A.n()), tref(A.n());
+  for (unsigned int i = 0; i < tsrc.size(); ++i)
+    tsrc(i) = random_value<number>();
+
+  A.Tvmult(tref, tsrc);
+  B.Tvmult(tdst, tsrc);
+  tdst -= tref;
+  deallog << "Tvmult:     "
+          << (tdst.linfty_norm() <= tolerance * tref.linfty_norm() ? "OK" :
+                                                                     "Error")
+          << std::endl;
+
+  tdst = 1.;
+  tref = 1.;
+  A.Tvmult_add(tref, tsrc);
+  B.Tvmult_add(tdst, tsrc);
+  tdst -= tref;
+  deallog << "Tvmult_add: "
+          << (tdst.linfty_norm() <= tolerance * tref.linfty_norm() ? "OK" :
+                                                                     "Error")
+          << std::endl;
+}
+
+
+
+template <typename number>
+void
+test()
+{
+  {
+    deallog << "Five-point matrix" << std::endl;
+    FDMatrix             testproblem(20, 20);
+    SparsityPattern      structure(19 * 19, 19 * 19, 5);
+    SparseMatrix<number> A;
+    testproblem.five_point_structure(structure);
+    structure.compress();
+    A.reinit(structure);
+    testproblem.five_point(A);
+    check(A, 1);
+    check(A, 256);
+  }
+
+  {
+    deallog << "Rectangular matrix" << std::endl;
+    const unsigned int     m = 103, n = 71;
+    DynamicSparsityPattern dsp(m, n);
+    for (unsigned int i = 0; i < m; ++i)
+      for (unsigned int j = 0; j < i % 13; ++j)
+        dsp.add(i, (7 * i + 11 * j) % n);
+    SparsityPattern structure;
+    structure.copy_from(dsp);
+    SparseMatrix<number> A(structure);
+    for (unsigned int i = 0; i < m; ++i)
+      for (auto entry = A.begin(i); entry != A.end(i); ++entry)
+        entry->value() = random_value<number>();
+    check(A, 1);
+    check(A, 16);
+    check(A, 1000);
+  }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("double");
+  test<double>();
+  deallog.pop();
+
+  deallog.push("float");
+  test<float>();
+  deallog.pop();
+}
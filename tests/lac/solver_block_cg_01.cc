@@ -0,0 +1,111 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that SolverBlockCG gives the same solutions and the same number of
+// iterations as SolverCG applied to each right hand side separately, both
+// with SparseMatrix::multi_vmult and with a preconditioner that is applied
+// block by block.
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_block_cg.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename BlockVectorType, typename PreconditionerType>
+void
+test(const SparseMatrix<double> &A,
+     const PreconditionerType   &preconditioner,
+     const unsigned int          n_rhs)
+{
+  using VectorType = typename BlockVectorType::BlockType;
+
+  BlockVectorType b(n_rhs, A.m()), x(n_rhs, A.m());
+  for (unsigned int i = 0; i < n_rhs; ++i)
+    for (unsigned int j = 0; j < A.m(); ++j)
+      b.block(i)(j) = random_value<double>();
+
+  SolverControl                  control(1000, 1e-10);
+  SolverBlockCG<BlockVectorType> solver(control);
+  solver.solve(A, x, b, preconditioner);
+  const unsigned int block_iterations = control.last_step();
+
+  unsigned int max_iterations = 0;
+  double       max_difference = 0;
+  for (unsigned int i = 0; i < n_rhs; ++i)
+    {
+      VectorType           y(A.m());
+      SolverControl        single_control(1000, 1e-10);
+      SolverCG<VectorType> cg(single_control);
+      cg.solve(A, y, b.block(i), preconditioner);
+      max_iterations = std::max(max_iterations, single_control.last_step());
+
+      y -= x.block(i);
+      max_difference =
+        std::max(max_difference, y.linfty_norm() / x.block(i).linfty_norm());
+    }
+
+  deallog << "Number of right hand sides " << n_rhs << ": iterations "
+          << (block_iterations + 1 >= max_iterations &&
+                  block_iterations <= max_iterations + 1 ?
+                "match" :
+                "differ")
+          << ", solutions " << (max_difference < 1e-6 ? "match" : "differ")
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+  deallog.depth_file(2);
+
+  const unsigned int size = 32;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+
+  PreconditionIdentity identity;
+  PreconditionSSOR<>   ssor;
+  ssor.initialize(A, 1.2);
+
+  deallog.push("BlockVector");
+  for (const unsigned int n_rhs : {1, 4})
+    {
+      test<BlockVector<double>>(A, identity, n_rhs);
+      test<BlockVector<double>>(A, ssor, n_rhs);
+    }
+  deallog.pop();
+
+  deallog.push("LinearAlgebra::distributed::BlockVector");
+  test<LinearAlgebra::distributed::BlockVector<double>>(A, identity, 3);
+  deallog.pop();
+}
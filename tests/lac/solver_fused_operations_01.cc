@@ -0,0 +1,139 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the conjugate gradient, BiCGStab, and MinRes solvers give the
+// same iteration counts and solutions with the fused vector operations used
+// for LinearAlgebra::distributed::Vector as with the separate vector
+// operations used for Vector<double>.
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_bicgstab.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_minres.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+// Run the solvers with vectors of type VectorType and return the number of
+// iterations and the solution for each of them
+template <typename VectorType>
+std::vector<std::pair<unsigned int, Vector<double>>>
+run_solvers(const SparseMatrix<double> &A, const SparseMatrix<double> &A_upwind)
+{
+  std::vector<std::pair<unsigned int, Vector<double>>> results;
+
+  VectorType b(A.m()), x(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    b(i) = std::sin(0.1 * i) + 0.5;
+
+  DiagonalMatrix<VectorType> preconditioner;
+  preconditioner.get_vector().reinit(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    preconditioner.get_vector()(i) = 1. / A.diag_element(i);
+
+  const auto store_result = [&](const SolverControl &control) {
+    Vector<double> solution(A.m());
+    for (unsigned int i = 0; i < A.m(); ++i)
+      solution(i) = x(i);
+    results.emplace_back(control.last_step(), solution);
+    x = 0.;
+  };
+
+  SolverControl control(1000, 1e-10 * b.l2_norm());
+  {
+    SolverCG<VectorType> solver(control);
+    solver.solve(A, x, b, PreconditionIdentity());
+    store_result(control);
+    solver.solve(A, x, b, preconditioner);
+    store_result(control);
+  }
+  {
+    SolverFlexibleCG<VectorType> solver(control);
+    solver.solve(A, x, b, preconditioner);
+    store_result(control);
+  }
+  {
+    SolverBicgstab<VectorType> solver(control);
+    solver.solve(A_upwind, x, b, preconditioner);
+    store_result(control);
+  }
+  {
+    SolverBicgstab<VectorType> solver(
+      control, typename SolverBicgstab<VectorType>::AdditionalData(false));
+    solver.solve(A_upwind, x, b, preconditioner);
+    store_result(control);
+  }
+  {
+    SolverMinRes<VectorType> solver(control);
+    solver.solve(A, x, b, preconditioner);
+    store_result(control);
+  }
+
+  return results;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 2);
+  initlog();
+
+  const unsigned int size = 32;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+  SparseMatrix<double> A_upwind(structure);
+  testproblem.upwind(A_upwind, true);
+  A_upwind.add(1., A);
+
+  const auto results = run_solvers<Vector<double>>(A, A_upwind);
+  const auto results_fused =
+    run_solvers<LinearAlgebra::distributed::Vector<double>>(A, A_upwind);
+
+  const std::vector<std::string> names = {"CG",
+                                          "CG with Jacobi",
+                                          "Flexible CG with Jacobi",
+                                          "BiCGStab with Jacobi",
+                                          "BiCGStab with implicit residual",
+                                          "MinRes with Jacobi"};
+  for (unsigned int i = 0; i < names.size(); ++i)
+    {
+      Vector<double> difference = results[i].second;
+      difference -= results_fused[i].second;
+      deallog << names[i] << ": iterations "
+              << (results[i].first == results_fused[i].first ? "match" :
+                                                                 "differ")
+              << ", solutions "
+              << (difference.linfty_norm() <
+                      1e-8 * results[i].second.linfty_norm() ?
+                    "match" :
+                    "differ")
+              << std::endl;
+    }
+}
@@ -0,0 +1,113 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the solvers with fused vector operations keep the ghost values
+// of a solution vector in ghosted state up to date, like the separate
+// vector operations do.
+
+#include <deal.II/base/index_set.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_bicgstab.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_minres.h>
+
+#include "../tests.h"
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+// compare the ghost values of x with the values of the owning processes
+void
+check_ghost_values(const std::string &name, const VectorType &x)
+{
+  VectorType reference(x);
+  reference.update_ghost_values();
+
+  const IndexSet &ghosts     = x.get_partitioner()->ghost_indices();
+  double          difference = 0.;
+  for (const auto i : ghosts)
+    difference = std::max(difference, std::abs(x(i) - reference(i)));
+  difference = Utilities::MPI::max(difference, MPI_COMM_WORLD);
+
+  deallog << name << ": "
+          << (x.has_ghost_elements() ? "ghosted" : "not ghosted")
+          << ", ghost values "
+          << (difference == 0. ? "up to date" : "outdated") << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  const unsigned int my_id = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int n_procs =
+    Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  // each process owns 50 entries and ghosts the first two entries of the
+  // next process
+  const unsigned int n_local = 50;
+  IndexSet           owned(n_procs * n_local);
+  owned.add_range(my_id * n_local, (my_id + 1) * n_local);
+  IndexSet ghosted(n_procs * n_local);
+  ghosted.add_range(((my_id + 1) % n_procs) * n_local,
+                    ((my_id + 1) % n_procs) * n_local + 2);
+
+  VectorType b(owned, ghosted, MPI_COMM_WORLD), x(b);
+  DiagonalMatrix<VectorType> matrix, preconditioner;
+  matrix.get_vector().reinit(b);
+  preconditioner.get_vector().reinit(b);
+  for (const auto i : owned)
+    {
+      matrix.get_vector()(i)         = 1. + 0.1 * i;
+      preconditioner.get_vector()(i) = 1. / (1. + 0.05 * i);
+      b(i)                           = std::sin(0.1 * i) + 0.5;
+    }
+
+  SolverControl control(1000, 1e-10 * b.l2_norm());
+
+  const auto run = [&](const std::string &name, auto &solver) {
+    x = 0.;
+    x.update_ghost_values();
+    solver.solve(matrix, x, b, preconditioner);
+    check_ghost_values(name, x);
+  };
+
+  {
+    SolverCG<VectorType> solver(control);
+    run("CG", solver);
+  }
+  {
+    SolverFlexibleCG<VectorType> solver(control);
+    run("Flexible CG", solver);
+  }
+  {
+    SolverBicgstab<VectorType> solver(
+      control, SolverBicgstab<VectorType>::AdditionalData(false));
+    run("BiCGStab with implicit residual", solver);
+  }
+  {
+    SolverMinRes<VectorType> solver(control);
+    run("MinRes", solver);
+  }
+}
@@ -0,0 +1,176 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that SolverGMRES with the s-step variant of the Arnoldi process
+// (LinearAlgebra::OrthogonalizationStrategy::
+// s_step_block_classical_gram_schmidt) computes the same solution as the
+// standard variant with about the same number of iterations, for left and
+// right preconditioning, with restarts, and for vector types with and
+// without the optimized inner products. A tridiagonal matrix with
+// dominating convection has complex eigenvalues, which checks the Newton
+// basis with complex-conjugate shifts. Also print the number of blocks
+// that were orthogonalized by the s-step variant and of those that were
+// rank deficient and replaced by steps of the classical variant.
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename VectorType>
+void
+initialize_vector(VectorType &vector, const unsigned int size)
+{
+  vector.reinit(size);
+}
+
+
+
+void
+initialize_vector(BlockVector<double> &vector, const unsigned int size)
+{
+  vector.reinit(1, size);
+}
+
+
+
+template <typename VectorType, typename PreconditionerType>
+void
+test(const SparseMatrix<double> &A,
+     const PreconditionerType   &preconditioner,
+     const bool                  right_preconditioning,
+     const unsigned int          max_basis_size,
+     const unsigned int          s_step_size)
+{
+  VectorType b, x, y;
+  initialize_vector(b, A.m());
+  initialize_vector(x, A.m());
+  initialize_vector(y, A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    b(i) = random_value<double>();
+
+  typename SolverGMRES<VectorType>::AdditionalData data;
+  data.max_basis_size        = max_basis_size;
+  data.right_preconditioning = right_preconditioning;
+
+  SolverControl control(1000, 1e-10);
+  data.orthogonalization_strategy = LinearAlgebra::OrthogonalizationStrategy::
+    s_step_block_classical_gram_schmidt;
+  data.s_step_size = s_step_size;
+  SolverGMRES<VectorType> solver(control, data);
+  unsigned int            n_blocks = 0, n_rank_deficient_blocks = 0;
+  solver.connect_s_step_blocks_slot(
+    [&](const unsigned int n_s_step_blocks, const unsigned int n_deficient) {
+      n_blocks                = n_s_step_blocks;
+      n_rank_deficient_blocks = n_deficient;
+    });
+  solver.solve(A, x, b, preconditioner);
+
+  SolverControl reference_control(1000, 1e-10);
+  data.orthogonalization_strategy =
+    LinearAlgebra::OrthogonalizationStrategy::classical_gram_schmidt;
+  SolverGMRES<VectorType> reference_solver(reference_control, data);
+  reference_solver.solve(A, y, b, preconditioner);
+
+  y -= x;
+  deallog << "Basis size " << max_basis_size << ", s = " << s_step_size
+          << (right_preconditioning ? ", right" : ", left")
+          << " preconditioning: iterations "
+          << (control.last_step() <= reference_control.last_step() + 2 &&
+                  control.last_step() + 2 >= reference_control.last_step() ?
+                "match" :
+                "differ")
+          << ", solutions "
+          << (y.linfty_norm() < 1e-6 * x.linfty_norm() ? "match" : "differ")
+          << ", s-step blocks " << n_blocks << ", rank deficient blocks "
+          << n_rank_deficient_blocks << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+  deallog.depth_file(2);
+
+  const unsigned int size = 32;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A, true);
+
+  PreconditionIdentity identity;
+  PreconditionSSOR<>   ssor;
+  ssor.initialize(A, 1.2);
+
+  deallog.push("Vector");
+  for (const unsigned int s : {2, 5, 8})
+    {
+      test<Vector<double>>(A, identity, false, 200, s);
+      test<Vector<double>>(A, ssor, false, 30, s);
+      test<Vector<double>>(A, ssor, true, 30, s);
+    }
+  test<Vector<double>>(A, identity, false, 30, 7);
+  deallog.pop();
+
+  deallog.push("BlockVector");
+  test<BlockVector<double>>(A, identity, false, 200, 5);
+  deallog.pop();
+
+  deallog.push("LinearAlgebra::distributed::Vector");
+  test<LinearAlgebra::distributed::Vector<double>>(A, identity, false, 200, 5);
+  test<LinearAlgebra::distributed::Vector<double>>(A, identity, true, 30, 5);
+  deallog.pop();
+
+  // the eigenvalues 2 + 2 sqrt(3) i cos(k pi / (n + 1)) of this matrix are
+  // complex
+  const unsigned int     n = 200;
+  DynamicSparsityPattern dsp(n, n);
+  for (unsigned int i = 0; i < n; ++i)
+    for (unsigned int j = (i > 0 ? i - 1 : 0); j < std::min(i + 2, n); ++j)
+      dsp.add(i, j);
+  SparsityPattern convection_structure;
+  convection_structure.copy_from(dsp);
+  SparseMatrix<double> convection(convection_structure);
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      convection.set(i, i, 2.);
+      if (i > 0)
+        convection.set(i, i - 1, -3.);
+      if (i + 1 < n)
+        convection.set(i, i + 1, 1.);
+    }
+
+  deallog.push("Convection");
+  for (const unsigned int s : {2, 5, 8})
+    test<Vector<double>>(convection, identity, false, 200, s);
+  test<Vector<double>>(convection, identity, false, 30, 6);
+  deallog.pop();
+}
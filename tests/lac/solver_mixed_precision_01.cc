@@ -0,0 +1,123 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check SolverMixedPrecision with an inner conjugate gradient solver in
+// single precision, both for iterative refinement and the flexible GMRES
+// outer iteration: the solution must be accurate beyond the precision of
+// float.
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_mixed_precision.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+// An inner solver that runs a few conjugate gradient iterations in single
+// precision
+template <typename VectorType>
+class InnerSolver
+{
+public:
+  InnerSolver(const SparseMatrix<float> &matrix)
+    : matrix(matrix)
+  {}
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    ReductionControl     control(100, 0., 1e-2);
+    SolverCG<VectorType> solver(control);
+    dst = 0.f;
+    solver.solve(matrix, dst, src, PreconditionIdentity());
+  }
+
+private:
+  const SparseMatrix<float> &matrix;
+};
+
+
+
+template <typename VectorType, typename InnerVectorType>
+void
+test(const SparseMatrix<double> &A,
+     const SparseMatrix<float>  &A_float,
+     const unsigned int          max_basis_size)
+{
+  VectorType b(A.m()), x(A.m()), y(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    b(i) = random_value<double>();
+
+  SolverControl control(100, 1e-12 * b.l2_norm());
+  SolverMixedPrecision<VectorType, InnerVectorType> solver(
+    control,
+    typename SolverMixedPrecision<VectorType, InnerVectorType>::AdditionalData(
+      max_basis_size));
+  check_solver_within_range(solver.solve(A,
+                                         x,
+                                         b,
+                                         InnerSolver<InnerVectorType>(A_float)),
+                            control.last_step(),
+                            3,
+                            12);
+
+  SolverControl        cg_control(1000, 1e-12 * b.l2_norm());
+  SolverCG<VectorType> cg(cg_control);
+  cg.solve(A, y, b, PreconditionIdentity());
+
+  y -= x;
+  deallog << "Basis size " << max_basis_size << ": solutions "
+          << (y.linfty_norm() < 1e-9 * x.linfty_norm() ? "match" : "differ")
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  const unsigned int size = 32;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+  SparseMatrix<float> A_float(structure);
+  A_float.copy_from(A);
+
+  deallog.push("Vector");
+  test<Vector<double>, Vector<float>>(A, A_float, 0);
+  test<Vector<double>, Vector<float>>(A, A_float, 10);
+  deallog.pop();
+
+  deallog.push("LinearAlgebra::distributed::Vector");
+  test<LinearAlgebra::distributed::Vector<double>,
+       LinearAlgebra::distributed::Vector<float>>(A, A_float, 0);
+  test<LinearAlgebra::distributed::Vector<double>,
+       LinearAlgebra::distributed::Vector<float>>(A, A_float, 10);
+  deallog.pop();
+}
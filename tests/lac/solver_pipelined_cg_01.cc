@@ -0,0 +1,91 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that SolverPipelinedCG computes the same solution as SolverCG with
+// about the same number of iterations, for Vector (blocking inner products)
+// and LinearAlgebra::distributed::Vector (non-blocking reduction).
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_pipelined_cg.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename VectorType, typename PreconditionerType>
+void
+test(const SparseMatrix<double> &A, const PreconditionerType &preconditioner)
+{
+  VectorType b(A.m()), x(A.m()), y(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    b(i) = random_value<double>();
+
+  SolverControl                 control(1000, 1e-10);
+  SolverPipelinedCG<VectorType> solver(control);
+  solver.solve(A, x, b, preconditioner);
+
+  SolverControl        cg_control(1000, 1e-10);
+  SolverCG<VectorType> cg(cg_control);
+  cg.solve(A, y, b, preconditioner);
+
+  y -= x;
+  deallog << "Iterations "
+          << (control.last_step() + 1 >= cg_control.last_step() &&
+                  control.last_step() <= cg_control.last_step() + 1 ?
+                "match" :
+                "differ")
+          << ", solutions "
+          << (y.linfty_norm() < 1e-6 * x.linfty_norm() ? "match" : "differ")
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+  deallog.depth_file(2);
+
+  const unsigned int size = 32;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+
+  PreconditionIdentity identity;
+  PreconditionSSOR<>   ssor;
+  ssor.initialize(A, 1.2);
+
+  deallog.push("Vector");
+  test<Vector<double>>(A, identity);
+  test<Vector<double>>(A, ssor);
+  deallog.pop();
+
+  deallog.push("LinearAlgebra::distributed::Vector");
+  test<LinearAlgebra::distributed::Vector<double>>(A, identity);
+  deallog.pop();
+}
@@ -0,0 +1,95 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the triangular solves of SparseILU and SparseMIC give the same
+// result when run with one thread and with several threads. The matrix
+// consists of many independent chains, such that each level of the
+// substitution contains enough rows to be processed in parallel.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_ilu.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_mic.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <typename PreconditionerType>
+void
+test(const SparseMatrix<double> &A)
+{
+  PreconditionerType prec;
+  prec.initialize(A);
+
+  Vector<double> src(A.m()), dst(A.m()), dst_serial(A.m()), tmp(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    src(i) = random_value<double>();
+
+  MultithreadInfo::set_thread_limit(1);
+  prec.vmult(dst_serial, src);
+
+  MultithreadInfo::set_thread_limit();
+  prec.vmult(dst, src);
+
+  dst -= dst_serial;
+  deallog << "Difference serial/parallel: " << dst.linfty_norm() << std::endl;
+
+  // the preconditioner should be a reasonable approximation of the inverse
+  A.vmult(tmp, dst_serial);
+  tmp -= src;
+  deallog << "Relative residual: " << tmp.l2_norm() / src.l2_norm()
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(4);
+
+  // 500 one-dimensional Laplacians with 40 points each, numbered in an
+  // interleaved way, which gives 40 levels of 500 rows each
+  const unsigned int n_chains = 500, length = 40, n = n_chains * length;
+
+  DynamicSparsityPattern dsp(n, n);
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      dsp.add(i, i);
+      if (i >= n_chains)
+        dsp.add(i, i - n_chains);
+      if (i + n_chains < n)
+        dsp.add(i, i + n_chains);
+    }
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<double> A(sparsity);
+  for (unsigned int i = 0; i < n; ++i)
+    for (auto entry = A.begin(i); entry != A.end(i); ++entry)
+      entry->value() = (entry->column() == i) ? 2.5 : -1.;
+
+  deallog.push("ILU");
+  test<SparseILU<double>>(A);
+  deallog.pop();
+
+  deallog.push("MIC");
+  test<SparseMIC<double>>(A);
+  deallog.pop();
+}
@@ -0,0 +1,81 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check SparseMatrix::multi_vmult against SparseMatrix::vmult applied to
+// the individual blocks, for BlockVector and
+// LinearAlgebra::distributed::BlockVector.
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <typename BlockVectorType>
+void
+test(const SparseMatrix<double> &A, const unsigned int n_vectors)
+{
+  BlockVectorType src(n_vectors, A.n()), dst(n_vectors, A.m());
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    for (unsigned int i = 0; i < A.n(); ++i)
+      src.block(v)(i) = random_value<double>();
+
+  A.multi_vmult(dst, src);
+
+  typename BlockVectorType::BlockType ref(A.m());
+  double                              error = 0;
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      A.vmult(ref, src.block(v));
+      ref -= dst.block(v);
+      error = std::max(error, ref.linfty_norm());
+    }
+  deallog << "Number of vectors " << n_vectors << ": "
+          << (error < 1e-14 ? "OK" : "Error") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  // a rectangular matrix with rows of different length
+  const unsigned int     m = 1000, n = 700;
+  DynamicSparsityPattern dsp(m, n);
+  for (unsigned int i = 0; i < m; ++i)
+    for (unsigned int j = 0; j < i % 11; ++j)
+      dsp.add(i, (13 * i + 7 * j) % n);
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+  SparseMatrix<double> A(sparsity);
+  for (unsigned int i = 0; i < m; ++i)
+    for (auto entry = A.begin(i); entry != A.end(i); ++entry)
+      entry->value() = random_value<double>();
+
+  deallog.push("BlockVector");
+  for (const unsigned int n_vectors : {1, 3, 8})
+    test<BlockVector<double>>(A, n_vectors);
+  deallog.pop();
+
+  deallog.push("LinearAlgebra::distributed::BlockVector");
+  for (const unsigned int n_vectors : {1, 3, 8})
+    test<LinearAlgebra::distributed::BlockVector<double>>(A, n_vectors);
+  deallog.pop();
+}
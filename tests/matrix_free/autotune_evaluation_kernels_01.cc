@@ -0,0 +1,183 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check MatrixFree::AdditionalData::autotune_evaluation_kernels: The
+// selected kernels must give the same result as the default ones, and the
+// selection must be written to the cache file once per configuration.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include "../tests.h"
+
+
+const std::string cache_file = "autotuning_cache.txt";
+
+
+unsigned int
+count_cache_entries()
+{
+  std::ifstream file(cache_file);
+  std::string   line;
+  unsigned int  n_entries = 0;
+  while (std::getline(file, line))
+    ++n_entries;
+  return n_entries;
+}
+
+
+
+template <int dim, int fe_degree, int n_components>
+void
+apply_operator(const MatrixFree<dim, double> &matrix_free,
+               Vector<double>                &dst,
+               const Vector<double>          &src)
+{
+  const std::function<void(const MatrixFree<dim, double> &,
+                           Vector<double> &,
+                           const Vector<double> &,
+                           const std::pair<unsigned int, unsigned int> &)>
+    cell_operation = [](const MatrixFree<dim, double>               &data,
+                        Vector<double>                              &dst,
+                        const Vector<double>                        &src,
+                        const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, fe_degree, fe_degree + 1, n_components> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src,
+                              EvaluationFlags::values |
+                                EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              phi.submit_value(phi.get_value(q), q);
+              phi.submit_gradient(phi.get_gradient(q), q);
+            }
+          phi.integrate_scatter(EvaluationFlags::values |
+                                  EvaluationFlags::gradients,
+                                dst);
+        }
+    };
+  matrix_free.cell_loop(cell_operation, dst, src, true);
+}
+
+
+
+template <int dim, int fe_degree, int n_components>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+
+  const FE_Q<dim>     fe_q(fe_degree);
+  const FESystem<dim> fe(fe_q, n_components);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  data.mapping_update_flags  = update_values | update_gradients;
+
+  MatrixFree<dim, double> matrix_free_default;
+  matrix_free_default.reinit(MappingQ1<dim>(),
+                             dof_handler,
+                             AffineConstraints<double>(),
+                             QGauss<1>(fe_degree + 1),
+                             data);
+
+  data.autotune_evaluation_kernels = true;
+  data.autotuning_cache_file       = cache_file;
+  MatrixFree<dim, double> matrix_free_tuned;
+  matrix_free_tuned.reinit(MappingQ1<dim>(),
+                           dof_handler,
+                           AffineConstraints<double>(),
+                           QGauss<1>(fe_degree + 1),
+                           data);
+
+  const auto element_type = matrix_free_tuned.get_shape_info().element_type;
+  deallog << "dim=" << dim << " " << fe.get_name() << ": selected kernel is "
+          << (element_type ==
+                  internal::MatrixFreeFunctions::tensor_symmetric ||
+                element_type == internal::MatrixFreeFunctions::
+                                  tensor_symmetric_no_collocation ?
+                "valid" :
+                "invalid")
+          << ", cache entries " << count_cache_entries() << std::endl;
+
+  Vector<double> src(dof_handler.n_dofs());
+  Vector<double> dst_default(src.size()), dst_tuned(src.size());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  apply_operator<dim, fe_degree, n_components>(matrix_free_default,
+                                               dst_default,
+                                               src);
+  apply_operator<dim, fe_degree, n_components>(matrix_free_tuned,
+                                               dst_tuned,
+                                               src);
+  dst_tuned -= dst_default;
+  deallog << "Difference to default kernels: "
+          << (dst_tuned.linfty_norm() < 1e-12 * dst_default.linfty_norm() ?
+                "zero" :
+                "nonzero")
+          << std::endl;
+
+  // a second setup must take the selection from the cache
+  matrix_free_tuned.reinit(MappingQ1<dim>(),
+                           dof_handler,
+                           AffineConstraints<double>(),
+                           QGauss<1>(fe_degree + 1),
+                           data);
+  deallog << "Cache entries after second setup " << count_cache_entries()
+          << ", same kernel: "
+          << (matrix_free_tuned.get_shape_info().element_type == element_type ?
+                "yes" :
+                "no")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  std::remove(cache_file.c_str());
+
+  test<2, 3, 1>();
+  test<2, 2, 2>();
+  test<3, 3, 1>();
+  test<3, 2, 3>();
+
+  std::remove(cache_file.c_str());
+}
@@ -0,0 +1,231 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the kernel variant read from the autotuning cache file of
+// MatrixFree::AdditionalData::autotune_evaluation_kernels is used both for
+// the cell and the face evaluation: With either variant prescribed in the
+// file, the cell and face integrals with values and gradients must agree
+// with the ones of the default kernels.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include "../tests.h"
+
+
+// write the cache file that prescribes the given variant for the
+// configurations of the tests below
+void
+write_cache_file(const std::string &cache_file, const std::string &variant)
+{
+  std::ofstream file(cache_file);
+  for (const auto &[dim, degree] : {std::make_pair(2, 3),
+                                    std::make_pair(3, 2),
+                                    std::make_pair(3, 4)})
+    file << "dim=" << dim << ",degree=" << degree
+         << ",n_q_points_1d=" << degree + 1 << ",n_components=1"
+         << ",number_bytes=" << sizeof(double)
+         << ",lanes=" << VectorizedArray<double>::size() << ' ' << variant
+         << std::endl;
+}
+
+
+
+template <int dim, int fe_degree>
+void
+apply_operator(const MatrixFree<dim, double> &matrix_free,
+               Vector<double>                &dst,
+               const Vector<double>          &src)
+{
+  using Number = VectorizedArray<double>;
+
+  const auto cell_operation =
+    [](const MatrixFree<dim, double>               &data,
+       Vector<double>                              &dst,
+       const Vector<double>                        &src,
+       const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, fe_degree> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src,
+                              EvaluationFlags::values |
+                                EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              phi.submit_value(phi.get_value(q), q);
+              phi.submit_gradient(phi.get_gradient(q), q);
+            }
+          phi.integrate_scatter(EvaluationFlags::values |
+                                  EvaluationFlags::gradients,
+                                dst);
+        }
+    };
+  const auto face_operation =
+    [](const MatrixFree<dim, double>               &data,
+       Vector<double>                              &dst,
+       const Vector<double>                        &src,
+       const std::pair<unsigned int, unsigned int> &range) {
+      FEFaceEvaluation<dim, fe_degree> phi_m(data, true);
+      FEFaceEvaluation<dim, fe_degree> phi_p(data, false);
+      for (unsigned int face = range.first; face < range.second; ++face)
+        {
+          phi_m.reinit(face);
+          phi_p.reinit(face);
+          phi_m.gather_evaluate(src,
+                                EvaluationFlags::values |
+                                  EvaluationFlags::gradients);
+          phi_p.gather_evaluate(src,
+                                EvaluationFlags::values |
+                                  EvaluationFlags::gradients);
+          for (const unsigned int q : phi_m.quadrature_point_indices())
+            {
+              const Number jump = phi_m.get_value(q) - phi_p.get_value(q);
+              const Number average_gradient =
+                0.5 * (phi_m.get_normal_derivative(q) +
+                       phi_p.get_normal_derivative(q));
+              phi_m.submit_value(jump - average_gradient, q);
+              phi_p.submit_value(average_gradient - jump, q);
+              phi_m.submit_normal_derivative(-0.5 * jump, q);
+              phi_p.submit_normal_derivative(-0.5 * jump, q);
+            }
+          phi_m.integrate_scatter(EvaluationFlags::values |
+                                    EvaluationFlags::gradients,
+                                  dst);
+          phi_p.integrate_scatter(EvaluationFlags::values |
+                                    EvaluationFlags::gradients,
+                                  dst);
+        }
+    };
+  const auto boundary_operation =
+    [](const MatrixFree<dim, double>               &data,
+       Vector<double>                              &dst,
+       const Vector<double>                        &src,
+       const std::pair<unsigned int, unsigned int> &range) {
+      FEFaceEvaluation<dim, fe_degree> phi(data, true);
+      for (unsigned int face = range.first; face < range.second; ++face)
+        {
+          phi.reinit(face);
+          phi.gather_evaluate(src,
+                              EvaluationFlags::values |
+                                EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              phi.submit_value(phi.get_value(q) - phi.get_normal_derivative(q),
+                               q);
+              phi.submit_normal_derivative(-phi.get_value(q), q);
+            }
+          phi.integrate_scatter(EvaluationFlags::values |
+                                  EvaluationFlags::gradients,
+                                dst);
+        }
+    };
+  matrix_free.template loop<Vector<double>, Vector<double>>(
+    cell_operation, face_operation, boundary_operation, dst, src, true);
+}
+
+
+
+template <int dim, int fe_degree>
+void
+test(const std::string &cache_file)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+
+  const FE_DGQ<dim> fe(fe_degree);
+  DoFHandler<dim>   dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  data.mapping_update_flags  = update_values | update_gradients;
+  data.mapping_update_flags_inner_faces =
+    update_values | update_gradients | update_normal_vectors;
+  data.mapping_update_flags_boundary_faces =
+    update_values | update_gradients | update_normal_vectors;
+
+  MatrixFree<dim, double> matrix_free_default;
+  matrix_free_default.reinit(MappingQ1<dim>(),
+                             dof_handler,
+                             AffineConstraints<double>(),
+                             QGauss<1>(fe_degree + 1),
+                             data);
+
+  data.autotune_evaluation_kernels = true;
+  data.autotuning_cache_file       = cache_file;
+  MatrixFree<dim, double> matrix_free_tuned;
+  matrix_free_tuned.reinit(MappingQ1<dim>(),
+                           dof_handler,
+                           AffineConstraints<double>(),
+                           QGauss<1>(fe_degree + 1),
+                           data);
+
+  const auto &shape_info = matrix_free_tuned.get_shape_info();
+  deallog << "dim=" << dim << " " << fe.get_name()
+          << ": element type " << static_cast<int>(shape_info.element_type)
+          << ", face element type "
+          << static_cast<int>(shape_info.data[0].element_type) << std::endl;
+
+  Vector<double> src(dof_handler.n_dofs());
+  Vector<double> dst_default(src.size()), dst_tuned(src.size());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  apply_operator<dim, fe_degree>(matrix_free_default, dst_default, src);
+  apply_operator<dim, fe_degree>(matrix_free_tuned, dst_tuned, src);
+  dst_tuned -= dst_default;
+  deallog << "Difference to default kernels: "
+          << (dst_tuned.linfty_norm() < 1e-12 * dst_default.linfty_norm() ?
+                "zero" :
+                "nonzero")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  // the cache file of each variant is only read once per program, so use
+  // different files for the two variants
+  for (const std::string variant : {"collocation", "direct"})
+    {
+      const std::string cache_file = "autotuning_cache_" + variant + ".txt";
+      write_cache_file(cache_file, variant);
+      deallog << "Variant " << variant << std::endl;
+      test<2, 3>(cache_file);
+      test<3, 2>(cache_file);
+      test<3, 4>(cache_file);
+      std::remove(cache_file.c_str());
+    }
+}
@@ -0,0 +1,184 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the evaluation and integration with the factorized representation
+// of the shape functions in CollapsedShapeData for Lagrange polynomials on
+// triangles, tetrahedra, and wedges against the dense evaluation with the
+// shape functions, and check that the representation is not set up for
+// quadrature formulas without the required tensor structure.
+
+#include <deal.II/base/polynomials_barycentric.h>
+#include <deal.II/base/polynomials_wedge.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/grid/reference_cell.h>
+
+#include <deal.II/matrix_free/collapsed_shape_data.templates.h>
+#include <deal.II/matrix_free/evaluation_kernels_collapsed.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const ReferenceCell              &reference_cell,
+     const unsigned int                degree,
+     const ScalarPolynomialsBase<dim> &polynomials,
+     const Quadrature<dim>            &quadrature,
+     const std::string                &quadrature_name)
+{
+  const unsigned int n_dofs     = polynomials.n();
+  const unsigned int n_q_points = quadrature.size();
+
+  internal::MatrixFreeFunctions::CollapsedShapeData<double> data;
+  data.reinit(reference_cell,
+              degree,
+              quadrature,
+              n_dofs,
+              [&](const unsigned int i, const Point<dim> &p) {
+                return polynomials.compute_value(i, p);
+              });
+
+  deallog << reference_cell.to_string() << " degree " << degree << " with "
+          << quadrature_name << ": ";
+  if (!data.is_initialized())
+    {
+      deallog << "dense evaluation" << std::endl;
+      return;
+    }
+  deallog << data.n_levels << " levels, "
+          << (data.modal_permutation.empty() ? "dense" : "permuted")
+          << " transformation" << std::endl;
+
+  std::vector<double> dofs(n_dofs), values(n_q_points),
+    gradients(n_q_points * dim), scratch(data.scratch_size);
+  for (double &entry : dofs)
+    entry = random_value<double>();
+
+  // evaluate
+  internal::CollapsedEvaluator<dim, double, double>::evaluate(
+    data,
+    true,
+    true,
+    dofs.data(),
+    values.data(),
+    gradients.data(),
+    scratch.data());
+  double error_values = 0., error_gradients = 0.;
+  for (unsigned int q = 0; q < n_q_points; ++q)
+    {
+      const Point<dim> &p     = quadrature.point(q);
+      double            value = 0.;
+      Tensor<1, dim>    gradient;
+      for (unsigned int i = 0; i < n_dofs; ++i)
+        {
+          value += dofs[i] * polynomials.compute_value(i, p);
+          gradient += dofs[i] * polynomials.compute_grad(i, p);
+        }
+      error_values = std::max(error_values, std::abs(value - values[q]));
+      for (unsigned int d = 0; d < dim; ++d)
+        error_gradients =
+          std::max(error_gradients,
+                   std::abs(gradient[d] - gradients[q * dim + d]));
+    }
+  deallog << "  evaluate values: "
+          << (error_values < 1e-11 ? "correct" : "wrong") << std::endl;
+  deallog << "  evaluate gradients: "
+          << (error_gradients < 1e-10 ? "correct" : "wrong") << std::endl;
+
+  // integrate
+  for (double &entry : values)
+    entry = random_value<double>();
+  for (double &entry : gradients)
+    entry = random_value<double>();
+  for (const bool integrate_values : {true, false})
+    for (const bool integrate_gradients : {true, false})
+      {
+        if (!integrate_values && !integrate_gradients)
+          continue;
+
+        std::vector<double> result(n_dofs, 1.);
+        internal::CollapsedEvaluator<dim, double, double>::integrate(
+          data,
+          integrate_values,
+          integrate_gradients,
+          values.data(),
+          gradients.data(),
+          result.data(),
+          true,
+          scratch.data());
+        double error = 0.;
+        for (unsigned int i = 0; i < n_dofs; ++i)
+          {
+            double sum = 1.;
+            for (unsigned int q = 0; q < n_q_points; ++q)
+              {
+                const Point<dim> &p = quadrature.point(q);
+                if (integrate_values)
+                  sum += polynomials.compute_value(i, p) * values[q];
+                if (integrate_gradients)
+                  {
+                    const Tensor<1, dim> grad = polynomials.compute_grad(i, p);
+                    for (unsigned int d = 0; d < dim; ++d)
+                      sum += grad[d] * gradients[q * dim + d];
+                  }
+              }
+            error = std::max(error, std::abs(sum - result[i]));
+          }
+        deallog << "  integrate" << (integrate_values ? " values" : "")
+                << (integrate_gradients ? " gradients" : "") << ": "
+                << (error < 1e-10 * n_q_points ? "correct" : "wrong")
+                << std::endl;
+      }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (unsigned int degree = 1; degree < 4; ++degree)
+    test<2>(ReferenceCells::Triangle,
+            degree,
+            BarycentricPolynomials<2>::get_fe_p_basis(degree),
+            QGaussCollapsedSimplex<2>(degree + 1),
+            "QGaussCollapsedSimplex");
+  test<2>(ReferenceCells::Triangle,
+          3,
+          BarycentricPolynomials<2>::get_fe_p_basis(3),
+          QGaussSimplex<2>(4),
+          "QGaussSimplex");
+
+  for (unsigned int degree = 1; degree < 4; ++degree)
+    test<3>(ReferenceCells::Tetrahedron,
+            degree,
+            BarycentricPolynomials<3>::get_fe_p_basis(degree),
+            QGaussCollapsedSimplex<3>(degree + 1),
+            "QGaussCollapsedSimplex");
+  test<3>(ReferenceCells::Tetrahedron,
+          3,
+          BarycentricPolynomials<3>::get_fe_p_basis(3),
+          QGaussSimplex<3>(4),
+          "QGaussSimplex");
+
+  for (unsigned int degree = 1; degree < 3; ++degree)
+    test<3>(ReferenceCells::Wedge,
+            degree,
+            ScalarLagrangePolynomialWedge<3>(degree),
+            QGaussWedge<3>(degree + 1),
+            "QGaussWedge");
+}
@@ -0,0 +1,154 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test MatrixFreeTools::compute_diagonal() with an operation at quadrature
+// points, which computes the diagonal by sum factorization, against the
+// variant with a cell operation for a scalar Helmholtz operator with
+// variable coefficient and a vector-valued operator with coupling between
+// the components, on meshes with hanging nodes and Dirichlet constraints.
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim, int fe_degree, int n_components>
+void
+test(const EvaluationFlags::EvaluationFlags flags)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+  using FEEval     = FEEvaluation<dim, fe_degree, fe_degree + 1, n_components>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const FE_Q<dim>     fe_q(fe_degree);
+  const FESystem<dim> fe(fe_q, n_components);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  VectorTools::interpolate_boundary_values(
+    dof_handler, 0, Functions::ZeroFunction<dim>(n_components), constraints);
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.mapping_update_flags =
+    update_values | update_gradients | update_quadrature_points;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(fe_degree + 1),
+                     data);
+
+  // a Helmholtz operator with variable coefficient for scalar problems and
+  // a vector operator coupling the components via the divergence
+  const auto quad_operation = [](FEEval &phi, const unsigned int q) {
+    const auto coefficient = 1. + phi.quadrature_point(q).norm_square();
+    if constexpr (n_components == 1)
+      {
+        phi.submit_value(coefficient * phi.get_value(q), q);
+        phi.submit_gradient(coefficient * phi.get_gradient(q), q);
+      }
+    else
+      {
+        phi.submit_value(coefficient * phi.get_value(q), q);
+        auto       gradient   = phi.get_gradient(q);
+        const auto divergence = phi.get_divergence(q);
+        for (unsigned int d = 0; d < dim; ++d)
+          gradient[d][d] += 3. * divergence;
+        phi.submit_gradient(coefficient * gradient, q);
+      }
+  };
+
+  VectorType diagonal_reference, diagonal;
+  matrix_free.initialize_dof_vector(diagonal_reference);
+  matrix_free.initialize_dof_vector(diagonal);
+
+  MatrixFreeTools::compute_diagonal<dim,
+                                    fe_degree,
+                                    fe_degree + 1,
+                                    n_components,
+                                    double,
+                                    VectorizedArray<double>,
+                                    VectorType>(
+    matrix_free,
+    diagonal_reference,
+    [&](FEEval &phi) {
+      phi.evaluate(flags);
+      for (const unsigned int q : phi.quadrature_point_indices())
+        quad_operation(phi, q);
+      phi.integrate(flags);
+    });
+
+  MatrixFreeTools::compute_diagonal<dim,
+                                    fe_degree,
+                                    fe_degree + 1,
+                                    n_components,
+                                    double,
+                                    VectorizedArray<double>>(
+    matrix_free, diagonal, quad_operation, flags, flags);
+
+  diagonal -= diagonal_reference;
+  const double error = diagonal.linfty_norm();
+  deallog << "dim=" << dim << " " << fe.get_name() << " flags " << flags
+          << ": difference "
+          << (error < 1e-12 * diagonal_reference.linfty_norm() ? "zero" :
+                                                                  "nonzero")
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  initlog();
+
+  const auto values_gradients =
+    EvaluationFlags::values | EvaluationFlags::gradients;
+
+  test<2, 1, 1>(values_gradients);
+  test<2, 3, 1>(values_gradients);
+  test<2, 3, 1>(EvaluationFlags::gradients);
+  test<2, 2, 2>(values_gradients);
+  test<3, 2, 1>(values_gradients);
+  test<3, 2, 3>(values_gradients);
+}
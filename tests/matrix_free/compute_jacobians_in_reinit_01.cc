@@ -0,0 +1,141 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that MatrixFree::AdditionalData::compute_jacobians_in_reinit, which
+// only stores the support points of a high-order mapping on curved cells and
+// computes the Jacobians in FEEvaluation::reinit(), gives the same results
+// as the stored Jacobians for a Laplace operator on a curved mesh, and that
+// it reduces the memory consumption of the geometry data.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+template <int dim, int fe_degree>
+void
+apply_operator(const MatrixFree<dim, double> &matrix_free,
+               Vector<double>                &dst,
+               const Vector<double>          &src)
+{
+  const std::function<void(const MatrixFree<dim, double> &,
+                           Vector<double> &,
+                           const Vector<double> &,
+                           const std::pair<unsigned int, unsigned int> &)>
+    cell_operation = [](const MatrixFree<dim, double>               &data,
+                        Vector<double>                              &dst,
+                        const Vector<double>                        &src,
+                        const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, fe_degree> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src,
+                              EvaluationFlags::values |
+                                EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              phi.submit_value(phi.get_value(q) *
+                                 phi.quadrature_point(q).norm_square(),
+                               q);
+              phi.submit_gradient(phi.get_gradient(q), q);
+            }
+          phi.integrate_scatter(EvaluationFlags::values |
+                                  EvaluationFlags::gradients,
+                                dst);
+        }
+    };
+  matrix_free.cell_loop(cell_operation, dst, src, true);
+}
+
+
+
+template <int dim, int fe_degree>
+void
+test(const unsigned int mapping_degree)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1., 0, true);
+  tria.refine_global(4 - dim);
+
+  const MappingQ<dim> mapping(mapping_degree);
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  data.mapping_update_flags =
+    update_values | update_gradients | update_quadrature_points;
+
+  MatrixFree<dim, double> matrix_free_stored;
+  matrix_free_stored.reinit(
+    mapping, dof_handler, constraints, QGauss<1>(fe_degree + 1), data);
+
+  data.compute_jacobians_in_reinit = true;
+  MatrixFree<dim, double> matrix_free_on_the_fly;
+  matrix_free_on_the_fly.reinit(
+    mapping, dof_handler, constraints, QGauss<1>(fe_degree + 1), data);
+
+  Vector<double> src(dof_handler.n_dofs());
+  Vector<double> dst_stored(src.size()), dst_on_the_fly(src.size());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  apply_operator<dim, fe_degree>(matrix_free_stored, dst_stored, src);
+  apply_operator<dim, fe_degree>(matrix_free_on_the_fly, dst_on_the_fly, src);
+
+  dst_on_the_fly -= dst_stored;
+  deallog << "dim=" << dim << " mapping degree " << mapping_degree
+          << ": difference "
+          << (dst_on_the_fly.linfty_norm() < 1e-12 * dst_stored.linfty_norm() ?
+                "zero" :
+                "nonzero")
+          << ", geometry memory "
+          << (matrix_free_on_the_fly.get_mapping_info().memory_consumption() <
+                  matrix_free_stored.get_mapping_info().memory_consumption() ?
+                "smaller" :
+                "not smaller")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 3>(2);
+  test<2, 3>(4);
+  test<3, 2>(2);
+  test<3, 2>(3);
+}
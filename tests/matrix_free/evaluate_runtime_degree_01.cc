@@ -0,0 +1,120 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check the correctness of the tensor product evaluation with run-time loop
+// bounds, path evaluate_general, as used for polynomial degrees without
+// precompiled kernels, in all directions and for sizes up to degree 15
+
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/matrix_free/tensor_product_kernels.h>
+
+#include "../tests.h"
+
+
+template <int dim, int direction, bool contract_over_rows, bool add>
+double
+test_direction(const unsigned int n_rows, const unsigned int n_columns)
+{
+  using Number = VectorizedArray<double>;
+
+  AlignedVector<double> shape(n_rows * n_columns);
+  for (double &entry : shape)
+    entry = -1. + 2. * random_value<double>();
+
+  // sizes of the array in the directions below the current one already
+  // have the size n_columns, the ones above are still of size n_rows
+  const unsigned int n_in  = contract_over_rows ? n_rows : n_columns;
+  const unsigned int n_out = contract_over_rows ? n_columns : n_rows;
+  const unsigned int n_before = Utilities::pow(n_columns, direction);
+  const unsigned int n_after  = Utilities::pow(n_rows, dim - direction - 1);
+
+  AlignedVector<Number> in(n_before * n_in * n_after);
+  AlignedVector<Number> out(n_before * n_out * n_after);
+  AlignedVector<Number> reference(out.size());
+  for (Number &entry : in)
+    for (unsigned int v = 0; v < Number::size(); ++v)
+      entry[v] = random_value<double>();
+  for (unsigned int i = 0; i < out.size(); ++i)
+    for (unsigned int v = 0; v < Number::size(); ++v)
+      out[i][v] = reference[i][v] = add ? random_value<double>() : 0.;
+
+  for (unsigned int i2 = 0; i2 < n_after; ++i2)
+    for (unsigned int i1 = 0; i1 < n_before; ++i1)
+      for (unsigned int col = 0; col < n_out; ++col)
+        for (unsigned int i = 0; i < n_in; ++i)
+          reference[(i2 * n_out + col) * n_before + i1] +=
+            (contract_over_rows ? shape[i * n_columns + col] :
+                                  shape[col * n_columns + i]) *
+            in[(i2 * n_in + i) * n_before + i1];
+
+  internal::EvaluatorTensorProduct<internal::evaluate_general,
+                                   dim,
+                                   0,
+                                   0,
+                                   Number,
+                                   double>
+    evaluator(shape, shape, shape, n_rows, n_columns);
+  evaluator.template values<direction, contract_over_rows, add>(in.data(),
+                                                                 out.data());
+
+  double error = 0;
+  for (unsigned int i = 0; i < out.size(); ++i)
+    for (unsigned int v = 0; v < Number::size(); ++v)
+      error = std::max(error, std::abs(out[i][v] - reference[i][v]));
+  return error;
+}
+
+
+
+template <int dim, int direction>
+void
+test(const unsigned int n_rows, const unsigned int n_columns)
+{
+  const double error =
+    std::max(std::max(test_direction<dim, direction, true, false>(n_rows,
+                                                                  n_columns),
+                      test_direction<dim, direction, true, true>(n_rows,
+                                                                 n_columns)),
+             std::max(test_direction<dim, direction, false, false>(n_rows,
+                                                                   n_columns),
+                      test_direction<dim, direction, false, true>(n_rows,
+                                                                  n_columns)));
+  if (error > 1e-12)
+    deallog << "Error dim=" << dim << " direction=" << direction << " "
+            << n_rows << " x " << n_columns << ": " << error << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (unsigned int n_rows = 1; n_rows <= 16; ++n_rows)
+    for (unsigned int n_columns = n_rows > 1 ? n_rows - 1 : n_rows;
+         n_columns <= n_rows + 3;
+         ++n_columns)
+      {
+        test<1, 0>(n_rows, n_columns);
+        test<2, 0>(n_rows, n_columns);
+        test<2, 1>(n_rows, n_columns);
+        test<3, 0>(n_rows, n_columns);
+        test<3, 1>(n_rows, n_columns);
+        test<3, 2>(n_rows, n_columns);
+      }
+  deallog << "OK" << std::endl;
+}
@@ -0,0 +1,171 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the statistics about the overlap of communication and computation
+// reported by MatrixFree::cell_loop() through
+// AdditionalData::overlap_statistics_callback, and that the fraction of
+// interior cells scheduled before the cells with ghost data controls which
+// cells are worked on while the ghost values are exchanged and while the
+// compress operation is in progress.
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const double interior_fraction_before_ghosts)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  parallel::shared::Triangulation<dim> tria(
+    MPI_COMM_WORLD,
+    ::Triangulation<dim>::none,
+    true,
+    parallel::shared::Triangulation<dim>::partition_custom_signal);
+
+  tria.signals.create.connect([&]() {
+    for (const auto &cell : tria.active_cell_iterators())
+      if (cell->center()[1] < 0.5)
+        cell->set_subdomain_id(0);
+      else
+        cell->set_subdomain_id(1);
+  });
+
+  GridGenerator::subdivided_hyper_rectangle(tria,
+                                            {10, 10},
+                                            {0.0, 0.0},
+                                            {1.0, 1.0});
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(FE_Q<dim>(2));
+
+  std::vector<internal::MatrixFreeFunctions::LoopOverlapStatistics>
+    statistics;
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  data.interior_fraction_before_ghosts = interior_fraction_before_ghosts;
+  data.overlap_statistics_callback =
+    [&](const internal::MatrixFreeFunctions::LoopOverlapStatistics &stats) {
+      statistics.push_back(stats);
+    };
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     AffineConstraints<double>(),
+                     QGauss<1>(3),
+                     data);
+
+  VectorType src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  for (const types::global_dof_index i : src.locally_owned_elements())
+    src(i) = std::sin(0.1 * i);
+
+  // a mass matrix operator
+  const std::function<void(const MatrixFree<dim, double> &,
+                           VectorType &,
+                           const VectorType &,
+                           const std::pair<unsigned int, unsigned int> &)>
+    cell_operation = [](const MatrixFree<dim, double>             &data,
+                        VectorType                                &dst,
+                        const VectorType                          &src,
+                        const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, 2> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src, EvaluationFlags::values);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            phi.submit_value(phi.get_value(q), q);
+          phi.integrate_scatter(EvaluationFlags::values, dst);
+        }
+    };
+  matrix_free.cell_loop(cell_operation, dst, src, true);
+
+  deallog << "Fraction " << interior_fraction_before_ghosts
+          << ": number of calls " << statistics.size() << std::endl;
+  const auto &stats = statistics.back();
+  deallog << "All cell batches counted: "
+          << (stats.n_cell_batches_during_update_ghosts +
+                    stats.n_cell_batches_with_ghosts +
+                    stats.n_cell_batches_during_compress ==
+                  matrix_free.n_cell_batches() ?
+                "yes" :
+                "no")
+          << std::endl;
+  deallog << "Cells during ghost update: "
+          << (stats.n_cell_batches_during_update_ghosts > 0 ? "yes" : "no")
+          << ", cells during compress: "
+          << (stats.n_cell_batches_during_compress > 0 ? "yes" : "no")
+          << std::endl;
+  deallog << "Times valid: "
+          << (stats.compute_time_during_update_ghosts >= 0. &&
+                  stats.compute_time_with_ghosts >= 0. &&
+                  stats.compute_time_during_compress >= 0. &&
+                  stats.wait_time_update_ghosts >= 0. &&
+                  stats.wait_time_compress >= 0. ?
+                "yes" :
+                "no")
+          << std::endl;
+
+  // the result must not depend on the order of the cells
+  VectorType reference(dst);
+  data.overlap_communication_computation = false;
+  data.overlap_statistics_callback       = nullptr;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     AffineConstraints<double>(),
+                     QGauss<1>(3),
+                     data);
+  matrix_free.cell_loop(cell_operation, reference, src, true);
+  reference -= dst;
+  deallog << "Difference to loop without overlap: "
+          << (reference.linfty_norm() < 1e-12 * dst.linfty_norm() ? "zero" :
+                                                                     "nonzero")
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  MPILogInitAll log;
+
+  AssertDimension(Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD), 2);
+
+  test<2>(0.);
+  test<2>(0.5);
+  test<2>(1.);
+}
@@ -0,0 +1,194 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check MatrixFreeOperators::PreconditionCellBlockJacobi for an operator
+// with DG elements that consists of a mass and stiffness term on the cells
+// and a penalty term on the faces that does not couple to the neighbors.
+// The operator is block diagonal, so the preconditioner must be its exact
+// inverse for all block solvers. The number of cells is chosen such that
+// some cell batches are only partially filled. The operator is also
+// evaluated with the second quadrature formula of the MatrixFree object.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/cell_block_jacobi.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+template <int dim, int fe_degree>
+void
+test(const unsigned int quadrature_index)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+  using PreconditionerType =
+    MatrixFreeOperators::PreconditionCellBlockJacobi<dim, 1, double>;
+  using CellEvaluatorType = typename PreconditionerType::CellEvaluatorType;
+  using FaceEvaluatorType = typename PreconditionerType::FaceEvaluatorType;
+
+  Triangulation<dim>        tria;
+  std::vector<unsigned int> repetitions(dim, 3);
+  Point<dim>                corner;
+  for (unsigned int d = 0; d < dim; ++d)
+    corner[d] = 1.;
+  GridGenerator::subdivided_hyper_rectangle(tria,
+                                            repetitions,
+                                            Point<dim>(),
+                                            corner);
+  GridTools::distort_random(0.1, tria);
+
+  const FE_DGQ<dim> fe(fe_degree);
+  DoFHandler<dim>   dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  const MappingQ1<dim> mapping;
+  const std::vector<Quadrature<1>> quadratures = {QGauss<1>(fe_degree + 1),
+                                                   QGauss<1>(fe_degree + 2)};
+
+  MatrixFree<dim, double>                          matrix_free;
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values;
+  data.mapping_update_flags_boundary_faces = update_values | update_JxW_values;
+  data.mapping_update_flags_faces_by_cells = update_values | update_JxW_values;
+  matrix_free.reinit(mapping,
+                     std::vector<const DoFHandler<dim> *>{&dof_handler},
+                     std::vector<const AffineConstraints<double> *>{
+                       &constraints},
+                     quadratures,
+                     data);
+
+  const auto cell_operation = [](CellEvaluatorType &phi) {
+    phi.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+    for (unsigned int q = 0; q < phi.n_q_points; ++q)
+      {
+        phi.submit_value(phi.get_value(q), q);
+        phi.submit_gradient(phi.get_gradient(q), q);
+      }
+    phi.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+  };
+  const auto face_operation = [](FaceEvaluatorType &phi) {
+    phi.evaluate(EvaluationFlags::values);
+    for (unsigned int q = 0; q < phi.n_q_points; ++q)
+      phi.submit_value(10. * phi.get_value(q), q);
+    phi.integrate(EvaluationFlags::values);
+  };
+
+  // apply the operator with the same cell and face operations
+  VectorType src, dst, result;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  matrix_free.initialize_dof_vector(result);
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  const std::function<void(const MatrixFree<dim, double> &,
+                           VectorType &,
+                           const VectorType &,
+                           const std::pair<unsigned int, unsigned int> &)>
+    apply_operator = [&](const MatrixFree<dim, double>               &data,
+                         VectorType                                  &dst,
+                         const VectorType                            &src,
+                         const std::pair<unsigned int, unsigned int> &range) {
+      CellEvaluatorType phi(data, 0, quadrature_index);
+      FaceEvaluatorType phi_face(data, true, 0, quadrature_index);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          AlignedVector<VectorizedArray<double>> values(phi.dofs_per_cell);
+          for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+            values[i] = phi.begin_dof_values()[i];
+          cell_operation(phi);
+
+          for (const unsigned int face : GeometryInfo<dim>::face_indices())
+            {
+              phi_face.reinit(cell, face);
+              for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+                phi_face.begin_dof_values()[i] = values[i];
+              face_operation(phi_face);
+              for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+                phi.begin_dof_values()[i] += phi_face.begin_dof_values()[i];
+            }
+          phi.distribute_local_to_global(dst);
+        }
+    };
+  matrix_free.cell_loop(apply_operator, dst, src, true);
+
+  for (const auto block_solver : {PreconditionerType::BlockSolver::inverse,
+                                  PreconditionerType::BlockSolver::lu,
+                                  PreconditionerType::BlockSolver::cholesky})
+    {
+      PreconditionerType preconditioner;
+      preconditioner.initialize(
+        matrix_free,
+        typename PreconditionerType::AdditionalData(cell_operation,
+                                                    face_operation,
+                                                    block_solver,
+                                                    0.5,
+                                                    0,
+                                                    quadrature_index));
+      preconditioner.vmult(result, dst);
+      result.sadd(2., -1., src);
+      deallog << "dim=" << dim << " degree=" << fe_degree << " quadrature "
+              << quadrature_index << " solver "
+              << static_cast<int>(block_solver) << ": error of vmult "
+              << (result.linfty_norm() < 1e-10 * src.linfty_norm() ? "zero" :
+                                                                     "nonzero")
+              << std::endl;
+
+      if (block_solver != PreconditionerType::BlockSolver::lu)
+        {
+          preconditioner.Tvmult(result, dst);
+          result.sadd(2., -1., src);
+          deallog << "dim=" << dim << " degree=" << fe_degree
+                  << " quadrature " << quadrature_index << " solver "
+                  << static_cast<int>(block_solver) << ": error of Tvmult "
+                  << (result.linfty_norm() < 1e-10 * src.linfty_norm() ?
+                        "zero" :
+                        "nonzero")
+                  << std::endl;
+        }
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1>(0);
+  test<2, 3>(0);
+  test<2, 3>(1);
+  test<3, 2>(0);
+}
@@ -0,0 +1,196 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check MatrixFreeOperators::PreconditionCellPatchSchwarz on a uniform
+// Cartesian mesh with anisotropic cells against an additive Schwarz method
+// set up from the sub-matrices of the assembled Laplace matrix, with mixed
+// Dirichlet and Neumann boundaries, and check that it can be used through
+// MGSmootherPrecondition.
+
+#include <deal.II/base/mg_level_object.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <deal.II/matrix_free/cell_patch_schwarz.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/multigrid/mg_smoother.h>
+
+#include <deal.II/numerics/matrix_creator.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim, int fe_degree>
+void
+test()
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  Triangulation<dim>        tria;
+  std::vector<unsigned int> repetitions(dim, 3);
+  repetitions[0] = 2;
+  Point<dim> corner;
+  for (unsigned int d = 0; d < dim; ++d)
+    corner[d] = 1.;
+  GridGenerator::subdivided_hyper_rectangle(
+    tria, repetitions, Point<dim>(), corner, true);
+
+  const FE_Q<dim> fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  // Dirichlet conditions on the left and lower boundaries
+  const std::set<types::boundary_id> dirichlet_boundaries = {0, 2};
+  AffineConstraints<double>          constraints;
+  for (const types::boundary_id id : dirichlet_boundaries)
+    VectorTools::interpolate_boundary_values(
+      dof_handler, id, Functions::ZeroFunction<dim>(), constraints);
+  constraints.close();
+
+  const MappingQ1<dim> mapping;
+  const QGauss<1>      quadrature(fe_degree + 1);
+
+  std::shared_ptr<MatrixFree<dim, double>> matrix_free(
+    new MatrixFree<dim, double>());
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  matrix_free->reinit(mapping, dof_handler, constraints, quadrature, data);
+
+  MatrixFreeOperators::PreconditionCellPatchSchwarz<dim, double> schwarz;
+  schwarz.initialize(
+    *matrix_free,
+    typename MatrixFreeOperators::PreconditionCellPatchSchwarz<dim, double>::
+      AdditionalData(dirichlet_boundaries));
+
+  VectorType src, dst;
+  matrix_free->initialize_dof_vector(src);
+  matrix_free->initialize_dof_vector(dst);
+  for (unsigned int i = 0; i < src.size(); ++i)
+    if (!constraints.is_constrained(i))
+      src(i) = random_value<double>();
+  schwarz.vmult(dst, src);
+
+  // reference: additive Schwarz with the sub-matrices of the assembled
+  // matrix on the unconstrained degrees of freedom of each cell
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+  SparseMatrix<double> matrix(sparsity);
+  MatrixCreator::create_laplace_matrix(mapping,
+                                       dof_handler,
+                                       QGauss<dim>(fe_degree + 1),
+                                       matrix);
+
+  Vector<double> weights(dof_handler.n_dofs());
+  std::vector<std::vector<types::global_dof_index>> patch_indices;
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(dof_indices);
+      patch_indices.emplace_back();
+      for (const types::global_dof_index i : dof_indices)
+        if (!constraints.is_constrained(i))
+          {
+            patch_indices.back().push_back(i);
+            weights(i) += 1.;
+          }
+    }
+  for (double &weight : weights)
+    if (weight > 0.)
+      weight = 1. / std::sqrt(weight);
+
+  Vector<double> reference(dof_handler.n_dofs());
+  for (const std::vector<types::global_dof_index> &indices : patch_indices)
+    {
+      FullMatrix<double> local_matrix(indices.size(), indices.size());
+      Vector<double>     local_src(indices.size()), local_dst(indices.size());
+      for (unsigned int i = 0; i < indices.size(); ++i)
+        {
+          for (unsigned int j = 0; j < indices.size(); ++j)
+            local_matrix(i, j) = matrix.el(indices[i], indices[j]);
+          local_src(i) = weights(indices[i]) * src(indices[i]);
+        }
+      local_matrix.gauss_jordan();
+      local_matrix.vmult(local_dst, local_src);
+      for (unsigned int i = 0; i < indices.size(); ++i)
+        reference(indices[i]) += weights(indices[i]) * local_dst(i);
+    }
+
+  double error = 0.;
+  for (unsigned int i = 0; i < dst.size(); ++i)
+    error = std::max(error, std::abs(dst(i) - reference(i)));
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << ": difference to assembled Schwarz "
+          << (error < 1e-10 * reference.linfty_norm() ? "zero" : "nonzero")
+          << std::endl;
+
+  // use the preconditioner as smoother on a single level
+  using LevelMatrixType =
+    MatrixFreeOperators::LaplaceOperator<dim,
+                                         fe_degree,
+                                         fe_degree + 1,
+                                         1,
+                                         VectorType>;
+  MGLevelObject<LevelMatrixType> level_matrices(0, 0);
+  level_matrices[0].initialize(matrix_free);
+
+  using SmootherType =
+    MatrixFreeOperators::PreconditionCellPatchSchwarz<dim, double>;
+  MGSmootherPrecondition<LevelMatrixType, SmootherType, VectorType> smoother;
+  smoother.initialize(level_matrices,
+                      typename SmootherType::AdditionalData(
+                        dirichlet_boundaries));
+  smoother.set_steps(1);
+
+  VectorType solution;
+  matrix_free->initialize_dof_vector(solution);
+  smoother.apply(0, solution, src);
+  solution -= dst;
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << ": difference of smoother application "
+          << (solution.linfty_norm() < 1e-12 * dst.linfty_norm() ? "zero" :
+                                                                    "nonzero")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1>();
+  test<2, 3>();
+  test<3, 2>();
+}
@@ -0,0 +1,243 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the threaded loop with the scheme contiguous_blocks computes
+// the same results as the loop without threads, both for a cell loop with
+// operations before and after the loop on a continuous element and for a
+// loop with face integrals on a discontinuous element, in combination with
+// MPI.
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+template <int dim, int fe_degree>
+class Operator
+{
+public:
+  Operator(const MatrixFree<dim, double> &matrix_free)
+    : matrix_free(matrix_free)
+  {}
+
+  // a Laplace operator applied to a scaled source vector, computed by the
+  // operation before the loop, where the operation after the loop adds the
+  // scaled source vector and multiplies by a diagonal matrix
+  void
+  vmult_cell(VectorType &dst, const VectorType &src) const
+  {
+    VectorType tmp(src);
+    matrix_free.cell_loop(
+      &Operator::local_cell,
+      this,
+      dst,
+      tmp,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          tmp.local_element(i) = 2. * src.local_element(i);
+      },
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          dst.local_element(i) =
+            (1. + 0.01 * i) * (dst.local_element(i) + tmp.local_element(i));
+      });
+  }
+
+  // an interior penalty discretization of the Laplacian
+  void
+  vmult_dg(VectorType &dst, const VectorType &src) const
+  {
+    matrix_free.loop(&Operator::local_cell,
+                     &Operator::local_face,
+                     &Operator::local_boundary,
+                     this,
+                     dst,
+                     src,
+                     true,
+                     MatrixFree<dim, double>::DataAccessOnFaces::values,
+                     MatrixFree<dim, double>::DataAccessOnFaces::values);
+  }
+
+private:
+  void
+  local_cell(const MatrixFree<dim, double>               &data,
+             VectorType                                  &dst,
+             const VectorType                            &src,
+             const std::pair<unsigned int, unsigned int> &range) const
+  {
+    FEEvaluation<dim, fe_degree> phi(data);
+    for (unsigned int cell = range.first; cell < range.second; ++cell)
+      {
+        phi.reinit(cell);
+        phi.gather_evaluate(src, EvaluationFlags::gradients);
+        for (const unsigned int q : phi.quadrature_point_indices())
+          phi.submit_gradient(phi.get_gradient(q), q);
+        phi.integrate_scatter(EvaluationFlags::gradients, dst);
+      }
+  }
+
+  void
+  local_face(const MatrixFree<dim, double>               &data,
+             VectorType                                  &dst,
+             const VectorType                            &src,
+             const std::pair<unsigned int, unsigned int> &range) const
+  {
+    FEFaceEvaluation<dim, fe_degree> phi_m(data, true), phi_p(data, false);
+    for (unsigned int face = range.first; face < range.second; ++face)
+      {
+        phi_m.reinit(face);
+        phi_p.reinit(face);
+        phi_m.gather_evaluate(src, EvaluationFlags::values);
+        phi_p.gather_evaluate(src, EvaluationFlags::values);
+        for (const unsigned int q : phi_m.quadrature_point_indices())
+          {
+            const auto jump = phi_m.get_value(q) - phi_p.get_value(q);
+            phi_m.submit_value(10. * jump, q);
+            phi_p.submit_value(-10. * jump, q);
+          }
+        phi_m.integrate_scatter(EvaluationFlags::values, dst);
+        phi_p.integrate_scatter(EvaluationFlags::values, dst);
+      }
+  }
+
+  void
+  local_boundary(const MatrixFree<dim, double>               &data,
+                 VectorType                                  &dst,
+                 const VectorType                            &src,
+                 const std::pair<unsigned int, unsigned int> &range) const
+  {
+    FEFaceEvaluation<dim, fe_degree> phi(data, true);
+    for (unsigned int face = range.first; face < range.second; ++face)
+      {
+        phi.reinit(face);
+        phi.gather_evaluate(src, EvaluationFlags::values);
+        for (const unsigned int q : phi.quadrature_point_indices())
+          phi.submit_value(20. * phi.get_value(q), q);
+        phi.integrate_scatter(EvaluationFlags::values, dst);
+      }
+  }
+
+  const MatrixFree<dim, double> &matrix_free;
+};
+
+
+
+template <int dim, int fe_degree>
+void
+test(const FiniteElement<dim> &fe)
+{
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(5 - dim);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned() && cell->center()[0] < 0.3)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.reinit(dof_handler.locally_owned_dofs(),
+                     DoFTools::extract_locally_relevant_dofs(dof_handler));
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  const bool is_dg = fe.n_dofs_per_vertex() == 0;
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  if (is_dg)
+    {
+      data.mapping_update_flags_inner_faces    = update_values;
+      data.mapping_update_flags_boundary_faces = update_values;
+    }
+
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  MatrixFree<dim, double> matrix_free_serial;
+  matrix_free_serial.reinit(
+    MappingQ1<dim>(), dof_handler, constraints, QGauss<1>(fe_degree + 1), data);
+
+  data.tasks_parallel_scheme =
+    MatrixFree<dim, double>::AdditionalData::contiguous_blocks;
+  MatrixFree<dim, double> matrix_free_threaded;
+  matrix_free_threaded.reinit(
+    MappingQ1<dim>(), dof_handler, constraints, QGauss<1>(fe_degree + 1), data);
+
+  VectorType src, dst_serial, dst_threaded;
+  matrix_free_serial.initialize_dof_vector(src);
+  matrix_free_serial.initialize_dof_vector(dst_serial);
+  matrix_free_threaded.initialize_dof_vector(dst_threaded);
+  for (const types::global_dof_index i : src.locally_owned_elements())
+    if (!constraints.is_constrained(i))
+      src(i) = random_value<double>();
+
+  Operator<dim, fe_degree> op_serial(matrix_free_serial);
+  Operator<dim, fe_degree> op_threaded(matrix_free_threaded);
+
+  // several sweeps to get some variation into the threaded loop
+  for (unsigned int sweep = 0; sweep < 3; ++sweep)
+    {
+      if (is_dg)
+        {
+          op_serial.vmult_dg(dst_serial, src);
+          op_threaded.vmult_dg(dst_threaded, src);
+        }
+      else
+        {
+          op_serial.vmult_cell(dst_serial, src);
+          op_threaded.vmult_cell(dst_threaded, src);
+        }
+      dst_threaded -= dst_serial;
+      deallog << fe.get_name() << " sweep " << sweep << ": difference "
+              << (dst_threaded.linfty_norm() <
+                      1e-12 * dst_serial.linfty_norm() ?
+                    "zero" :
+                    "nonzero")
+              << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 3);
+
+  MPILogInitAll log;
+
+  test<2, 2>(FE_Q<2>(2));
+  test<2, 1>(FE_DGQ<2>(1));
+  test<3, 1>(FE_Q<3>(1));
+  test<3, 2>(FE_DGQ<3>(2));
+}
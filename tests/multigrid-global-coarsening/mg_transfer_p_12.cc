@@ -0,0 +1,157 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+/**
+ * Test that a transfer operator for polynomial coarsening that is set up
+ * again after each adaptive refinement step, reusing the cached
+ * prolongation and restriction matrices of the element pair, gives the same
+ * results as a newly created transfer operator that computes these matrices
+ * anew after the cache has been cleared.
+ */
+
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include "../tests.h"
+
+using namespace dealii;
+
+template <typename Number>
+bool
+is_equal(const LinearAlgebra::distributed::Vector<Number> &a,
+         const LinearAlgebra::distributed::Vector<Number> &b)
+{
+  LinearAlgebra::distributed::Vector<Number> difference(a);
+  difference -= b;
+  return difference.linfty_norm() <= 1e-12 * a.linfty_norm();
+}
+
+
+
+template <int dim, typename Number>
+void
+do_test(const FiniteElement<dim> &fe_fine, const FiniteElement<dim> &fe_coarse)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global();
+
+  DoFHandler<dim> dof_handler_fine(tria);
+  DoFHandler<dim> dof_handler_coarse(tria);
+
+  MGTwoLevelTransfer<dim, VectorType> transfer;
+
+  for (unsigned int cycle = 0; cycle < 3; ++cycle)
+    {
+      // refine the cells in the lower left corner
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->center()[0] < 0.5 && cell->center()[1] < 0.5)
+          cell->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+
+      dof_handler_fine.distribute_dofs(fe_fine);
+      dof_handler_coarse.distribute_dofs(fe_coarse);
+
+      AffineConstraints<Number> constraints_fine;
+      DoFTools::make_hanging_node_constraints(dof_handler_fine,
+                                              constraints_fine);
+      constraints_fine.close();
+
+      AffineConstraints<Number> constraints_coarse;
+      DoFTools::make_hanging_node_constraints(dof_handler_coarse,
+                                              constraints_coarse);
+      constraints_coarse.close();
+
+      // set up the existing transfer operator again, which takes the
+      // matrices from the cache after the first cycle, and compare with a
+      // new one set up with an empty cache
+      transfer.reinit_polynomial_transfer(dof_handler_fine,
+                                          dof_handler_coarse,
+                                          constraints_fine,
+                                          constraints_coarse);
+
+      MGTransferGlobalCoarseningTools::clear_transfer_matrix_cache();
+      MGTwoLevelTransfer<dim, VectorType> new_transfer;
+      new_transfer.reinit_polynomial_transfer(dof_handler_fine,
+                                              dof_handler_coarse,
+                                              constraints_fine,
+                                              constraints_coarse);
+
+      VectorType src_coarse(dof_handler_coarse.n_dofs());
+      VectorType src_fine(dof_handler_fine.n_dofs());
+      for (unsigned int i = 0; i < src_coarse.size(); ++i)
+        src_coarse[i] = (i % 7) + 1.;
+      for (unsigned int i = 0; i < src_fine.size(); ++i)
+        src_fine[i] = (i % 5) + 1.;
+      constraints_coarse.set_zero(src_coarse);
+      constraints_fine.set_zero(src_fine);
+
+      VectorType dst_fine(dof_handler_fine.n_dofs());
+      VectorType dst_fine_new(dof_handler_fine.n_dofs());
+      transfer.prolongate_and_add(dst_fine, src_coarse);
+      new_transfer.prolongate_and_add(dst_fine_new, src_coarse);
+
+      VectorType dst_coarse(dof_handler_coarse.n_dofs());
+      VectorType dst_coarse_new(dof_handler_coarse.n_dofs());
+      transfer.restrict_and_add(dst_coarse, src_fine);
+      new_transfer.restrict_and_add(dst_coarse_new, src_fine);
+
+      deallog << "Cycle " << cycle << ": prolongation "
+              << (is_equal(dst_fine_new, dst_fine) ? "identical" : "different")
+              << ", restriction "
+              << (is_equal(dst_coarse_new, dst_coarse) ? "identical" :
+                                                         "different")
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    deallog.push("CG<2>(3)<->CG<2>(1)");
+    do_test<2, double>(FE_Q<2>(3), FE_Q<2>(1));
+    deallog.pop();
+  }
+
+  {
+    deallog.push("DG<2>(3)<->DG<2>(2)");
+    do_test<2, double>(FE_DGQ<2>(3), FE_DGQ<2>(2));
+    deallog.pop();
+  }
+
+  {
+    deallog.push("CG<2>(2)<->CG<2>(1) float");
+    do_test<2, float>(FE_Q<2>(2), FE_Q<2>(1));
+    deallog.pop();
+  }
+}
@@ -0,0 +1,161 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check Multigrid::additive_cycle for a hierarchy of one-dimensional
+// Laplace matrices with linear interpolation between the levels: compare
+// with the sum of the level corrections computed explicitly, and use the
+// method as a preconditioner for CG, both with several threads.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include "../tests.h"
+
+#include "laplace_1d_hierarchy.h"
+
+
+// wrap the Multigrid object into a preconditioner
+class MGPreconditioner
+{
+public:
+  MGPreconditioner(Multigrid<VectorType> &mg)
+    : mg(mg)
+  {}
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    mg.defect[mg.get_maxlevel()] = src;
+    for (unsigned int level = mg.get_minlevel(); level < mg.get_maxlevel();
+         ++level)
+      mg.defect[level] = 0.;
+    mg.cycle();
+    dst = mg.solution[mg.get_maxlevel()];
+  }
+
+private:
+  Multigrid<VectorType> &mg;
+};
+
+
+
+void
+test(const unsigned int max_level)
+{
+  const unsigned int min_level = 0;
+  const double       relaxation = 2. / 3.;
+
+  MGLevelObject<SparsityPattern>      sparsity(min_level, max_level);
+  MGLevelObject<SparseMatrix<double>> matrices(min_level, max_level);
+  make_laplace_matrices(sparsity, matrices);
+
+  mg::Matrix<VectorType> mg_matrix(matrices);
+
+  FullMatrix<double> coarse_matrix;
+  coarse_matrix.copy_from(matrices[min_level]);
+  MGCoarseGridHouseholder<double, VectorType> coarse(&coarse_matrix);
+
+  Transfer transfer;
+
+  using SmootherType = PreconditionJacobi<SparseMatrix<double>>;
+  MGSmootherPrecondition<SparseMatrix<double>, SmootherType, VectorType>
+    smoother;
+  smoother.initialize(matrices, SmootherType::AdditionalData(relaxation));
+
+  Multigrid<VectorType> mg(mg_matrix,
+                           coarse,
+                           transfer,
+                           smoother,
+                           smoother,
+                           min_level,
+                           max_level,
+                           Multigrid<VectorType>::additive_cycle);
+  for (unsigned int level = min_level; level <= max_level; ++level)
+    mg.defect[level].reinit(n_points(level));
+
+  // compare one application with the explicit sum of the level corrections
+  VectorType rhs(n_points(max_level));
+  for (unsigned int i = 0; i < rhs.size(); ++i)
+    rhs(i) = random_value<double>();
+
+  MGLevelObject<VectorType> defects(min_level, max_level);
+  MGLevelObject<VectorType> corrections(min_level, max_level);
+  for (unsigned int level = min_level; level <= max_level; ++level)
+    {
+      defects[level].reinit(n_points(level));
+      corrections[level].reinit(n_points(level));
+    }
+  defects[max_level] = rhs;
+  for (unsigned int level = max_level; level > min_level; --level)
+    transfer.restrict_and_add(level, defects[level - 1], defects[level]);
+  coarse(min_level, corrections[min_level], defects[min_level]);
+  for (unsigned int level = min_level + 1; level <= max_level; ++level)
+    {
+      for (unsigned int i = 0; i < n_points(level); ++i)
+        corrections[level](i) =
+          relaxation * defects[level](i) / matrices[level].diag_element(i);
+      transfer.prolongate_and_add(level,
+                                  corrections[level],
+                                  corrections[level - 1]);
+    }
+
+  MGPreconditioner preconditioner(mg);
+  VectorType       result(rhs.size());
+  preconditioner.vmult(result, rhs);
+  result -= corrections[max_level];
+  const double tolerance = 1e-12 * corrections[max_level].linfty_norm();
+  deallog << "Levels " << min_level << "-" << max_level
+          << ": difference to explicit sum "
+          << (result.linfty_norm() < tolerance ? "zero" : "nonzero")
+          << std::endl;
+
+  // solve with CG, preconditioned by the additive cycle and by the V-cycle
+  for (const auto cycle : {Multigrid<VectorType>::additive_cycle,
+                           Multigrid<VectorType>::v_cycle})
+    {
+      mg.set_cycle(cycle);
+      SolverControl        control(200, 1e-10 * rhs.l2_norm());
+      SolverCG<VectorType> solver(control);
+      VectorType           solution(rhs.size());
+      solver.solve(matrices[max_level], solution, rhs, preconditioner);
+      deallog << (cycle == Multigrid<VectorType>::v_cycle ? "V-cycle" :
+                                                            "additive")
+              << ": converged in " << control.last_step() << " iterations"
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+  MultithreadInfo::set_thread_limit(3);
+
+  test(2);
+  test(4);
+  test(6);
+}
@@ -0,0 +1,188 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the V-cycle with a Chebyshev pre-smoother that computes the residual
+// within its last matrix-vector product, see
+// Multigrid::set_residual_from_smoother(), for a hierarchy of
+// one-dimensional Laplace matrices: the result must be the same as with the
+// separate residual computation, the smoother must do one additional
+// matrix-vector product per level, and the residual step must still be
+// signaled.
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/precondition.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include "../tests.h"
+
+#include "laplace_1d_hierarchy.h"
+
+
+// a sparse matrix that can run operations on subranges of the vectors
+// before and after the matrix-vector product
+class MatrixWithRanges : public EnableObserverPointer
+{
+public:
+  void
+  initialize(const SparseMatrix<double> &matrix)
+  {
+    sparse_matrix = &matrix;
+  }
+
+  void
+  vmult(VectorType       &dst,
+        const VectorType &src,
+        const std::function<void(const unsigned int, const unsigned int)>
+          &operation_before_matrix_vector_product = {},
+        const std::function<void(const unsigned int, const unsigned int)>
+          &operation_after_matrix_vector_product = {}) const
+  {
+    ++n_vmults;
+
+    if (operation_before_matrix_vector_product)
+      operation_before_matrix_vector_product(0, src.size());
+
+    sparse_matrix->vmult(dst, src);
+
+    if (operation_after_matrix_vector_product)
+      operation_after_matrix_vector_product(0, src.size());
+  }
+
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const
+  {
+    sparse_matrix->Tvmult(dst, src);
+  }
+
+  types::global_dof_index
+  m() const
+  {
+    return sparse_matrix->m();
+  }
+
+  double
+  el(const unsigned int i, const unsigned int j) const
+  {
+    return sparse_matrix->el(i, j);
+  }
+
+  static unsigned int n_vmults;
+
+private:
+  ObserverPointer<const SparseMatrix<double>> sparse_matrix;
+};
+
+unsigned int MatrixWithRanges::n_vmults = 0;
+
+
+
+void
+test(const unsigned int max_level)
+{
+  const unsigned int min_level = 0;
+
+  MGLevelObject<SparsityPattern>      sparsity(min_level, max_level);
+  MGLevelObject<SparseMatrix<double>> matrices(min_level, max_level);
+  MGLevelObject<MatrixWithRanges>     matrices_with_ranges(min_level,
+                                                       max_level);
+  make_laplace_matrices(sparsity, matrices);
+  for (unsigned int level = min_level; level <= max_level; ++level)
+    matrices_with_ranges[level].initialize(matrices[level]);
+
+  mg::Matrix<VectorType> mg_matrix(matrices);
+
+  FullMatrix<double> coarse_matrix;
+  coarse_matrix.copy_from(matrices[min_level]);
+  MGCoarseGridHouseholder<double, VectorType> coarse(&coarse_matrix);
+
+  Transfer transfer;
+
+  using SmootherType = PreconditionChebyshev<MatrixWithRanges,
+                                             VectorType,
+                                             DiagonalMatrix<VectorType>>;
+  SmootherType::AdditionalData data;
+  data.degree              = 3;
+  data.smoothing_range     = 15.;
+  data.eig_cg_n_iterations = 0;
+  data.max_eigenvalue      = 2.;
+  MGSmootherPrecondition<MatrixWithRanges, SmootherType, VectorType> smoother;
+  smoother.initialize(matrices_with_ranges, data);
+
+  deallog << "Levels " << min_level << "-" << max_level
+          << ": fused residual supported "
+          << (smoother.supports_apply_and_compute_residual(max_level) ? "yes" :
+                                                                        "no")
+          << std::endl;
+
+  VectorType rhs(n_points(max_level));
+  for (unsigned int i = 0; i < rhs.size(); ++i)
+    rhs(i) = random_value<double>();
+
+  VectorType results[2];
+  for (unsigned int fused = 0; fused < 2; ++fused)
+    {
+      Multigrid<VectorType> mg(mg_matrix, coarse, transfer, smoother, smoother);
+      mg.set_residual_from_smoother(fused == 1);
+      for (unsigned int level = min_level; level <= max_level; ++level)
+        mg.defect[level].reinit(n_points(level));
+
+      unsigned int n_residual_steps = 0;
+      const auto   connection =
+        mg.connect_residual_step([&](const bool before, const unsigned int) {
+          if (before)
+            ++n_residual_steps;
+        });
+
+      MatrixWithRanges::n_vmults = 0;
+      mg.defect[max_level] = rhs;
+      mg.cycle();
+      results[fused] = mg.solution[max_level];
+      connection.disconnect();
+
+      // check the residual of the cycle
+      VectorType residual(rhs.size());
+      matrices[max_level].residual(residual, results[fused], rhs);
+      deallog << (fused == 1 ? "fused:   " : "unfused: ")
+              << "smoother products " << MatrixWithRanges::n_vmults
+              << ", residual steps " << n_residual_steps
+              << ", relative residual after one cycle "
+              << (residual.l2_norm() < 0.5 * rhs.l2_norm() ? "below 0.5" :
+                                                             "above 0.5")
+              << std::endl;
+    }
+
+  results[1] -= results[0];
+  deallog << "Difference between fused and unfused cycle: "
+          << (results[1].linfty_norm() < 1e-12 * results[0].linfty_norm() ?
+                "zero" :
+                "nonzero")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test(2);
+  test(5);
+}
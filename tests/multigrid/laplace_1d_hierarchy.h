@@ -0,0 +1,110 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// A hierarchy of one-dimensional Laplace matrices on uniformly refined
+// intervals with linear interpolation between the levels, for tests of the
+// multigrid cycles that do not need a mesh.
+
+#include <deal.II/base/mg_level_object.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+
+#include "../tests.h"
+
+
+using VectorType = Vector<double>;
+
+// number of interior points on a level
+unsigned int
+n_points(const unsigned int level)
+{
+  return (2U << level) - 1;
+}
+
+
+
+// finite difference Laplacian on all levels of the given objects, scaled by
+// h such that the matrices are the Galerkin products of the linear
+// interpolation
+void
+make_laplace_matrices(MGLevelObject<SparsityPattern>      &sparsity,
+                      MGLevelObject<SparseMatrix<double>> &matrices)
+{
+  for (unsigned int level = matrices.min_level();
+       level <= matrices.max_level();
+       ++level)
+    {
+      const unsigned int     n = n_points(level);
+      DynamicSparsityPattern dsp(n, n);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = (i > 0 ? i - 1 : 0); j < std::min(i + 2, n); ++j)
+          dsp.add(i, j);
+      sparsity[level].copy_from(dsp);
+      matrices[level].reinit(sparsity[level]);
+
+      const double h = 1. / (n + 1);
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          matrices[level].set(i, i, 2. / h);
+          if (i > 0)
+            matrices[level].set(i, i - 1, -1. / h);
+          if (i + 1 < n)
+            matrices[level].set(i, i + 1, -1. / h);
+        }
+    }
+}
+
+
+
+// linear interpolation from level-1 to level and its transpose
+class Transfer : public MGTransferBase<VectorType>
+{
+public:
+  virtual void
+  prolongate(const unsigned int to_level,
+             VectorType        &dst,
+             const VectorType  &src) const override
+  {
+    dst = 0.;
+    prolongate_and_add(to_level, dst, src);
+  }
+
+  virtual void
+  prolongate_and_add(const unsigned int to_level,
+                     VectorType        &dst,
+                     const VectorType  &src) const override
+  {
+    for (unsigned int i = 0; i < n_points(to_level - 1); ++i)
+      {
+        dst(2 * i) += 0.5 * src(i);
+        dst(2 * i + 1) += src(i);
+        dst(2 * i + 2) += 0.5 * src(i);
+      }
+  }
+
+  virtual void
+  restrict_and_add(const unsigned int from_level,
+                   VectorType        &dst,
+                   const VectorType  &src) const override
+  {
+    for (unsigned int i = 0; i < n_points(from_level - 1); ++i)
+      dst(i) += 0.5 * src(2 * i) + src(2 * i + 1) + 0.5 * src(2 * i + 2);
+  }
+};
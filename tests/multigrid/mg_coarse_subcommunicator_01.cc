@@ -0,0 +1,98 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test MGCoarseGridSubcommunicatorSolver with a coarse level that is only
+// distributed among the first half of the processes: solve with a diagonal
+// matrix and check the solution and the size of the sub-communicator.
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <deal.II/multigrid/mg_coarse_subcommunicator.h>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  const MPI_Comm     comm        = MPI_COMM_WORLD;
+  const unsigned int my_rank     = Utilities::MPI::this_mpi_process(comm);
+  const unsigned int n_processes = Utilities::MPI::n_mpi_processes(comm);
+  const unsigned int n_active    = (n_processes + 1) / 2;
+
+  // the first n_active processes own 5 entries each
+  const unsigned int n_local = 5;
+  IndexSet           locally_owned(n_local * n_active);
+  if (my_rank < n_active)
+    locally_owned.add_range(my_rank * n_local, (my_rank + 1) * n_local);
+
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(locally_owned, comm);
+
+  DiagonalMatrix<VectorType> matrix;
+  matrix.get_vector().reinit(partitioner);
+  for (const auto i : locally_owned)
+    matrix.get_vector()(i) = 1. + i;
+
+  SolverControl        control(100, 1e-12);
+  SolverCG<VectorType> solver(control);
+  PreconditionIdentity preconditioner;
+
+  MGCoarseGridSubcommunicatorSolver<double,
+                                    SolverCG<VectorType>,
+                                    DiagonalMatrix<VectorType>,
+                                    PreconditionIdentity>
+    coarse_solver(solver, matrix, preconditioner, partitioner);
+
+  deallog << "Process participates in coarse solve: "
+          << coarse_solver.is_active() << std::endl;
+  if (coarse_solver.is_active())
+    deallog << "Size of sub-communicator: "
+            << Utilities::MPI::n_mpi_processes(
+                 coarse_solver.get_subcommunicator())
+            << std::endl;
+
+  VectorType src(partitioner), dst(partitioner);
+  for (const auto i : locally_owned)
+    src(i) = 1.;
+  coarse_solver(0, dst, src);
+
+  double error = 0.;
+  for (const auto i : locally_owned)
+    error = std::max(error, std::abs(dst(i) - 1. / (1. + i)));
+  error = Utilities::MPI::max(error, comm);
+  deallog << "Error: " << (error < 1e-10 ? "zero" : "nonzero") << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test();
+}
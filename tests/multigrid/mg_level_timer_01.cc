@@ -0,0 +1,141 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test that MGLevelTimer records the operations of a multigrid V-cycle on the
+// correct levels, and that it stops recording after disconnect().
+
+#include <deal.II/base/mg_level_object.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+#include <deal.II/multigrid/mg_level_timer.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include "../tests.h"
+
+
+using VectorType = Vector<double>;
+
+class MGAll : public MGSmootherBase<VectorType>,
+              public MGTransferBase<VectorType>,
+              public MGCoarseGridBase<VectorType>
+{
+public:
+  virtual void
+  smooth(const unsigned int, VectorType &, const VectorType &) const override
+  {}
+
+  virtual void
+  prolongate(const unsigned int,
+             VectorType &,
+             const VectorType &) const override
+  {}
+
+  virtual void
+  restrict_and_add(const unsigned int,
+                   VectorType &,
+                   const VectorType &) const override
+  {}
+
+  virtual void
+  clear() override
+  {}
+
+  virtual void
+  operator()(const unsigned int,
+             VectorType &,
+             const VectorType &) const override
+  {}
+};
+
+
+
+void
+print_timed_operations(const MGLevelTimer &timer,
+                       const unsigned int  minlevel,
+                       const unsigned int  maxlevel)
+{
+  const std::array<std::string, MGLevelTimer::n_operations> names = {
+    {"pre-smoothing",
+     "residual",
+     "restriction",
+     "coarse solve",
+     "prolongation",
+     "post-smoothing"}};
+
+  for (unsigned int level = minlevel; level <= maxlevel; ++level)
+    {
+      deallog << "Level " << level << ":";
+      for (unsigned int op = 0; op < MGLevelTimer::n_operations; ++op)
+        if (timer.get_wall_time(level,
+                                static_cast<MGLevelTimer::Operation>(op)) > 0.)
+          deallog << ' ' << names[op];
+      deallog << std::endl;
+    }
+}
+
+
+
+void
+test(const unsigned int minlevel, const unsigned int maxlevel)
+{
+  MGAll                             all;
+  MGLevelObject<FullMatrix<double>> level_matrices(0, maxlevel);
+  for (unsigned int i = 0; i <= maxlevel; ++i)
+    level_matrices[i].reinit(3, 3);
+  mg::Matrix<VectorType> mg_matrix(level_matrices);
+
+  Multigrid<VectorType> mg(
+    mg_matrix, all, all, all, all, minlevel, maxlevel);
+  for (unsigned int i = minlevel; i <= maxlevel; ++i)
+    mg.defect[i].reinit(3);
+
+  MGLevelTimer timer(mg);
+  mg.cycle();
+  print_timed_operations(timer, minlevel, maxlevel);
+
+  std::vector<double> times;
+  for (unsigned int level = minlevel; level <= maxlevel; ++level)
+    times.push_back(
+      timer.get_wall_time(level, MGLevelTimer::Operation::pre_smoothing));
+
+  timer.disconnect();
+  mg.cycle();
+  bool unchanged = true;
+  for (unsigned int level = minlevel; level <= maxlevel; ++level)
+    unchanged &=
+      (timer.get_wall_time(level, MGLevelTimer::Operation::pre_smoothing) ==
+       times[level - minlevel]);
+  deallog << "Times unchanged after disconnect: " << unchanged << std::endl;
+
+  timer.reset();
+  deallog << "After reset:" << std::endl;
+  print_timed_operations(timer, minlevel, maxlevel);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test(0, 2);
+  test(1, 3);
+}
@@ -111,6 +111,10 @@ struct Measurement
     : instruction_count(results)
   {}
 
+  Measurement(const std::vector<double> &results)
+    : timing(results)
+  {}
+
   std::vector<double>        timing;
   std::vector<std::uint64_t> instruction_count;
 };
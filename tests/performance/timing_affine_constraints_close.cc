@@ -0,0 +1,120 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A performance benchmark for AffineConstraints::close() on a locally
+// refined 3D mesh with Q2 elements, where the hanging node constraints are
+// combined with periodicity constraints in x direction and homogeneous
+// Dirichlet constraints in z direction. The refinement differs on the two
+// periodic faces, so that many constraints form chains that close() needs
+// to resolve. The time of close() is measured with one thread and with all
+// available threads.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"AffineConstraints::close (1 thread)",
+           "AffineConstraints::close (all threads)"}};
+}
+
+
+Measurement
+perform_single_measurement()
+{
+  const unsigned int dim = 3;
+
+  unsigned int n_refinements = 0;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_refinements = 3;
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 4;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements = 5;
+        break;
+    }
+
+  // refine the half of the cube next to the face x=0 and a ball around the
+  // center once more, which creates hanging nodes on one of the periodic
+  // faces and in the interior
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation, 0., 1., true);
+  triangulation.refine_global(n_refinements);
+  Point<dim> center;
+  for (unsigned int d = 0; d < dim; ++d)
+    center[d] = 0.5;
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->center()[0] < 0.5 || cell->center().distance(center) < 0.3)
+      cell->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+
+  const FE_Q<dim> fe(2);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  DoFTools::make_periodicity_constraints(dof_handler, 0, 1, 0, constraints);
+  DoFTools::make_zero_boundary_constraints(dof_handler, 4, constraints);
+  DoFTools::make_zero_boundary_constraints(dof_handler, 5, constraints);
+
+  const unsigned int n_repetitions = 10;
+  std::vector<AffineConstraints<double>> copies(n_repetitions);
+
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    copies[i].copy_from(constraints);
+  MultithreadInfo::set_thread_limit(1);
+  Timer timer;
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    copies[i].close();
+  const double time_serial = timer.wall_time();
+
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    copies[i].copy_from(constraints);
+  MultithreadInfo::set_thread_limit();
+  timer.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    copies[i].close();
+  const double time_parallel = timer.wall_time();
+
+  return {time_serial, time_parallel};
+}
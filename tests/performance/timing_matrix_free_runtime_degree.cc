@@ -0,0 +1,145 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A performance benchmark for the matrix-free evaluation of the Laplacian
+// with FEEvaluation using a run-time polynomial degree between 1 and 12 in
+// 3D. Up to degree FE_EVAL_FACTORY_DEGREE_MAX, precompiled kernels with
+// templated loop bounds are used, beyond that the kernels with run-time loop
+// bounds. The measured times are normalized by the number of unknowns, i.e.,
+// they are the time per unknown and operator evaluation.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+
+const unsigned int max_degree = 12;
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  std::vector<std::string> names;
+  for (unsigned int degree = 1; degree <= max_degree; ++degree)
+    names.push_back("degree " + std::to_string(degree));
+  return {Metric::timing, 4, names};
+}
+
+
+double
+measure_laplacian(const unsigned int degree)
+{
+  const unsigned int dim = 3;
+
+  unsigned int n_dofs_target = 0;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_dofs_target = 200000;
+        break;
+      case TestingEnvironment::medium:
+        n_dofs_target = 1000000;
+        break;
+      case TestingEnvironment::heavy:
+        n_dofs_target = 5000000;
+        break;
+    }
+
+  // choose the number of cells to get roughly the same number of unknowns
+  // for all degrees
+  const unsigned int n_subdivisions = std::max<unsigned int>(
+    1,
+    std::round(std::cbrt(static_cast<double>(n_dofs_target) /
+                         Utilities::pow(degree + 1, dim))));
+  Triangulation<dim> triangulation;
+  GridGenerator::subdivided_hyper_cube(triangulation, n_subdivisions);
+
+  const FE_DGQ<dim> fe(degree);
+  DoFHandler<dim>   dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme =
+    MatrixFree<dim, double>::AdditionalData::none;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     AffineConstraints<double>(),
+                     QGauss<1>(degree + 1),
+                     additional_data);
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = static_cast<double>(i % 17) / 17.;
+
+  const std::function<void(const MatrixFree<dim, double> &,
+                           Vector<double> &,
+                           const Vector<double> &,
+                           const std::pair<unsigned int, unsigned int> &)>
+    cell_operation = [](const MatrixFree<dim, double>               &data,
+                        Vector<double>                              &dst,
+                        const Vector<double>                        &src,
+                        const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, -1> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src, EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            phi.submit_gradient(phi.get_gradient(q), q);
+          phi.integrate_scatter(EvaluationFlags::gradients, dst);
+        }
+    };
+
+  const unsigned int n_repetitions = 20;
+
+  Timer timer;
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    matrix_free.cell_loop(cell_operation, dst, src, true);
+
+  return timer.wall_time() / n_repetitions / dof_handler.n_dofs();
+}
+
+
+Measurement
+perform_single_measurement()
+{
+  std::vector<double> results;
+  for (unsigned int degree = 1; degree <= max_degree; ++degree)
+    results.push_back(measure_laplacian(degree));
+  return results;
+}
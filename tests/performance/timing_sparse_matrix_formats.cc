@@ -0,0 +1,127 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A performance benchmark that compares the matrix-vector product of the
+// compressed row storage in SparseMatrix with the ones of ChunkSparseMatrix
+// and SlicedEllpackMatrix for the Laplace matrix of a Q2 discretization in
+// 3D.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/chunk_sparse_matrix.h>
+#include <deal.II/lac/chunk_sparsity_pattern.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sliced_ellpack_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/matrix_creator.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"SparseMatrix::vmult",
+           "ChunkSparseMatrix::vmult",
+           "SlicedEllpackMatrix::vmult"}};
+}
+
+
+Measurement
+perform_single_measurement()
+{
+  const unsigned int dim = 3;
+
+  unsigned int n_refinements = 0;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_refinements = 4;
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 5;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements = 6;
+        break;
+    }
+
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(n_refinements);
+
+  const FE_Q<dim> fe(2);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+  SparseMatrix<double> matrix(sparsity);
+  MatrixCreator::create_laplace_matrix(dof_handler, QGauss<dim>(3), matrix);
+
+  ChunkSparsityPattern chunk_sparsity;
+  chunk_sparsity.copy_from(dsp, 4);
+  ChunkSparseMatrix<double> chunk_matrix(chunk_sparsity);
+  for (const auto &entry : matrix)
+    chunk_matrix.set(entry.row(), entry.column(), entry.value());
+
+  const SlicedEllpackMatrix<double> sell_matrix(matrix);
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = static_cast<double>(i % 17) / 17.;
+
+  const unsigned int n_repetitions = 100;
+
+  Timer timer;
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    matrix.vmult(dst, src);
+  const double time_sparse = timer.wall_time();
+
+  timer.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    chunk_matrix.vmult(dst, src);
+  const double time_chunk = timer.wall_time();
+
+  timer.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    sell_matrix.vmult(dst, src);
+  const double time_sell = timer.wall_time();
+
+  return {time_sparse, time_chunk, time_sell};
+}
@@ -0,0 +1,173 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Apply the matrix-free Laplace plus mass operator with FE_SimplexP on
+// triangles and tetrahedra, with QGaussCollapsedSimplex that enables the
+// sum-factorized kernels in collapsed coordinates and with QGaussSimplex
+// that keeps the dense kernels, and compare the result with the product of
+// the matrix assembled by FEValues with the same quadrature formula.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_simplex_p.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_fe.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int n_components>
+void
+test(const unsigned int     degree,
+     const Quadrature<dim> &quadrature,
+     const std::string     &quadrature_name)
+{
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube_with_simplices(tria, 2);
+  GridTools::distort_random(0.2, tria);
+
+  const FESystem<dim>  fe(FE_SimplexP<dim>(degree), n_components);
+  const MappingFE<dim> mapping(FE_SimplexP<dim>(1));
+  DoFHandler<dim>      dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_values | update_gradients;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, quadrature, additional_data);
+
+  deallog << "dim=" << dim << " degree=" << degree
+          << " components=" << n_components << " " << quadrature_name << ": "
+          << (matrix_free.get_shape_info().collapsed_data.is_initialized() ?
+                "collapsed" :
+                "dense")
+          << " kernels" << std::endl;
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  matrix_free.template cell_loop<Vector<double>, Vector<double>>(
+    [](const auto &data, auto &dst, const auto &src, const auto cells) {
+      FEEvaluation<dim, -1, 0, n_components, double> phi(data);
+      for (unsigned int cell = cells.first; cell < cells.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src,
+                              EvaluationFlags::values |
+                                EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              phi.submit_value(phi.get_value(q), q);
+              phi.submit_gradient(phi.get_gradient(q), q);
+            }
+          phi.integrate_scatter(EvaluationFlags::values |
+                                  EvaluationFlags::gradients,
+                                dst);
+        }
+    },
+    dst,
+    src,
+    true);
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+  SparsityPattern sparsity_pattern;
+  sparsity_pattern.copy_from(dsp);
+  SparseMatrix<double> matrix(sparsity_pattern);
+
+  FEValues<dim> fe_values(mapping,
+                          fe,
+                          quadrature,
+                          update_values | update_gradients |
+                            update_JxW_values);
+  FullMatrix<double> cell_matrix(fe.n_dofs_per_cell(), fe.n_dofs_per_cell());
+  std::vector<types::global_dof_index> local_dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      fe_values.reinit(cell);
+      cell_matrix = 0;
+      for (const unsigned int q : fe_values.quadrature_point_indices())
+        for (const unsigned int i : fe_values.dof_indices())
+          for (const unsigned int j : fe_values.dof_indices())
+            if (fe.system_to_component_index(i).first ==
+                fe.system_to_component_index(j).first)
+              {
+                const unsigned int c = fe.system_to_component_index(i).first;
+                cell_matrix(i, j) +=
+                  (fe_values.shape_value_component(i, q, c) *
+                     fe_values.shape_value_component(j, q, c) +
+                   fe_values.shape_grad_component(i, q, c) *
+                     fe_values.shape_grad_component(j, q, c)) *
+                  fe_values.JxW(q);
+              }
+      cell->get_dof_indices(local_dof_indices);
+      constraints.distribute_local_to_global(cell_matrix,
+                                             local_dof_indices,
+                                             matrix);
+    }
+
+  Vector<double> reference(dof_handler.n_dofs());
+  matrix.vmult(reference, src);
+  dst -= reference;
+  deallog << "  difference to assembled matrix: "
+          << (dst.linfty_norm() < 1e-12 * reference.linfty_norm() ? "zero" :
+                                                                    "nonzero")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (unsigned int degree = 1; degree < 4; ++degree)
+    test<2, 1>(degree,
+               QGaussCollapsedSimplex<2>(degree + 1),
+               "QGaussCollapsedSimplex");
+  test<2, 2>(3, QGaussCollapsedSimplex<2>(4), "QGaussCollapsedSimplex");
+  test<2, 1>(3, QGaussSimplex<2>(4), "QGaussSimplex");
+
+  for (unsigned int degree = 1; degree < 4; ++degree)
+    test<3, 1>(degree,
+               QGaussCollapsedSimplex<3>(degree + 1),
+               "QGaussCollapsedSimplex");
+  test<3, 3>(2, QGaussCollapsedSimplex<3>(3), "QGaussCollapsedSimplex");
+  test<3, 1>(2, QGaussSimplex<3>(3), "QGaussSimplex");
+}